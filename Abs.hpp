@@ -8,9 +8,15 @@
 #pragma once
 #include "Fill.hpp"
 #include "Convert.hpp"
+#include "Span.hpp"
 
 namespace Langulus::SIMD
 {
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerAbs(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
 		
 	/// Get absolute values via SIMD															
 	///	@tparam T - the type of the array element										
@@ -88,4 +94,38 @@ namespace Langulus::SIMD
 		return InnerAbs<T, S>(Load<0>(value));
 	}
 
+	/// Get the absolute values of a span of signed numbers							
+	///	@param input - the numbers to get the absolute values of					
+	///	@param output - [out] the absolute values										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void AbsSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerAbs<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return static_cast<T>(v < T {0} ? -v : v);
+			}
+		);
+	}
+
+	/// Get the absolute values of a span of signed numbers in place				
+	///	@param data - [in/out] the numbers to get the absolute values of		
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void AbsSpan(DATA&& data) noexcept {
+		AbsSpan(data, data);
+	}
+
+	/// Get the absolute values of an array												
+	///	@param value - the numbers to get the absolute values of					
+	///	@param output - [out] the absolute values										
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Abs(const T(&value)[S], T(&output)[S]) noexcept {
+		AbsSpan(value, output);
+	}
+
 } // namespace Langulus::SIMD
\ No newline at end of file
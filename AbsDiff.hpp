@@ -0,0 +1,298 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Store.hpp"
+#include "Span.hpp"
+#include "MoreSIMD.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Get the absolute difference of two numbers, the old way						
+	/// Signed integers wrap around, like they do in SIMD, so the difference	
+	/// of -128 and 127 as std::int8_t is -1 (255 if reinterpreted)				
+	///	@param lhs - the left-hand-side number											
+	///	@param rhs - the right-hand-side number										
+	///	@return the absolute difference													
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) constexpr T AbsDiffFallback(const T& lhs, const T& rhs) noexcept {
+		if constexpr (CT::Real<T>)
+			return ::std::abs(lhs - rhs);
+		else {
+			// Subtract as unsigned, because signed overflow is undefined	
+			using U = ::std::make_unsigned_t<T>;
+			return static_cast<T>(lhs < rhs
+				? static_cast<U>(static_cast<U>(rhs) - static_cast<U>(lhs))
+				: static_cast<U>(static_cast<U>(lhs) - static_cast<U>(rhs)));
+		}
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto AbsDiffInner(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the absolute difference of two arrays using SIMD							
+	/// Unsigned bytes and words use saturated subtraction both ways, other		
+	/// integers subtract the min from the max, and reals clear the sign			
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left-hand-side array											
+	///	@param rhs - the right-hand-side array											
+	///	@return the absolute differences as a register								
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto AbsDiffInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		if constexpr (CT::SIMD128<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>)
+				return simde_mm_sub_epi8(simde_mm_max_epi8(lhs, rhs), simde_mm_min_epi8(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return _mm_absdiff_epu8(lhs, rhs);
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm_sub_epi16(simde_mm_max_epi16(lhs, rhs), simde_mm_min_epi16(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return _mm_absdiff_epu16(lhs, rhs);
+			else if constexpr (CT::SignedInteger32<T>)
+				return simde_mm_sub_epi32(simde_mm_max_epi32(lhs, rhs), simde_mm_min_epi32(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger32<T>)
+				return simde_mm_sub_epi32(simde_mm_max_epu32(lhs, rhs), simde_mm_min_epu32(lhs, rhs));
+			else if constexpr (CT::Integer64<T>) {
+				// Negate the difference where rhs is bigger - unsigned		
+				// numbers are compared as signed, with their top bit flipped
+				const auto bias = CT::SignedInteger64<T>
+					? simde_mm_setzero_si128()
+					: simde_mm_set1_epi64x(::std::numeric_limits<::std::int64_t>::min());
+				const auto mask = simde_mm_cmpgt_epi64(simde_mm_xor_si128(rhs, bias), simde_mm_xor_si128(lhs, bias));
+				return simde_mm_sub_epi64(simde_mm_xor_si128(simde_mm_sub_epi64(lhs, rhs), mask), mask);
+			}
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm_andnot_ps(simde_mm_set1_ps(-0.0F), simde_mm_sub_ps(lhs, rhs));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm_andnot_pd(simde_mm_set1_pd(-0.0), simde_mm_sub_pd(lhs, rhs));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AbsDiffInner of 16-byte package");
+		}
+		else if constexpr (CT::SIMD256<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>)
+				return simde_mm256_sub_epi8(simde_mm256_max_epi8(lhs, rhs), simde_mm256_min_epi8(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return simde_mm256_or_si256(simde_mm256_subs_epu8(lhs, rhs), simde_mm256_subs_epu8(rhs, lhs));
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm256_sub_epi16(simde_mm256_max_epi16(lhs, rhs), simde_mm256_min_epi16(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm256_or_si256(simde_mm256_subs_epu16(lhs, rhs), simde_mm256_subs_epu16(rhs, lhs));
+			else if constexpr (CT::SignedInteger32<T>)
+				return simde_mm256_sub_epi32(simde_mm256_max_epi32(lhs, rhs), simde_mm256_min_epi32(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger32<T>)
+				return simde_mm256_sub_epi32(simde_mm256_max_epu32(lhs, rhs), simde_mm256_min_epu32(lhs, rhs));
+			else if constexpr (CT::Integer64<T>) {
+				const auto bias = CT::SignedInteger64<T>
+					? simde_mm256_setzero_si256()
+					: simde_mm256_set1_epi64x(::std::numeric_limits<::std::int64_t>::min());
+				const auto mask = simde_mm256_cmpgt_epi64(simde_mm256_xor_si256(rhs, bias), simde_mm256_xor_si256(lhs, bias));
+				return simde_mm256_sub_epi64(simde_mm256_xor_si256(simde_mm256_sub_epi64(lhs, rhs), mask), mask);
+			}
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm256_andnot_ps(simde_mm256_set1_ps(-0.0F), simde_mm256_sub_ps(lhs, rhs));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm256_andnot_pd(simde_mm256_set1_pd(-0.0), simde_mm256_sub_pd(lhs, rhs));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AbsDiffInner of 32-byte package");
+		}
+		else if constexpr (CT::SIMD512<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>)
+				return simde_mm512_sub_epi8(simde_mm512_max_epi8(lhs, rhs), simde_mm512_min_epi8(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return simde_mm512_sub_epi8(simde_mm512_max_epu8(lhs, rhs), simde_mm512_min_epu8(lhs, rhs));
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm512_sub_epi16(simde_mm512_max_epi16(lhs, rhs), simde_mm512_min_epi16(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm512_sub_epi16(simde_mm512_max_epu16(lhs, rhs), simde_mm512_min_epu16(lhs, rhs));
+			else if constexpr (CT::SignedInteger32<T>)
+				return simde_mm512_sub_epi32(simde_mm512_max_epi32(lhs, rhs), simde_mm512_min_epi32(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger32<T>)
+				return simde_mm512_sub_epi32(simde_mm512_max_epu32(lhs, rhs), simde_mm512_min_epu32(lhs, rhs));
+			else if constexpr (CT::SignedInteger64<T>)
+				return simde_mm512_sub_epi64(simde_mm512_max_epi64(lhs, rhs), simde_mm512_min_epi64(lhs, rhs));
+			else if constexpr (CT::UnsignedInteger64<T>)
+				return simde_mm512_sub_epi64(simde_mm512_max_epu64(lhs, rhs), simde_mm512_min_epu64(lhs, rhs));
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm512_abs_ps(simde_mm512_sub_ps(lhs, rhs));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm512_abs_pd(simde_mm512_sub_pd(lhs, rhs));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AbsDiffInner of 64-byte package");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::AbsDiffInner");
+	}
+
+	///																								
+	template<class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) auto AbsDiff(const LHS& lhsOrig, const RHS& rhsOrig) noexcept {
+		using REGISTER = CT::Register<LHS, RHS>;
+		using LOSSLESS = CT::Lossless<LHS, RHS>;
+		constexpr auto S = OverlapCount<LHS, RHS>();
+		return AttemptSIMD<0, REGISTER, LOSSLESS>(
+			lhsOrig, rhsOrig,
+			[](const REGISTER& lhs, const REGISTER& rhs) noexcept {
+				return AbsDiffInner<LOSSLESS, S>(lhs, rhs);
+			},
+			[](const LOSSLESS& lhs, const LOSSLESS& rhs) noexcept -> LOSSLESS {
+				return AbsDiffFallback(lhs, rhs);
+			}
+		);
+	}
+
+	///																								
+	template<class LHS, class RHS, class OUT>
+	LANGULUS(ALWAYSINLINE) void AbsDiff(const LHS& lhs, const RHS& rhs, OUT& output) noexcept {
+		const auto result = AbsDiff<LHS, RHS>(lhs, rhs);
+		if constexpr (CT::TSIMD<decltype(result)>) {
+			// Extract from register													
+			Store(result, output);
+		}
+		else if constexpr (!CT::Array<OUT>) {
+			// Extract from number														
+			output = result;
+		}
+		else {
+			// Extract from std::array													
+			StoreFallback(result, output);
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER AbsDiffWrap(const LHS& lhs, const RHS& rhs) noexcept {
+		WRAPPER result;
+		AbsDiff<LHS, RHS>(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Get the absolute differences of two spans										
+	///	@param lhs - the left-hand-side numbers										
+	///	@param rhs - the right-hand-side numbers										
+	///	@param output - [out] the absolute differences								
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void AbsDiffSpan(LHS&& lhs, RHS&& rhs, OUT&& output) noexcept {
+		using T = SpanType<LHS>;
+		static_assert(CT::Same<T, SpanType<RHS>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		const auto count = OverlapCount(lhs, rhs);
+		StreamBinary<0>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs), ::std::ranges::data(output),
+			count < ::std::ranges::size(output) ? count : ::std::ranges::size(output),
+			[](const REGISTER& l, const REGISTER& r) noexcept {
+				return AbsDiffInner<T, MaxLanes<T>>(l, r);
+			},
+			[](const T& l, const T& r) noexcept -> T {
+				return AbsDiffFallback(l, r);
+			}
+		);
+	}
+
+	/// Sum the absolute differences of two runs of bytes, using sad_epu8		
+	///	@param lhs - the left-hand-side bytes											
+	///	@param rhs - the right-hand-side bytes											
+	///	@param count - number of bytes in both											
+	///	@return the sum																		
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint64_t InnerSumAbsDiff(const ::std::uint8_t* lhs, const ::std::uint8_t* rhs, Count count) noexcept {
+		::std::uint64_t sum = 0;
+		Count i = 0;
+
+		#if LANGULUS_SIMD(512BIT)
+			if (i + 64 <= count) {
+				auto sums = simde_mm512_setzero_si512();
+				for (; i + 64 <= count; i += 64) {
+					sums = simde_mm512_add_epi64(sums, simde_mm512_sad_epu8(
+						simde_mm512_loadu_si512(lhs + i), simde_mm512_loadu_si512(rhs + i)));
+				}
+				sum += static_cast<::std::uint64_t>(simde_mm512_reduce_add_epi64(sums));
+			}
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if (i + 32 <= count) {
+				auto sums = simde_mm256_setzero_si256();
+				for (; i + 32 <= count; i += 32) {
+					sums = simde_mm256_add_epi64(sums, simde_mm256_sad_epu8(
+						simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(lhs + i)),
+						simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(rhs + i))));
+				}
+				const auto half = simde_mm_add_epi64(
+					simde_mm256_castsi256_si128(sums), simde_mm256_extracti128_si256(sums, 1));
+				sum += static_cast<::std::uint64_t>(simde_mm_cvtsi128_si64(half))
+					+ static_cast<::std::uint64_t>(simde_mm_extract_epi64(half, 1));
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			if (i + 16 <= count) {
+				auto sums = simde_mm_setzero_si128();
+				for (; i + 16 <= count; i += 16) {
+					sums = simde_mm_add_epi64(sums, simde_mm_sad_epu8(
+						simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(lhs + i)),
+						simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(rhs + i))));
+				}
+				sum += static_cast<::std::uint64_t>(simde_mm_cvtsi128_si64(sums))
+					+ static_cast<::std::uint64_t>(simde_mm_extract_epi64(sums, 1));
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i)
+			sum += AbsDiffFallback(lhs[i], rhs[i]);
+		return sum;
+	}
+
+	/// Sum the absolute differences of two spans of bytes							
+	///	@param lhs - the left-hand-side bytes											
+	///	@param rhs - the right-hand-side bytes											
+	///	@return the sum, over as many bytes as there are in both					
+	template<CT::Span LHS, CT::Span RHS>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint64_t SumAbsDiff(LHS&& lhs, RHS&& rhs) noexcept {
+		static_assert(CT::UnsignedInteger8<SpanType<LHS>> && CT::UnsignedInteger8<SpanType<RHS>>,
+			"SIMD::SumAbsDiff works only on spans of unsigned bytes");
+		return InnerSumAbsDiff(
+			reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(lhs)),
+			reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(rhs)),
+			OverlapCount(lhs, rhs));
+	}
+
+	/// Sum the absolute differences of two blocks of bytes inside images,		
+	/// as used in motion estimation and template matching							
+	/// Rows that don't fit in either span are skipped									
+	///	@param lhs - the left-hand-side image											
+	///	@param rhs - the right-hand-side image											
+	///	@param width - width of the block, in bytes									
+	///	@param height - height of the block, in rows									
+	///	@param lhsStride - distance between rows in lhs, in bytes				
+	///	@param rhsStride - distance between rows in rhs, in bytes				
+	///	@return the sum																		
+	template<CT::Span LHS, CT::Span RHS>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint64_t SumAbsDiff(
+		LHS&& lhs, RHS&& rhs, Count width, Count height, Count lhsStride, Count rhsStride
+	) noexcept {
+		static_assert(CT::UnsignedInteger8<SpanType<LHS>> && CT::UnsignedInteger8<SpanType<RHS>>,
+			"SIMD::SumAbsDiff works only on spans of unsigned bytes");
+		auto l = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(lhs));
+		auto r = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(rhs));
+		::std::uint64_t sum = 0;
+		for (Count row = 0; row < height; ++row) {
+			if (row * lhsStride + width > ::std::ranges::size(lhs)
+			 || row * rhsStride + width > ::std::ranges::size(rhs))
+				break;
+			sum += InnerSumAbsDiff(l + row * lhsStride, r + row * rhsStride, width);
+		}
+		return sum;
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -28,6 +28,10 @@ namespace Langulus::SIMD
 	///	@return the added elements as a register										
 	template<class T, Count S, CT::TSIMD REGISTER>
 	LANGULUS(ALWAYSINLINE) auto AddInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		if constexpr (CT::FixedPoint<T>)
+			return InnerAddFixed<T>(lhs, rhs);
+		else
+
 		#if LANGULUS_SIMD(128BIT)
 			if constexpr (CT::SIMD128<REGISTER>) {
 				if constexpr (CT::SignedInteger8<T>)
@@ -141,7 +145,7 @@ namespace Langulus::SIMD
 		}
 		else {
 			// Extract from std::array													
-			std::memcpy(output, result.data(), sizeof(output));
+			StoreFallback(result, output);
 		}
 	}
 
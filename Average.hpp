@@ -0,0 +1,234 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Store.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Average two numbers, the old way													
+	/// Integers round up, like (lhs + rhs + 1) >> 1, but without overflowing	
+	///	@param lhs - the left-hand-side number											
+	///	@param rhs - the right-hand-side number										
+	///	@return the average																	
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) constexpr T AverageFallback(const T& lhs, const T& rhs) noexcept {
+		if constexpr (CT::Real<T>)
+			return (lhs + rhs) * T(0.5);
+		else
+			return static_cast<T>((lhs | rhs) - ((lhs ^ rhs) >> 1));
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto AverageInner(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Average two arrays using SIMD														
+	/// Unsigned bytes and words use avg_epu8/16, signed ones do the same with	
+	/// their sign bits flipped, and wider integers compute							
+	/// (lhs | rhs) - ((lhs ^ rhs) >> 1)													
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left-hand-side array											
+	///	@param rhs - the right-hand-side array											
+	///	@return the averages as a register												
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto AverageInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		if constexpr (CT::SIMD128<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>) {
+				const auto sign = simde_mm_set1_epi8(static_cast<char>(0x80));
+				return simde_mm_xor_si128(simde_mm_avg_epu8(
+					simde_mm_xor_si128(lhs, sign), simde_mm_xor_si128(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return simde_mm_avg_epu8(lhs, rhs);
+			else if constexpr (CT::SignedInteger16<T>) {
+				const auto sign = simde_mm_set1_epi16(static_cast<short>(0x8000));
+				return simde_mm_xor_si128(simde_mm_avg_epu16(
+					simde_mm_xor_si128(lhs, sign), simde_mm_xor_si128(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm_avg_epu16(lhs, rhs);
+			else if constexpr (CT::SignedInteger32<T>) {
+				return simde_mm_sub_epi32(simde_mm_or_si128(lhs, rhs),
+					simde_mm_srai_epi32(simde_mm_xor_si128(lhs, rhs), 1));
+			}
+			else if constexpr (CT::UnsignedInteger32<T>) {
+				return simde_mm_sub_epi32(simde_mm_or_si128(lhs, rhs),
+					simde_mm_srli_epi32(simde_mm_xor_si128(lhs, rhs), 1));
+			}
+			else if constexpr (CT::Integer64<T>) {
+				// There's no arithmetic shift for 64-bit lanes before		
+				// AVX-512, but shifting by one only has to keep the top bit
+				const auto diff = simde_mm_xor_si128(lhs, rhs);
+				auto half = simde_mm_srli_epi64(diff, 1);
+				if constexpr (CT::SignedInteger64<T>) {
+					half = simde_mm_or_si128(half, simde_mm_and_si128(diff,
+						simde_mm_set1_epi64x(::std::numeric_limits<::std::int64_t>::min())));
+				}
+				return simde_mm_sub_epi64(simde_mm_or_si128(lhs, rhs), half);
+			}
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm_mul_ps(simde_mm_add_ps(lhs, rhs), simde_mm_set1_ps(0.5F));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm_mul_pd(simde_mm_add_pd(lhs, rhs), simde_mm_set1_pd(0.5));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AverageInner of 16-byte package");
+		}
+		else if constexpr (CT::SIMD256<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>) {
+				const auto sign = simde_mm256_set1_epi8(static_cast<char>(0x80));
+				return simde_mm256_xor_si256(simde_mm256_avg_epu8(
+					simde_mm256_xor_si256(lhs, sign), simde_mm256_xor_si256(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return simde_mm256_avg_epu8(lhs, rhs);
+			else if constexpr (CT::SignedInteger16<T>) {
+				const auto sign = simde_mm256_set1_epi16(static_cast<short>(0x8000));
+				return simde_mm256_xor_si256(simde_mm256_avg_epu16(
+					simde_mm256_xor_si256(lhs, sign), simde_mm256_xor_si256(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm256_avg_epu16(lhs, rhs);
+			else if constexpr (CT::SignedInteger32<T>) {
+				return simde_mm256_sub_epi32(simde_mm256_or_si256(lhs, rhs),
+					simde_mm256_srai_epi32(simde_mm256_xor_si256(lhs, rhs), 1));
+			}
+			else if constexpr (CT::UnsignedInteger32<T>) {
+				return simde_mm256_sub_epi32(simde_mm256_or_si256(lhs, rhs),
+					simde_mm256_srli_epi32(simde_mm256_xor_si256(lhs, rhs), 1));
+			}
+			else if constexpr (CT::Integer64<T>) {
+				const auto diff = simde_mm256_xor_si256(lhs, rhs);
+				auto half = simde_mm256_srli_epi64(diff, 1);
+				if constexpr (CT::SignedInteger64<T>) {
+					half = simde_mm256_or_si256(half, simde_mm256_and_si256(diff,
+						simde_mm256_set1_epi64x(::std::numeric_limits<::std::int64_t>::min())));
+				}
+				return simde_mm256_sub_epi64(simde_mm256_or_si256(lhs, rhs), half);
+			}
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm256_mul_ps(simde_mm256_add_ps(lhs, rhs), simde_mm256_set1_ps(0.5F));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm256_mul_pd(simde_mm256_add_pd(lhs, rhs), simde_mm256_set1_pd(0.5));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AverageInner of 32-byte package");
+		}
+		else if constexpr (CT::SIMD512<REGISTER>) {
+			if constexpr (CT::SignedInteger8<T>) {
+				const auto sign = simde_mm512_set1_epi8(static_cast<char>(0x80));
+				return simde_mm512_xor_si512(simde_mm512_avg_epu8(
+					simde_mm512_xor_si512(lhs, sign), simde_mm512_xor_si512(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger8<T>)
+				return simde_mm512_avg_epu8(lhs, rhs);
+			else if constexpr (CT::SignedInteger16<T>) {
+				const auto sign = simde_mm512_set1_epi16(static_cast<short>(0x8000));
+				return simde_mm512_xor_si512(simde_mm512_avg_epu16(
+					simde_mm512_xor_si512(lhs, sign), simde_mm512_xor_si512(rhs, sign)), sign);
+			}
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm512_avg_epu16(lhs, rhs);
+			else if constexpr (CT::SignedInteger32<T>) {
+				return simde_mm512_sub_epi32(simde_mm512_or_si512(lhs, rhs),
+					simde_mm512_srai_epi32(simde_mm512_xor_si512(lhs, rhs), 1));
+			}
+			else if constexpr (CT::UnsignedInteger32<T>) {
+				return simde_mm512_sub_epi32(simde_mm512_or_si512(lhs, rhs),
+					simde_mm512_srli_epi32(simde_mm512_xor_si512(lhs, rhs), 1));
+			}
+			else if constexpr (CT::SignedInteger64<T>) {
+				return simde_mm512_sub_epi64(simde_mm512_or_si512(lhs, rhs),
+					simde_mm512_srai_epi64(simde_mm512_xor_si512(lhs, rhs), 1));
+			}
+			else if constexpr (CT::UnsignedInteger64<T>) {
+				return simde_mm512_sub_epi64(simde_mm512_or_si512(lhs, rhs),
+					simde_mm512_srli_epi64(simde_mm512_xor_si512(lhs, rhs), 1));
+			}
+			else if constexpr (CT::RealSP<T>)
+				return simde_mm512_mul_ps(simde_mm512_add_ps(lhs, rhs), simde_mm512_set1_ps(0.5F));
+			else if constexpr (CT::RealDP<T>)
+				return simde_mm512_mul_pd(simde_mm512_add_pd(lhs, rhs), simde_mm512_set1_pd(0.5));
+			else LANGULUS_ASSERT("Unsupported type for SIMD::AverageInner of 64-byte package");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::AverageInner");
+	}
+
+	///																								
+	template<class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) auto Average(const LHS& lhsOrig, const RHS& rhsOrig) noexcept {
+		using REGISTER = CT::Register<LHS, RHS>;
+		using LOSSLESS = CT::Lossless<LHS, RHS>;
+		constexpr auto S = OverlapCount<LHS, RHS>();
+		return AttemptSIMD<0, REGISTER, LOSSLESS>(
+			lhsOrig, rhsOrig,
+			[](const REGISTER& lhs, const REGISTER& rhs) noexcept {
+				return AverageInner<LOSSLESS, S>(lhs, rhs);
+			},
+			[](const LOSSLESS& lhs, const LOSSLESS& rhs) noexcept -> LOSSLESS {
+				return AverageFallback(lhs, rhs);
+			}
+		);
+	}
+
+	///																								
+	template<class LHS, class RHS, class OUT>
+	LANGULUS(ALWAYSINLINE) void Average(const LHS& lhs, const RHS& rhs, OUT& output) noexcept {
+		const auto result = Average<LHS, RHS>(lhs, rhs);
+		if constexpr (CT::TSIMD<decltype(result)>) {
+			// Extract from register													
+			Store(result, output);
+		}
+		else if constexpr (!CT::Array<OUT>) {
+			// Extract from number														
+			output = result;
+		}
+		else {
+			// Extract from std::array													
+			StoreFallback(result, output);
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER AverageWrap(const LHS& lhs, const RHS& rhs) noexcept {
+		WRAPPER result;
+		Average<LHS, RHS>(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Average two spans																		
+	///	@param lhs - the left-hand-side numbers										
+	///	@param rhs - the right-hand-side numbers										
+	///	@param output - [out] the averages												
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void AverageSpan(LHS&& lhs, RHS&& rhs, OUT&& output) noexcept {
+		using T = SpanType<LHS>;
+		static_assert(CT::Same<T, SpanType<RHS>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		const auto count = OverlapCount(lhs, rhs);
+		StreamBinary<0>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs), ::std::ranges::data(output),
+			count < ::std::ranges::size(output) ? count : ::std::ranges::size(output),
+			[](const REGISTER& l, const REGISTER& r) noexcept {
+				return AverageInner<T, MaxLanes<T>>(l, r);
+			},
+			[](const T& l, const T& r) noexcept -> T {
+				return AverageFallback(l, r);
+			}
+		);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
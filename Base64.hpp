@@ -0,0 +1,310 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include <array>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// The base64 alphabet, as in RFC 4648												
+	constexpr char Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	/// The six-bit value of each character, or -1 if not in the alphabet		
+	constexpr auto Base64Values = []() {
+		::std::array<::std::int8_t, 256> values {};
+		for (auto& v : values)
+			v = -1;
+		for (int i = 0; i < 64; ++i)
+			values[static_cast<::std::uint8_t>(Base64Alphabet[i])] = static_cast<::std::int8_t>(i);
+		return values;
+	}();
+
+	/// Get the number of characters needed to encode some bytes					
+	///	@param bytes - the number of bytes to encode									
+	///	@return the number of characters, including padding						
+	NOD() constexpr Count Base64EncodedSize(Count bytes) noexcept {
+		return (bytes + 2) / 3 * 4;
+	}
+
+	/// Get the number of bytes a base64 text decodes to								
+	/// The text isn't validated, only its length and padding are taken			
+	///	@param text - the base64 text														
+	///	@return the number of bytes														
+	template<CT::Span TEXT>
+	NOD() LANGULUS(ALWAYSINLINE) Count Base64DecodedSize(TEXT&& text) noexcept {
+		const Count count = ::std::ranges::size(text);
+		const auto in = ::std::ranges::data(text);
+		Count padding = 0;
+		if (count >= 4 && in[count - 1] == '=')
+			padding = in[count - 2] == '=' ? 2 : 1;
+		return count / 4 * 3 - padding;
+	}
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Encode the first twelve bytes of each 16-byte lane as base64			
+		/// Each three bytes are spread to four six-bit indices, one per byte,	
+		/// and then each index is offset into its range of the alphabet			
+		///	@param input - the bytes to encode											
+		///	@return the base64 characters													
+		template<class REGISTER>
+		NOD() LANGULUS(ALWAYSINLINE) REGISTER InnerBase64Encode(const REGISTER& input) noexcept {
+			const auto spread = simde_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+			const auto offsets = simde_mm_setr_epi8(
+				'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+			if constexpr (CT::SIMD128<REGISTER>) {
+				const auto in = simde_mm_shuffle_epi8(input, spread);
+				const auto indices = simde_mm_or_si128(
+					simde_mm_mulhi_epu16(simde_mm_and_si128(in, simde_mm_set1_epi32(0x0FC0FC00)), simde_mm_set1_epi32(0x04000040)),
+					simde_mm_mullo_epi16(simde_mm_and_si128(in, simde_mm_set1_epi32(0x003F03F0)), simde_mm_set1_epi32(0x01000010)));
+
+				// 0 for [a-z], 1-10 for [0-9], 11 for '+', 12 for '/', 13 for [A-Z]
+				auto range = simde_mm_subs_epu8(indices, simde_mm_set1_epi8(51));
+				range = simde_mm_or_si128(range, simde_mm_and_si128(
+					simde_mm_cmpgt_epi8(simde_mm_set1_epi8(26), indices), simde_mm_set1_epi8(13)));
+				return simde_mm_add_epi8(indices, simde_mm_shuffle_epi8(offsets, range));
+			}
+			else if constexpr (CT::SIMD256<REGISTER>) {
+				const auto in = simde_mm256_shuffle_epi8(input, simde_mm256_broadcastsi128_si256(spread));
+				const auto indices = simde_mm256_or_si256(
+					simde_mm256_mulhi_epu16(simde_mm256_and_si256(in, simde_mm256_set1_epi32(0x0FC0FC00)), simde_mm256_set1_epi32(0x04000040)),
+					simde_mm256_mullo_epi16(simde_mm256_and_si256(in, simde_mm256_set1_epi32(0x003F03F0)), simde_mm256_set1_epi32(0x01000010)));
+
+				auto range = simde_mm256_subs_epu8(indices, simde_mm256_set1_epi8(51));
+				range = simde_mm256_or_si256(range, simde_mm256_and_si256(
+					simde_mm256_cmpgt_epi8(simde_mm256_set1_epi8(26), indices), simde_mm256_set1_epi8(13)));
+				return simde_mm256_add_epi8(indices, simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(offsets), range));
+			}
+			else if constexpr (CT::SIMD512<REGISTER>) {
+				const auto in = simde_mm512_shuffle_epi8(input, simde_mm512_broadcast_i32x4(spread));
+				const auto indices = simde_mm512_or_si512(
+					simde_mm512_mulhi_epu16(simde_mm512_and_si512(in, simde_mm512_set1_epi32(0x0FC0FC00)), simde_mm512_set1_epi32(0x04000040)),
+					simde_mm512_mullo_epi16(simde_mm512_and_si512(in, simde_mm512_set1_epi32(0x003F03F0)), simde_mm512_set1_epi32(0x01000010)));
+
+				auto range = simde_mm512_subs_epu8(indices, simde_mm512_set1_epi8(51));
+				range = simde_mm512_mask_mov_epi8(range,
+					simde_mm512_cmplt_epu8_mask(indices, simde_mm512_set1_epi8(26)), simde_mm512_set1_epi8(13));
+				return simde_mm512_add_epi8(indices, simde_mm512_shuffle_epi8(simde_mm512_broadcast_i32x4(offsets), range));
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerBase64Encode");
+		}
+
+		/// Decode base64 characters, packing each sixteen of them to the first	
+		/// twelve bytes of their 16-byte lane. Lanes are then gathered to the	
+		/// front of the register																
+		///	@param input - the characters to decode									
+		///	@param output - [out] the decoded bytes									
+		///	@return false if any of the characters is not in the alphabet		
+		template<class REGISTER>
+		NOD() LANGULUS(ALWAYSINLINE) bool InnerBase64Decode(const REGISTER& input, REGISTER& output) noexcept {
+			// A character is invalid if its nibble classes intersect		
+			const auto classLow = simde_mm_setr_epi8(
+				0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const auto classHigh = simde_mm_setr_epi8(
+				0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+				0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			// Offset to add to a character, by its high nibble ('/' is 1)	
+			const auto offsets = simde_mm_setr_epi8(
+				0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const auto pack = simde_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+			if constexpr (CT::SIMD128<REGISTER>) {
+				const auto mask = simde_mm_set1_epi8(0x2F);
+				const auto high = simde_mm_and_si128(simde_mm_srli_epi32(input, 4), mask);
+				const auto classes = simde_mm_and_si128(
+					simde_mm_shuffle_epi8(classLow, simde_mm_and_si128(input, mask)),
+					simde_mm_shuffle_epi8(classHigh, high));
+				if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi8(classes, simde_mm_setzero_si128())) != 0xFFFF)
+					return false;
+
+				const auto values = simde_mm_add_epi8(input, simde_mm_shuffle_epi8(offsets,
+					simde_mm_add_epi8(simde_mm_cmpeq_epi8(input, mask), high)));
+				const auto merged = simde_mm_madd_epi16(
+					simde_mm_maddubs_epi16(values, simde_mm_set1_epi32(0x01400140)),
+					simde_mm_set1_epi32(0x00011000));
+				output = simde_mm_shuffle_epi8(merged, pack);
+				return true;
+			}
+			else if constexpr (CT::SIMD256<REGISTER>) {
+				const auto mask = simde_mm256_set1_epi8(0x2F);
+				const auto high = simde_mm256_and_si256(simde_mm256_srli_epi32(input, 4), mask);
+				const auto classes = simde_mm256_and_si256(
+					simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(classLow), simde_mm256_and_si256(input, mask)),
+					simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(classHigh), high));
+				if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi8(classes, simde_mm256_setzero_si256())) != -1)
+					return false;
+
+				const auto values = simde_mm256_add_epi8(input, simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(offsets),
+					simde_mm256_add_epi8(simde_mm256_cmpeq_epi8(input, mask), high)));
+				const auto merged = simde_mm256_madd_epi16(
+					simde_mm256_maddubs_epi16(values, simde_mm256_set1_epi32(0x01400140)),
+					simde_mm256_set1_epi32(0x00011000));
+				output = simde_mm256_permutevar8x32_epi32(
+					simde_mm256_shuffle_epi8(merged, simde_mm256_broadcastsi128_si256(pack)),
+					simde_mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+				return true;
+			}
+			else if constexpr (CT::SIMD512<REGISTER>) {
+				const auto mask = simde_mm512_set1_epi8(0x2F);
+				const auto high = simde_mm512_and_si512(simde_mm512_srli_epi32(input, 4), mask);
+				if (simde_mm512_test_epi8_mask(
+					simde_mm512_shuffle_epi8(simde_mm512_broadcast_i32x4(classLow), simde_mm512_and_si512(input, mask)),
+					simde_mm512_shuffle_epi8(simde_mm512_broadcast_i32x4(classHigh), high)))
+					return false;
+
+				const auto slash = simde_mm512_movm_epi8(simde_mm512_cmpeq_epi8_mask(input, mask));
+				const auto values = simde_mm512_add_epi8(input, simde_mm512_shuffle_epi8(simde_mm512_broadcast_i32x4(offsets),
+					simde_mm512_add_epi8(slash, high)));
+				const auto merged = simde_mm512_madd_epi16(
+					simde_mm512_maddubs_epi16(values, simde_mm512_set1_epi32(0x01400140)),
+					simde_mm512_set1_epi32(0x00011000));
+				output = simde_mm512_permutexvar_epi32(
+					simde_mm512_set_epi32(15, 11, 7, 3, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0),
+					simde_mm512_shuffle_epi8(merged, simde_mm512_broadcast_i32x4(pack)));
+				return true;
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerBase64Decode");
+		}
+	#endif
+
+	/// Encode bytes as base64 text, as in RFC 4648, with padding					
+	/// Encoding stops at the last group of four characters that fits text		
+	///	@param bytes - the bytes to encode												
+	///	@param text - [out] the base64 characters										
+	///	@return the number of characters written										
+	template<CT::Span IN, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count Base64Encode(IN&& bytes, OUT&& text) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		static_assert(sizeof(SpanType<OUT>) == 1, "Output must be a span of characters");
+		const Count count = ::std::ranges::size(bytes);
+		const Count capacity = ::std::ranges::size(text);
+		auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes));
+		auto out = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(text));
+		Count i = 0, written = 0;
+
+		// Each lane encodes twelve bytes, but loads sixteen					
+		#if LANGULUS_SIMD(512BIT)
+			for (; i + 52 <= count && written + 64 <= capacity; i += 48, written += 64) {
+				auto input = simde_mm512_castsi128_si512(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i)));
+				input = simde_mm512_inserti32x4(input, simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i + 12)), 1);
+				input = simde_mm512_inserti32x4(input, simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i + 24)), 2);
+				input = simde_mm512_inserti32x4(input, simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i + 36)), 3);
+				simde_mm512_storeu_si512(out + written, InnerBase64Encode(input));
+			}
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			for (; i + 28 <= count && written + 32 <= capacity; i += 24, written += 32) {
+				const auto input = simde_mm256_inserti128_si256(
+					simde_mm256_castsi128_si256(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i))),
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i + 12)), 1);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + written), InnerBase64Encode(input));
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			for (; i + 16 <= count && written + 16 <= capacity; i += 12, written += 16) {
+				const auto input = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i));
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + written), InnerBase64Encode(input));
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count && written + 4 <= capacity; i += 3, written += 4) {
+			const Count left = count - i;
+			const ::std::uint32_t group = (::std::uint32_t {in[i]} << 16)
+				| (left > 1 ? ::std::uint32_t {in[i + 1]} << 8 : 0)
+				| (left > 2 ? ::std::uint32_t {in[i + 2]} : 0);
+
+			out[written + 0] = Base64Alphabet[(group >> 18) & 0x3F];
+			out[written + 1] = Base64Alphabet[(group >> 12) & 0x3F];
+			out[written + 2] = left > 1 ? Base64Alphabet[(group >> 6) & 0x3F] : '=';
+			out[written + 3] = left > 2 ? Base64Alphabet[group & 0x3F] : '=';
+		}
+
+		return written;
+	}
+
+	/// Decode base64 text, as in RFC 4648, with padding								
+	/// Decoding stops at the last group of bytes that fits output					
+	///	@param text - the base64 characters to decode								
+	///	@param bytes - [out] the decoded bytes											
+	///	@return the number of bytes written												
+	template<CT::Span IN, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count Base64Decode(IN&& text, OUT&& bytes) {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of characters");
+		static_assert(sizeof(SpanType<OUT>) == 1, "Output must be a span of bytes");
+		const Count count = ::std::ranges::size(text);
+		const Count capacity = ::std::ranges::size(bytes);
+		auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(text));
+		auto out = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(bytes));
+		if (count % 4)
+			Throw<Except::Encoding>();
+
+		// The last group might be padded, so it is always done the old way
+		const Count body = count ? count - 4 : 0;
+		Count i = 0, written = 0;
+
+		// Each lane decodes to twelve bytes, but stores sixteen				
+		#if LANGULUS_SIMD(512BIT)
+			for (; i + 64 <= body && written + 64 <= capacity; i += 64, written += 48) {
+				simde__m512i output;
+				if (!InnerBase64Decode(simde_mm512_loadu_si512(in + i), output))
+					Throw<Except::Encoding>();
+				simde_mm512_storeu_si512(out + written, output);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			for (; i + 32 <= body && written + 32 <= capacity; i += 32, written += 24) {
+				simde__m256i output;
+				if (!InnerBase64Decode(simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(in + i)), output))
+					Throw<Except::Encoding>();
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + written), output);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			for (; i + 16 <= body && written + 16 <= capacity; i += 16, written += 12) {
+				simde__m128i output;
+				if (!InnerBase64Decode(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i)), output))
+					Throw<Except::Encoding>();
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + written), output);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; i += 4) {
+			Count produced = 3;
+			if (i + 4 == count && in[i + 3] == '=')
+				produced = in[i + 2] == '=' ? 1 : 2;
+			if (written + produced > capacity)
+				break;
+
+			::std::uint32_t group = 0;
+			for (Count k = 0; k <= produced; ++k) {
+				const auto value = Base64Values[in[i + k]];
+				if (value < 0)
+					Throw<Except::Encoding>();
+				group |= static_cast<::std::uint32_t>(value) << (18 - 6 * k);
+			}
+
+			for (Count k = 0; k < produced; ++k)
+				out[written++] = static_cast<::std::uint8_t>(group >> (16 - 8 * k));
+		}
+
+		return written;
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,156 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "MoreSIMD.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Byte shuffle that reverses each SIZE-byte element of a 16-byte lane		
+	///	@tparam SIZE - size of a single element, in bytes							
+	///	@return the pshufb mask																
+	template<Size SIZE>
+	NOD() LANGULUS(ALWAYSINLINE) simde__m128i ByteSwapMask() noexcept {
+		if constexpr (SIZE == 2)
+			return simde_mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+		else if constexpr (SIZE == 4)
+			return simde_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+		else if constexpr (SIZE == 8)
+			return simde_mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+		else LANGULUS_ASSERT("Unsupported element size for SIMD::ByteSwapMask");
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerByteSwap(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Reverse the byte order of each element via SIMD								
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param v - the array																	
+	///	@return the byte-swapped values													
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerByteSwap(const REGISTER& v) noexcept {
+		static_assert(sizeof(T) > 1,
+			"SIMD::InnerByteSwap is pointless for single byte values, avoid calling it on such");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::Integer16<T>)
+					return _mm_bswap_epi16(v);
+				else if constexpr (CT::Integer32<T>)
+					return _mm_bswap_epi32(v);
+				else if constexpr (CT::Integer64<T>)
+					return _mm_bswap_epi64(v);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerByteSwap of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::Integer16<T> || CT::Integer32<T> || CT::Integer64<T>)
+					return simde_mm256_shuffle_epi8(v, simde_mm256_broadcastsi128_si256(ByteSwapMask<sizeof(T)>()));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerByteSwap of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::Integer16<T> || CT::Integer32<T> || CT::Integer64<T>)
+					return simde_mm512_shuffle_epi8(v, simde_mm512_broadcast_i32x4(ByteSwapMask<sizeof(T)>()));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerByteSwap of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerByteSwap");
+	}
+
+	/// Reverse the byte order of a single number, the old way						
+	///	@param value - the number															
+	///	@return the byte-swapped number													
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) constexpr T ByteSwapFallback(const T& value) noexcept {
+		using U = ::std::make_unsigned_t<T>;
+		auto from = static_cast<U>(value);
+		U result = 0;
+		for (Size i = 0; i < sizeof(T); ++i) {
+			result = static_cast<U>((result << 8) | (from & 0xFF));
+			from = static_cast<U>(from >> 8);
+		}
+		return static_cast<T>(result);
+	}
+
+	/// Reverse the byte order of each element of an array							
+	/// Falls back to the old way if no register fits the array					
+	///	@param value - the numbers to byte-swap										
+	///	@return the byte-swapped numbers, as a register or std::array			
+	template<class T, Count S>
+	NOD() LANGULUS(ALWAYSINLINE) auto ByteSwap(const T(&value)[S]) noexcept {
+		using REGISTER = CT::Register<T[S], T[S]>;
+		using LOSSLESS = CT::Lossless<T[S], T[S]>;
+
+		// AttemptSIMD works on pairs, so the array is given twice, and the	
+		// second one is ignored																
+		return AttemptSIMD<0, REGISTER, LOSSLESS>(
+			value, value,
+			[](const REGISTER& v, const REGISTER&) noexcept {
+				return InnerByteSwap<LOSSLESS, S>(v);
+			},
+			[](const LOSSLESS& v, const LOSSLESS&) noexcept -> LOSSLESS {
+				return ByteSwapFallback(v);
+			}
+		);
+	}
+
+	/// Reverse the byte order of a span of 16, 32 or 64-bit integers, for		
+	/// example to convert big-endian payloads to native order						
+	///	@param input - the numbers to byte-swap										
+	///	@param output - [out] the byte-swapped numbers								
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void ByteSwapSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(CT::Integer16<T> || CT::Integer32<T> || CT::Integer64<T>,
+			"SIMD::ByteSwapSpan works only with 16, 32 and 64-bit integers");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerByteSwap<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ByteSwapFallback(v);
+			}
+		);
+	}
+
+	/// Reverse the byte order of a span of integers in place						
+	///	@param data - [in/out] the numbers to byte-swap								
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void ByteSwapSpan(DATA&& data) noexcept {
+		ByteSwapSpan(data, data);
+	}
+
+	/// Reverse the byte order of an array, writing the results to another		
+	///	@param value - the numbers to byte-swap										
+	///	@param output - [out] the byte-swapped numbers								
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void ByteSwap(const T(&value)[S], T(&output)[S]) noexcept {
+		ByteSwapSpan(value, output);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
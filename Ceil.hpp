@@ -8,10 +8,16 @@
 #pragma once
 #include "Fill.hpp"
 #include "Convert.hpp"
+#include "Span.hpp"
 
 namespace Langulus::SIMD
 {
 
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerCeil(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
 	/// Get ceiling values via SIMD															
 	///	@tparam T - the type of the array element										
 	///	@tparam S - the size of the array												
@@ -64,4 +70,38 @@ namespace Langulus::SIMD
 		return InnerCeil<T, S>(Load<0>(value));
 	}
 
+	/// Ceil a span of real numbers, writing the results to another span			
+	///	@param input - the numbers to ceil												
+	///	@param output - [out] the ceiled numbers										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void CeilSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerCeil<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ::std::ceil(v);
+			}
+		);
+	}
+
+	/// Ceil a span of real numbers in place												
+	///	@param data - [in/out] the numbers to ceil									
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void CeilSpan(DATA&& data) noexcept {
+		CeilSpan(data, data);
+	}
+
+	/// Ceil an array, writing the results to another array							
+	///	@param value - the numbers to ceil												
+	///	@param output - [out] the ceiled numbers										
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Ceil(const T(&value)[S], T(&output)[S]) noexcept {
+		CeilSpan(value, output);
+	}
+
 } // namespace Langulus::SIMD
\ No newline at end of file
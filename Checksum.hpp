@@ -0,0 +1,282 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Dot.hpp"
+#include <array>
+#include <cstring>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// The Castagnoli polynomial, bit-reflected											
+	constexpr ::std::uint32_t Crc32cPolynomial = 0x82F63B78;
+
+	/// Bytes per stream, when three CRC streams are interleaved					
+	/// Long blocks amortize the cost of merging the streams for big buffers,	
+	/// short blocks let medium buffers use the interleaving, too					
+	constexpr Count Crc32cLongBlock = 8192;
+	constexpr Count Crc32cShortBlock = 256;
+
+	/// Lookup table for computing CRC32C a byte at a time							
+	constexpr auto Crc32cTable = []() {
+		::std::array<::std::uint32_t, 256> table {};
+		for (::std::uint32_t i = 0; i < 256; ++i) {
+			auto c = i;
+			for (int bit = 0; bit < 8; ++bit)
+				c = c & 1 ? (c >> 1) ^ Crc32cPolynomial : c >> 1;
+			table[i] = c;
+		}
+		return table;
+	}();
+
+	/// Multiply two polynomials, modulo the Castagnoli polynomial					
+	/// Both polynomials are bit-reflected, like the CRC itself						
+	///	@param a - the left polynomial													
+	///	@param b - the right polynomial													
+	///	@return the product																	
+	NOD() constexpr ::std::uint32_t Crc32cMultiply(::std::uint32_t a, ::std::uint32_t b) noexcept {
+		::std::uint32_t m = 1u << 31, product = 0;
+		while (true) {
+			if (a & m) {
+				product ^= b;
+				if ((a & (m - 1)) == 0)
+					break;
+			}
+			m >>= 1;
+			b = b & 1 ? (b >> 1) ^ Crc32cPolynomial : b >> 1;
+		}
+		return product;
+	}
+
+	/// Get x^n, modulo the Castagnoli polynomial, bit-reflected					
+	///	@param n - the power																	
+	///	@return the polynomial																
+	NOD() constexpr ::std::uint32_t Crc32cPower(Count n) noexcept {
+		::std::uint32_t result = 1u << 31;
+		::std::uint32_t square = 1u << 30;
+		for (; n; n >>= 1) {
+			if (n & 1)
+				result = Crc32cMultiply(square, result);
+			square = Crc32cMultiply(square, square);
+		}
+		return result;
+	}
+
+	#if LANGULUS_SIMD(SSE4_2)
+		/// Append BYTES zero bytes to a CRC register, so that the CRCs of		
+		/// consecutive blocks can be merged with a simple XOr						
+		/// A carry-less multiplication by x^(8*BYTES-33) is reduced by the crc32
+		/// instruction itself, which adds the missing x^33. Without PCLMUL the	
+		/// multiplication by x^(8*BYTES) is done bit by bit							
+		///	@tparam BYTES - the number of zero bytes to append						
+		///	@param crc - the CRC register													
+		///	@return the shifted CRC register												
+		template<Count BYTES>
+		NOD() LANGULUS(ALWAYSINLINE) ::std::uint32_t InnerCrc32cShift(::std::uint32_t crc) noexcept {
+			#if LANGULUS_SIMD(PCLMUL)
+				constexpr auto k = Crc32cPower(8 * BYTES - 33);
+				const auto product = simde_mm_clmulepi64_si128(
+					simde_mm_cvtsi32_si128(static_cast<int>(crc)),
+					simde_mm_cvtsi32_si128(static_cast<int>(k)), 0);
+				return static_cast<::std::uint32_t>(simde_mm_crc32_u64(0,
+					static_cast<::std::uint64_t>(simde_mm_cvtsi128_si64(product))));
+			#else
+				constexpr auto k = Crc32cPower(8 * BYTES);
+				return Crc32cMultiply(k, crc);
+			#endif
+		}
+
+		/// Compute CRC32C over groups of three consecutive BLOCK-sized blocks	
+		/// The crc32 instruction has a latency of three cycles, but can start	
+		/// every cycle, so the blocks are done in parallel and merged after		
+		///	@tparam BLOCK - bytes per block, must be a multiple of 8				
+		///	@param in - [in/out] the bytes, moved past the consumed ones		
+		///	@param count - [in/out] number of bytes left								
+		///	@param crc - [in/out] the CRC register										
+		template<Count BLOCK>
+		LANGULUS(ALWAYSINLINE) void InnerCrc32cStreams(const ::std::uint8_t*& in, Count& count, ::std::uint32_t& crc) noexcept {
+			for (; count >= 3 * BLOCK; in += 3 * BLOCK, count -= 3 * BLOCK) {
+				::std::uint64_t c0 = crc, c1 = 0, c2 = 0;
+				for (Count i = 0; i < BLOCK; i += 8) {
+					::std::uint64_t v0, v1, v2;
+					::std::memcpy(&v0, in + i, 8);
+					::std::memcpy(&v1, in + BLOCK + i, 8);
+					::std::memcpy(&v2, in + 2 * BLOCK + i, 8);
+					c0 = simde_mm_crc32_u64(c0, v0);
+					c1 = simde_mm_crc32_u64(c1, v1);
+					c2 = simde_mm_crc32_u64(c2, v2);
+				}
+
+				crc = InnerCrc32cShift<BLOCK>(
+					InnerCrc32cShift<BLOCK>(static_cast<::std::uint32_t>(c0))
+					^ static_cast<::std::uint32_t>(c1)
+				) ^ static_cast<::std::uint32_t>(c2);
+			}
+		}
+	#endif
+
+	/// Compute the CRC32C (Castagnoli) checksum of some bytes						
+	/// Can be chained, by passing the checksum of the preceding bytes			
+	///	@param bytes - the bytes to checksum											
+	///	@param crc - the checksum of any preceding bytes							
+	///	@return the checksum																	
+	template<CT::Span IN>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint32_t Crc32c(IN&& bytes, ::std::uint32_t crc = 0) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		Count count = ::std::ranges::size(bytes);
+		auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes));
+		crc = ~crc;
+
+		#if LANGULUS_SIMD(SSE4_2)
+			for (; count && reinterpret_cast<::std::uintptr_t>(in) % 8; --count)
+				crc = simde_mm_crc32_u8(crc, *in++);
+
+			InnerCrc32cStreams<Crc32cLongBlock>(in, count, crc);
+			InnerCrc32cStreams<Crc32cShortBlock>(in, count, crc);
+
+			for (; count >= 8; count -= 8, in += 8) {
+				::std::uint64_t v;
+				::std::memcpy(&v, in, 8);
+				crc = static_cast<::std::uint32_t>(simde_mm_crc32_u64(crc, v));
+			}
+
+			for (; count; --count)
+				crc = simde_mm_crc32_u8(crc, *in++);
+		#else
+			// Do it the old way															
+			for (; count; --count)
+				crc = Crc32cTable[(crc ^ *in++) & 0xFF] ^ (crc >> 8);
+		#endif
+
+		return ~crc;
+	}
+
+	/// Add bytes to the running sums of Adler and Fletcher checksums				
+	/// Each byte is added to s1, and then s1 is added to s2. No modulo is		
+	/// applied, so count must be small enough for the sums not to overflow		
+	/// Byte sums are done with sad_epu8, and the weighted sums of s2 with		
+	/// maddubs, weighting each byte by its distance from the block end			
+	///	@param in - the bytes																
+	///	@param count - number of bytes													
+	///	@param s1 - [in/out] the sum of all bytes										
+	///	@param s2 - [in/out] the sum of all s1											
+	LANGULUS(ALWAYSINLINE) void InnerChecksumSums(const ::std::uint8_t* in, Count count, ::std::uint32_t& s1, ::std::uint32_t& s2) noexcept {
+		Count i = 0;
+
+		#if LANGULUS_SIMD(256BIT)
+			if (count >= 32) {
+				const auto weights = simde_mm256_setr_epi8(
+					32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+					16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+				const auto ones = simde_mm256_set1_epi16(1);
+				const auto zero = simde_mm256_setzero_si256();
+				auto sum1 = simde_mm256_setr_epi32(static_cast<int>(s1), 0, 0, 0, 0, 0, 0, 0);
+				auto sum2 = simde_mm256_setr_epi32(static_cast<int>(s2), 0, 0, 0, 0, 0, 0, 0);
+				auto previous = zero;
+
+				for (; i + 32 <= count; i += 32) {
+					const auto block = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(in + i));
+					previous = simde_mm256_add_epi32(previous, sum1);
+					sum1 = simde_mm256_add_epi32(sum1, simde_mm256_sad_epu8(block, zero));
+					sum2 = simde_mm256_add_epi32(sum2, simde_mm256_madd_epi16(simde_mm256_maddubs_epi16(block, weights), ones));
+				}
+
+				// Every block adds 32 times the preceding s1 to s2			
+				sum2 = simde_mm256_add_epi32(sum2, simde_mm256_slli_epi32(previous, 5));
+				s1 = InnerHorizontalAdd<::std::uint32_t>(sum1);
+				s2 = InnerHorizontalAdd<::std::uint32_t>(sum2);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			if (i + 16 <= count) {
+				const auto weights = simde_mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+				const auto ones = simde_mm_set1_epi16(1);
+				const auto zero = simde_mm_setzero_si128();
+				auto sum1 = simde_mm_setr_epi32(static_cast<int>(s1), 0, 0, 0);
+				auto sum2 = simde_mm_setr_epi32(static_cast<int>(s2), 0, 0, 0);
+				auto previous = zero;
+
+				for (; i + 16 <= count; i += 16) {
+					const auto block = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i));
+					previous = simde_mm_add_epi32(previous, sum1);
+					sum1 = simde_mm_add_epi32(sum1, simde_mm_sad_epu8(block, zero));
+					sum2 = simde_mm_add_epi32(sum2, simde_mm_madd_epi16(simde_mm_maddubs_epi16(block, weights), ones));
+				}
+
+				// Every block adds 16 times the preceding s1 to s2			
+				sum2 = simde_mm_add_epi32(sum2, simde_mm_slli_epi32(previous, 4));
+				s1 = InnerHorizontalAdd<::std::uint32_t>(sum1);
+				s2 = InnerHorizontalAdd<::std::uint32_t>(sum2);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			s1 += in[i];
+			s2 += s1;
+		}
+	}
+
+	/// Compute an Adler or Fletcher checksum, with sums modulo MODULO			
+	/// Bytes are summed in chunks, that are small enough for the sums of the	
+	/// biggest possible bytes to fit in 32 bits, before the modulo is taken	
+	///	@tparam MODULO - the modulo of the sums										
+	///	@tparam CHUNK - the biggest number of bytes that doesn't overflow		
+	///	@param in - the bytes																
+	///	@param count - number of bytes													
+	///	@param s1 - [in/out] the sum of all bytes										
+	///	@param s2 - [in/out] the sum of all s1											
+	template<::std::uint32_t MODULO, Count CHUNK>
+	LANGULUS(ALWAYSINLINE) void InnerChecksum(const ::std::uint8_t* in, Count count, ::std::uint32_t& s1, ::std::uint32_t& s2) noexcept {
+		while (count) {
+			const Count chunk = count < CHUNK ? count : CHUNK;
+			InnerChecksumSums(in, chunk, s1, s2);
+			s1 %= MODULO;
+			s2 %= MODULO;
+			in += chunk;
+			count -= chunk;
+		}
+	}
+
+	/// Compute the Adler-32 checksum of some bytes										
+	/// Can be chained, by passing the checksum of the preceding bytes			
+	///	@param bytes - the bytes to checksum											
+	///	@param adler - the checksum of any preceding bytes							
+	///	@return the checksum																	
+	template<CT::Span IN>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint32_t Adler32(IN&& bytes, ::std::uint32_t adler = 1) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		::std::uint32_t s1 = adler & 0xFFFF;
+		::std::uint32_t s2 = adler >> 16;
+		InnerChecksum<65521, 5552>(
+			reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes)),
+			::std::ranges::size(bytes), s1, s2);
+		return (s2 << 16) | s1;
+	}
+
+	/// Compute the Fletcher-16 checksum of some bytes									
+	/// Can be chained, by passing the checksum of the preceding bytes			
+	///	@param bytes - the bytes to checksum											
+	///	@param fletcher - the checksum of any preceding bytes						
+	///	@return the checksum																	
+	template<CT::Span IN>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint16_t Fletcher16(IN&& bytes, ::std::uint16_t fletcher = 0) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		::std::uint32_t s1 = fletcher & 0xFF;
+		::std::uint32_t s2 = fletcher >> 8;
+		InnerChecksum<255, 5802>(
+			reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes)),
+			::std::ranges::size(bytes), s1, s2);
+		return static_cast<::std::uint16_t>((s2 << 8) | s1);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,651 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Pixel.hpp"
+#include "Pow.hpp"
+#include <array>
+#include <cstring>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Which standard to use for converting between RGB and YCbCr					
+	/// Both are limited (video) range - Y in [16, 235], Cb and Cr in [16, 240]
+	enum class ColorMatrix {
+		BT601,
+		BT709
+	};
+
+	/// Coefficients for converting between RGB and YCbCr								
+	/// Decoding is in Q12, and done with _mm_madd_epi16 on 16-bit integers		
+	/// Encoding is in Q7, so that coefficients fit in signed bytes for			
+	/// _mm_maddubs_epi16, which multiplies them with the unsigned channels		
+	struct ColorCoefficients {
+		int mY, mRV, mGU, mGV, mBU;
+		int mYR, mYG, mYB;
+		int mUR, mUG, mUB;
+		int mVR, mVG, mVB;
+	};
+
+	template<ColorMatrix M>
+	constexpr ColorCoefficients ColorMatrixCoefficients = M == ColorMatrix::BT601
+		? ColorCoefficients {4769, 6537, -1605, -3330, 8263, 33, 64, 13, -19, -37, 56, 56, -47, -9}
+		: ColorCoefficients {4769, 7343, -873, -2183, 8652, 23, 79, 8, -13, -43, 56, 56, -51, -5};
+
+	/// Pack two 16-bit coefficients in a 32-bit integer, for _mm_madd_epi16	
+	NOD() constexpr int PackCoefficients(int lo, int hi) noexcept {
+		return static_cast<int>((static_cast<::std::uint32_t>(hi) << 16) | static_cast<::std::uint16_t>(lo));
+	}
+
+	/// Pack four 8-bit coefficients in a 32-bit integer, for _mm_maddubs_epi16
+	NOD() constexpr int PackCoefficients(int r, int g, int b) noexcept {
+		return static_cast<int>(static_cast<::std::uint8_t>(r)
+			| (static_cast<::std::uint32_t>(static_cast<::std::uint8_t>(g)) << 8)
+			| (static_cast<::std::uint32_t>(static_cast<::std::uint8_t>(b)) << 16));
+	}
+
+	/// Convert a YCbCr sample to an opaque RGBA pixel, the old way				
+	///	@tparam M - the color matrix														
+	///	@param y, u, v - the luma and chroma samples									
+	///	@return the pixel																		
+	template<ColorMatrix M>
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel YUVToRGBAFallback(int y, int u, int v) noexcept {
+		constexpr auto& C = ColorMatrixCoefficients<M>;
+		const auto clamp = [](int x) noexcept -> Pixel {
+			return static_cast<Pixel>(x < 0 ? 0 : x > 255 ? 255 : x);
+		};
+
+		const int base = (y - 16) * C.mY + 2048;
+		u -= 128;
+		v -= 128;
+		return clamp((base + v * C.mRV) >> 12)
+			| (clamp((base + u * C.mGU + v * C.mGV) >> 12) << 8)
+			| (clamp((base + u * C.mBU) >> 12) << 16)
+			| 0xFF000000u;
+	}
+
+	/// Convert YCbCr to opaque RGBA pixels												
+	/// Chroma is upsampled by repeating each sample for two pixels				
+	///	@tparam M - the color matrix														
+	///	@tparam R - simde__m128i for eight pixels, simde__m256i for sixteen	
+	///	@param y - the luma samples, one byte per pixel								
+	///	@param uv - the interleaved chroma samples, two bytes per two pixels	
+	///	@param out - [out] where to store the pixels									
+	template<ColorMatrix M, CT::TSIMD R>
+	LANGULUS(ALWAYSINLINE) void InnerYUVToRGBA(const simde__m128i& y, const simde__m128i& uv, Pixel* out) noexcept {
+		constexpr auto& C = ColorMatrixCoefficients<M>;
+
+		if constexpr (CT::Same<R, simde__m128i>) {
+			// Zero-extend each chroma sample twice, then center them		
+			const auto y16 = simde_mm_sub_epi16(simde_mm_cvtepu8_epi16(y), simde_mm_set1_epi16(16));
+			const auto u16 = simde_mm_sub_epi16(simde_mm_shuffle_epi8(uv, simde_mm_setr_epi8(
+				0, -1, 0, -1, 2, -1, 2, -1, 4, -1, 4, -1, 6, -1, 6, -1)), simde_mm_set1_epi16(128));
+			const auto v16 = simde_mm_sub_epi16(simde_mm_shuffle_epi8(uv, simde_mm_setr_epi8(
+				1, -1, 1, -1, 3, -1, 3, -1, 5, -1, 5, -1, 7, -1, 7, -1)), simde_mm_set1_epi16(128));
+
+			// Luma is paired with one, so that rounding comes for free		
+			const auto one = simde_mm_set1_epi16(1);
+			const auto cy = simde_mm_set1_epi32(PackCoefficients(C.mY, 2048));
+			const auto cr = simde_mm_set1_epi32(PackCoefficients(0, C.mRV));
+			const auto cg = simde_mm_set1_epi32(PackCoefficients(C.mGU, C.mGV));
+			const auto cb = simde_mm_set1_epi32(PackCoefficients(C.mBU, 0));
+			const auto ylo = simde_mm_madd_epi16(simde_mm_unpacklo_epi16(y16, one), cy);
+			const auto yhi = simde_mm_madd_epi16(simde_mm_unpackhi_epi16(y16, one), cy);
+			const auto uvlo = simde_mm_unpacklo_epi16(u16, v16);
+			const auto uvhi = simde_mm_unpackhi_epi16(u16, v16);
+
+			const auto r = simde_mm_packs_epi32(
+				simde_mm_srai_epi32(simde_mm_add_epi32(ylo, simde_mm_madd_epi16(uvlo, cr)), 12),
+				simde_mm_srai_epi32(simde_mm_add_epi32(yhi, simde_mm_madd_epi16(uvhi, cr)), 12));
+			const auto g = simde_mm_packs_epi32(
+				simde_mm_srai_epi32(simde_mm_add_epi32(ylo, simde_mm_madd_epi16(uvlo, cg)), 12),
+				simde_mm_srai_epi32(simde_mm_add_epi32(yhi, simde_mm_madd_epi16(uvhi, cg)), 12));
+			const auto b = simde_mm_packs_epi32(
+				simde_mm_srai_epi32(simde_mm_add_epi32(ylo, simde_mm_madd_epi16(uvlo, cb)), 12),
+				simde_mm_srai_epi32(simde_mm_add_epi32(yhi, simde_mm_madd_epi16(uvhi, cb)), 12));
+
+			// Saturate to bytes, and interleave into pixels					
+			const auto rb = simde_mm_packus_epi16(r, b);
+			const auto ga = simde_mm_packus_epi16(g, simde_mm_set1_epi16(255));
+			const auto rg = simde_mm_unpacklo_epi8(rb, ga);
+			const auto ba = simde_mm_unpackhi_epi8(rb, ga);
+			simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out), simde_mm_unpacklo_epi16(rg, ba));
+			simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + 4), simde_mm_unpackhi_epi16(rg, ba));
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			// Each 128-bit lane gets its own half of the chroma samples	
+			const auto uv2 = simde_mm256_broadcastsi128_si256(uv);
+			const auto y16 = simde_mm256_sub_epi16(simde_mm256_cvtepu8_epi16(y), simde_mm256_set1_epi16(16));
+			const auto u16 = simde_mm256_sub_epi16(simde_mm256_shuffle_epi8(uv2, simde_mm256_setr_epi8(
+				0, -1, 0, -1, 2, -1, 2, -1, 4, -1, 4, -1, 6, -1, 6, -1,
+				8, -1, 8, -1, 10, -1, 10, -1, 12, -1, 12, -1, 14, -1, 14, -1)), simde_mm256_set1_epi16(128));
+			const auto v16 = simde_mm256_sub_epi16(simde_mm256_shuffle_epi8(uv2, simde_mm256_setr_epi8(
+				1, -1, 1, -1, 3, -1, 3, -1, 5, -1, 5, -1, 7, -1, 7, -1,
+				9, -1, 9, -1, 11, -1, 11, -1, 13, -1, 13, -1, 15, -1, 15, -1)), simde_mm256_set1_epi16(128));
+
+			const auto one = simde_mm256_set1_epi16(1);
+			const auto cy = simde_mm256_set1_epi32(PackCoefficients(C.mY, 2048));
+			const auto cr = simde_mm256_set1_epi32(PackCoefficients(0, C.mRV));
+			const auto cg = simde_mm256_set1_epi32(PackCoefficients(C.mGU, C.mGV));
+			const auto cb = simde_mm256_set1_epi32(PackCoefficients(C.mBU, 0));
+			const auto ylo = simde_mm256_madd_epi16(simde_mm256_unpacklo_epi16(y16, one), cy);
+			const auto yhi = simde_mm256_madd_epi16(simde_mm256_unpackhi_epi16(y16, one), cy);
+			const auto uvlo = simde_mm256_unpacklo_epi16(u16, v16);
+			const auto uvhi = simde_mm256_unpackhi_epi16(u16, v16);
+
+			// Unpacking and packing are both per 128-bit lane, so the		
+			// samples are in order again after packing							
+			const auto r = simde_mm256_packs_epi32(
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(ylo, simde_mm256_madd_epi16(uvlo, cr)), 12),
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(yhi, simde_mm256_madd_epi16(uvhi, cr)), 12));
+			const auto g = simde_mm256_packs_epi32(
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(ylo, simde_mm256_madd_epi16(uvlo, cg)), 12),
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(yhi, simde_mm256_madd_epi16(uvhi, cg)), 12));
+			const auto b = simde_mm256_packs_epi32(
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(ylo, simde_mm256_madd_epi16(uvlo, cb)), 12),
+				simde_mm256_srai_epi32(simde_mm256_add_epi32(yhi, simde_mm256_madd_epi16(uvhi, cb)), 12));
+
+			// Lane k ends up with pixels 8k..8k+3 and 8k+4..8k+7				
+			const auto rb = simde_mm256_packus_epi16(r, b);
+			const auto ga = simde_mm256_packus_epi16(g, simde_mm256_set1_epi16(255));
+			const auto rg = simde_mm256_unpacklo_epi8(rb, ga);
+			const auto ba = simde_mm256_unpackhi_epi8(rb, ga);
+			const auto lo = simde_mm256_unpacklo_epi16(rg, ba);
+			const auto hi = simde_mm256_unpackhi_epi16(rg, ba);
+			simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out), simde_mm256_permute2x128_si256(lo, hi, 0x20));
+			simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + 8), simde_mm256_permute2x128_si256(lo, hi, 0x31));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerYUVToRGBA");
+	}
+
+	/// Convert a row of YCbCr samples to opaque RGBA pixels							
+	///	@tparam M - the color matrix														
+	///	@tparam CHROMA - gets the interleaved chroma for a pixel, as a			
+	///		register with two bytes per two pixels, for eight or sixteen pixels
+	///	@param y - the luma samples														
+	///	@param u - the Cb samples, at half the horizontal resolution			
+	///	@param v - the Cr samples, at half the horizontal resolution			
+	///	@param uvStep - distance between chroma samples (2 for NV12)			
+	///	@param width - number of pixels in the row									
+	///	@param out - [out] the pixels														
+	template<ColorMatrix M>
+	LANGULUS(ALWAYSINLINE) void InnerYUVRowToRGBA(
+		const ::std::uint8_t* y, const ::std::uint8_t* u, const ::std::uint8_t* v,
+		Count uvStep, Count width, Pixel* out
+	) noexcept {
+		// Interleave planar chroma, so that it looks like NV12				
+		const auto chroma = [&](Count x, Count pixels) noexcept {
+			if (uvStep == 2) {
+				return pixels == 16
+					? simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(u + x))
+					: simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(u + x));
+			}
+			else if (pixels == 16) {
+				return simde_mm_unpacklo_epi8(
+					simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(u + x / 2)),
+					simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(v + x / 2)));
+			}
+			else {
+				::std::int32_t u4, v4;
+				::std::memcpy(&u4, u + x / 2, 4);
+				::std::memcpy(&v4, v + x / 2, 4);
+				return simde_mm_unpacklo_epi8(simde_mm_cvtsi32_si128(u4), simde_mm_cvtsi32_si128(v4));
+			}
+		};
+
+		Count x = 0;
+
+		#if LANGULUS_SIMD(256BIT)
+			for (; x + 16 <= width; x += 16) {
+				InnerYUVToRGBA<M, simde__m256i>(
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(y + x)),
+					chroma(x, 16), out + x);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			for (; x + 8 <= width; x += 8) {
+				InnerYUVToRGBA<M, simde__m128i>(
+					simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(y + x)),
+					chroma(x, 8), out + x);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; x < width; ++x) {
+			const Count c = (x / 2) * uvStep;
+			out[x] = YUVToRGBAFallback<M>(y[x], u[c], v[c]);
+		}
+	}
+
+	/// Convert an NV12 frame to opaque RGBA pixels										
+	/// NV12 has a luma plane, followed by a plane of interleaved Cb and Cr,	
+	/// at half the horizontal and vertical resolution									
+	/// Conversion stops at the last row that fits in all planes					
+	///	@tparam M - the color matrix														
+	///	@param luma - the luma plane, width * height bytes							
+	///	@param chroma - the chroma plane, (width + 1) / 2 * 2 bytes per row	
+	///	@param width - width of the frame, in pixels									
+	///	@param height - height of the frame, in pixels								
+	///	@param output - [out] the pixels, width * height of them					
+	///	@return the number of rows converted											
+	template<ColorMatrix M = ColorMatrix::BT601, CT::Span Y, CT::Span UV, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) Count NV12ToRGBA(Y&& luma, UV&& chroma, Count width, Count height, OUT&& output) noexcept {
+		static_assert(sizeof(SpanType<Y>) == 1 && sizeof(SpanType<UV>) == 1, "Planes must be spans of bytes");
+		static_assert(CT::Same<SpanType<OUT>, Pixel>, "Pixels must be RGBA8, packed in std::uint32_t");
+		if (!width)
+			return 0;
+
+		const Count stride = (width + 1) / 2 * 2;
+		Count rows = height;
+		rows = ::std::min(rows, ::std::ranges::size(luma) / width);
+		rows = ::std::min(rows, ::std::ranges::size(output) / width);
+		rows = ::std::min(rows, ::std::ranges::size(chroma) / stride * 2);
+
+		auto y = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(luma));
+		auto uv = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(chroma));
+		auto out = ::std::ranges::data(output);
+		for (Count row = 0; row < rows; ++row) {
+			const auto c = uv + (row / 2) * stride;
+			InnerYUVRowToRGBA<M>(y + row * width, c, c + 1, 2, width, out + row * width);
+		}
+		return rows;
+	}
+
+	/// Convert an I420 frame to opaque RGBA pixels										
+	/// I420 has a luma plane, followed by a Cb and a Cr plane, both at half	
+	/// the horizontal and vertical resolution											
+	/// Conversion stops at the last row that fits in all planes					
+	///	@tparam M - the color matrix														
+	///	@param luma - the luma plane, width * height bytes							
+	///	@param cb - the Cb plane, (width + 1) / 2 bytes per row					
+	///	@param cr - the Cr plane, (width + 1) / 2 bytes per row					
+	///	@param width - width of the frame, in pixels									
+	///	@param height - height of the frame, in pixels								
+	///	@param output - [out] the pixels, width * height of them					
+	///	@return the number of rows converted											
+	template<ColorMatrix M = ColorMatrix::BT601, CT::Span Y, CT::Span U, CT::Span V, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) Count I420ToRGBA(Y&& luma, U&& cb, V&& cr, Count width, Count height, OUT&& output) noexcept {
+		static_assert(sizeof(SpanType<Y>) == 1 && sizeof(SpanType<U>) == 1 && sizeof(SpanType<V>) == 1,
+			"Planes must be spans of bytes");
+		static_assert(CT::Same<SpanType<OUT>, Pixel>, "Pixels must be RGBA8, packed in std::uint32_t");
+		if (!width)
+			return 0;
+
+		const Count stride = (width + 1) / 2;
+		Count rows = height;
+		rows = ::std::min(rows, ::std::ranges::size(luma) / width);
+		rows = ::std::min(rows, ::std::ranges::size(output) / width);
+		rows = ::std::min(rows, ::std::ranges::size(cb) / stride * 2);
+		rows = ::std::min(rows, ::std::ranges::size(cr) / stride * 2);
+
+		auto y = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(luma));
+		auto u = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(cb));
+		auto v = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(cr));
+		auto out = ::std::ranges::data(output);
+		for (Count row = 0; row < rows; ++row) {
+			const Count c = (row / 2) * stride;
+			InnerYUVRowToRGBA<M>(y + row * width, u + c, v + c, 1, width, out + row * width);
+		}
+		return rows;
+	}
+
+	/// Average two pixels, channel by channel, rounding up like _mm_avg_epu8	
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel AveragePixelsFallback(Pixel a, Pixel b) noexcept {
+		Pixel result = 0;
+		for (int c = 0; c < 4; ++c)
+			result |= ((PixelChannel(a, c) + PixelChannel(b, c) + 1) >> 1) << (c * 8);
+		return result;
+	}
+
+	/// Apply Q7 encoding coefficients to a pixel, the old way						
+	///	@param px - the pixel																
+	///	@param r, g, b - the coefficients												
+	///	@param offset - the value to add, in Q7, including rounding				
+	///	@return the encoded sample															
+	NOD() LANGULUS(ALWAYSINLINE) constexpr ::std::uint8_t EncodeSampleFallback(Pixel px, int r, int g, int b, int offset) noexcept {
+		const int x = (static_cast<int>(PixelChannel(px, 0)) * r
+			+ static_cast<int>(PixelChannel(px, 1)) * g
+			+ static_cast<int>(PixelChannel(px, 2)) * b + offset) >> 7;
+		return static_cast<::std::uint8_t>(x < 0 ? 0 : x > 255 ? 255 : x);
+	}
+
+	/// Apply Q7 encoding coefficients to four pixels									
+	///	@param px - the pixels																
+	///	@param coefficients - the packed coefficients, see PackCoefficients	
+	///	@param offset - the value to add, in Q7, including rounding				
+	///	@return the four encoded samples, as 32-bit integers						
+	LANGULUS(ALWAYSINLINE) simde__m128i InnerEncodeSamples(const simde__m128i& px, int coefficients, int offset) noexcept {
+		// Red and green go in one 16-bit sum, blue in the other				
+		const auto pairs = simde_mm_maddubs_epi16(px, simde_mm_set1_epi32(coefficients));
+		const auto sums = simde_mm_madd_epi16(pairs, simde_mm_set1_epi16(1));
+		return simde_mm_srai_epi32(simde_mm_add_epi32(sums, simde_mm_set1_epi32(offset)), 7);
+	}
+
+	/// Convert two rows of RGBA pixels to YCbCr											
+	/// Chroma is the average of each 2x2 block - the rows are averaged first,	
+	/// and then the columns, rounding up both times									
+	///	@tparam M - the color matrix														
+	///	@param top - the top row of pixels												
+	///	@param bottom - the bottom row of pixels (can be the same as top)		
+	///	@param width - number of pixels in each row									
+	///	@param yTop - [out] the luma of the top row									
+	///	@param yBottom - [out] the luma of the bottom row, or nullptr			
+	///	@param u - [out] the Cb samples													
+	///	@param v - [out] the Cr samples													
+	///	@param uvStep - distance between chroma samples (2 for NV12)			
+	template<ColorMatrix M>
+	LANGULUS(ALWAYSINLINE) void InnerRGBARowsToYUV(
+		const Pixel* top, const Pixel* bottom, Count width,
+		::std::uint8_t* yTop, ::std::uint8_t* yBottom,
+		::std::uint8_t* u, ::std::uint8_t* v, Count uvStep
+	) noexcept {
+		constexpr auto& C = ColorMatrixCoefficients<M>;
+		constexpr int CY = PackCoefficients(C.mYR, C.mYG, C.mYB);
+		constexpr int CU = PackCoefficients(C.mUR, C.mUG, C.mUB);
+		constexpr int CV = PackCoefficients(C.mVR, C.mVG, C.mVB);
+		constexpr int LUMA = (16 << 7) + 64;
+		constexpr int CHROMA = (128 << 7) + 64;
+		Count x = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			// Eight pixels wide, two rows tall, at a time						
+			const auto luma = [](const simde__m128i& lo, const simde__m128i& hi) noexcept {
+				const auto y = simde_mm_packs_epi32(InnerEncodeSamples(lo, CY, LUMA), InnerEncodeSamples(hi, CY, LUMA));
+				return simde_mm_packus_epi16(y, y);
+			};
+
+			for (; x + 8 <= width; x += 8) {
+				const auto t0 = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(top + x));
+				const auto t1 = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(top + x + 4));
+				const auto b0 = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(bottom + x));
+				const auto b1 = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(bottom + x + 4));
+				simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(yTop + x), luma(t0, t1));
+				if (yBottom)
+					simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(yBottom + x), luma(b0, b1));
+
+				// Average rows, then neighbouring pixels, and keep the even
+				const auto m0 = simde_mm_avg_epu8(t0, b0);
+				const auto m1 = simde_mm_avg_epu8(t1, b1);
+				const auto c0 = simde_mm_avg_epu8(m0, simde_mm_srli_epi64(m0, 32));
+				const auto c1 = simde_mm_avg_epu8(m1, simde_mm_srli_epi64(m1, 32));
+				const auto c = simde_mm_castps_si128(simde_mm_shuffle_ps(
+					simde_mm_castsi128_ps(c0), simde_mm_castsi128_ps(c1), _MM_SHUFFLE(2, 0, 2, 0)));
+
+				// Cb in the first four bytes, Cr in the next four				
+				const auto uv = simde_mm_packs_epi32(InnerEncodeSamples(c, CU, CHROMA), InnerEncodeSamples(c, CV, CHROMA));
+				const auto bytes = simde_mm_packus_epi16(uv, uv);
+				if (uvStep == 2) {
+					simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(u + x),
+						simde_mm_unpacklo_epi8(bytes, simde_mm_srli_si128(bytes, 4)));
+				}
+				else {
+					const ::std::int32_t u4 = simde_mm_cvtsi128_si32(bytes);
+					const ::std::int32_t v4 = simde_mm_cvtsi128_si32(simde_mm_srli_si128(bytes, 4));
+					::std::memcpy(u + x / 2, &u4, 4);
+					::std::memcpy(v + x / 2, &v4, 4);
+				}
+			}
+		#endif
+
+		// Do the rest the old way, repeating the last column if odd		
+		for (; x < width; x += 2) {
+			const Count x1 = x + 1 < width ? x + 1 : x;
+			yTop[x] = EncodeSampleFallback(top[x], C.mYR, C.mYG, C.mYB, LUMA);
+			if (x1 != x)
+				yTop[x1] = EncodeSampleFallback(top[x1], C.mYR, C.mYG, C.mYB, LUMA);
+			if (yBottom) {
+				yBottom[x] = EncodeSampleFallback(bottom[x], C.mYR, C.mYG, C.mYB, LUMA);
+				if (x1 != x)
+					yBottom[x1] = EncodeSampleFallback(bottom[x1], C.mYR, C.mYG, C.mYB, LUMA);
+			}
+
+			const auto c = AveragePixelsFallback(
+				AveragePixelsFallback(top[x], bottom[x]),
+				AveragePixelsFallback(top[x1], bottom[x1]));
+			u[(x / 2) * uvStep] = EncodeSampleFallback(c, C.mUR, C.mUG, C.mUB, CHROMA);
+			v[(x / 2) * uvStep] = EncodeSampleFallback(c, C.mVR, C.mVG, C.mVB, CHROMA);
+		}
+	}
+
+	/// Convert RGBA pixels to an NV12 frame, ignoring alpha							
+	/// Conversion stops at the last row that fits in all planes					
+	///	@tparam M - the color matrix														
+	///	@param input - the pixels, width * height of them							
+	///	@param width - width of the frame, in pixels									
+	///	@param height - height of the frame, in pixels								
+	///	@param luma - [out] the luma plane, width * height bytes					
+	///	@param chroma - [out] the chroma plane, (width + 1) / 2 * 2 bytes per row
+	///	@return the number of rows converted											
+	template<ColorMatrix M = ColorMatrix::BT601, CT::Span IN, CT::Span Y, CT::Span UV>
+	LANGULUS(ALWAYSINLINE) Count RGBAToNV12(IN&& input, Count width, Count height, Y&& luma, UV&& chroma) noexcept {
+		static_assert(CT::Same<SpanType<IN>, Pixel>, "Pixels must be RGBA8, packed in std::uint32_t");
+		static_assert(sizeof(SpanType<Y>) == 1 && sizeof(SpanType<UV>) == 1, "Planes must be spans of bytes");
+		if (!width)
+			return 0;
+
+		const Count stride = (width + 1) / 2 * 2;
+		Count rows = height;
+		rows = ::std::min(rows, ::std::ranges::size(input) / width);
+		rows = ::std::min(rows, ::std::ranges::size(luma) / width);
+		rows = ::std::min(rows, ::std::ranges::size(chroma) / stride * 2);
+
+		auto in = ::std::ranges::data(input);
+		auto y = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(luma));
+		auto uv = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(chroma));
+		for (Count row = 0; row < rows; row += 2) {
+			const bool pair = row + 1 < rows;
+			const auto c = uv + (row / 2) * stride;
+			InnerRGBARowsToYUV<M>(
+				in + row * width, in + (pair ? row + 1 : row) * width, width,
+				y + row * width, pair ? y + (row + 1) * width : nullptr,
+				c, c + 1, 2);
+		}
+		return rows;
+	}
+
+	/// Convert RGBA pixels to an I420 frame, ignoring alpha							
+	/// Conversion stops at the last row that fits in all planes					
+	///	@tparam M - the color matrix														
+	///	@param input - the pixels, width * height of them							
+	///	@param width - width of the frame, in pixels									
+	///	@param height - height of the frame, in pixels								
+	///	@param luma - [out] the luma plane, width * height bytes					
+	///	@param cb - [out] the Cb plane, (width + 1) / 2 bytes per row			
+	///	@param cr - [out] the Cr plane, (width + 1) / 2 bytes per row			
+	///	@return the number of rows converted											
+	template<ColorMatrix M = ColorMatrix::BT601, CT::Span IN, CT::Span Y, CT::Span U, CT::Span V>
+	LANGULUS(ALWAYSINLINE) Count RGBAToI420(IN&& input, Count width, Count height, Y&& luma, U&& cb, V&& cr) noexcept {
+		static_assert(CT::Same<SpanType<IN>, Pixel>, "Pixels must be RGBA8, packed in std::uint32_t");
+		static_assert(sizeof(SpanType<Y>) == 1 && sizeof(SpanType<U>) == 1 && sizeof(SpanType<V>) == 1,
+			"Planes must be spans of bytes");
+		if (!width)
+			return 0;
+
+		const Count stride = (width + 1) / 2;
+		Count rows = height;
+		rows = ::std::min(rows, ::std::ranges::size(input) / width);
+		rows = ::std::min(rows, ::std::ranges::size(luma) / width);
+		rows = ::std::min(rows, ::std::ranges::size(cb) / stride * 2);
+		rows = ::std::min(rows, ::std::ranges::size(cr) / stride * 2);
+
+		auto in = ::std::ranges::data(input);
+		auto y = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(luma));
+		auto u = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(cb));
+		auto v = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(cr));
+		for (Count row = 0; row < rows; row += 2) {
+			const bool pair = row + 1 < rows;
+			const Count c = (row / 2) * stride;
+			InnerRGBARowsToYUV<M>(
+				in + row * width, in + (pair ? row + 1 : row) * width, width,
+				y + row * width, pair ? y + (row + 1) * width : nullptr,
+				u + c, v + c, 1);
+		}
+		return rows;
+	}
+
+	/// Decode an sRGB encoded number to linear light, the old way					
+	template<CT::Real T>
+	NOD() LANGULUS(ALWAYSINLINE) T SRGBToLinearFallback(T c) noexcept {
+		return c <= T(0.04045) ? c / T(12.92) : ::std::pow((c + T(0.055)) / T(1.055), T(2.4));
+	}
+
+	/// Encode a number in linear light as sRGB, the old way							
+	template<CT::Real T>
+	NOD() LANGULUS(ALWAYSINLINE) T LinearToSRGBFallback(T l) noexcept {
+		return l <= T(0.0031308) ? l * T(12.92) : T(1.055) * ::std::pow(l, T(1) / T(2.4)) - T(0.055);
+	}
+
+	/// Linear light for each 8-bit sRGB value, computed in double precision	
+	inline const ::std::array<float, 256> SRGBToLinearTable = [] {
+		::std::array<float, 256> table;
+		for (int i = 0; i < 256; ++i)
+			table[i] = static_cast<float>(SRGBToLinearFallback(i / 255.0));
+		return table;
+	}();
+
+	/// Decode sRGB encoded single precision numbers to linear light				
+	///	@param v - the sRGB numbers														
+	///	@return the linear numbers															
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerSRGBToLinear(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128>) {
+			const auto lin = simde_mm_div_ps(v, simde_mm_set1_ps(12.92f));
+			const auto base = simde_mm_div_ps(simde_mm_add_ps(v, simde_mm_set1_ps(0.055f)), simde_mm_set1_ps(1.055f));
+			const auto curve = PowerInner<float, 4>(base, simde_mm_set1_ps(2.4f));
+			return simde_mm_blendv_ps(lin, curve, simde_mm_cmpgt_ps(v, simde_mm_set1_ps(0.04045f)));
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			const auto lin = simde_mm256_div_ps(v, simde_mm256_set1_ps(12.92f));
+			const auto base = simde_mm256_div_ps(simde_mm256_add_ps(v, simde_mm256_set1_ps(0.055f)), simde_mm256_set1_ps(1.055f));
+			const auto curve = PowerInner<float, 8>(base, simde_mm256_set1_ps(2.4f));
+			return simde_mm256_blendv_ps(lin, curve, simde_mm256_cmp_ps(v, simde_mm256_set1_ps(0.04045f), _CMP_GT_OQ));
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			const auto lin = simde_mm512_div_ps(v, simde_mm512_set1_ps(12.92f));
+			const auto base = simde_mm512_div_ps(simde_mm512_add_ps(v, simde_mm512_set1_ps(0.055f)), simde_mm512_set1_ps(1.055f));
+			const auto curve = PowerInner<float, 16>(base, simde_mm512_set1_ps(2.4f));
+			return simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(v, simde_mm512_set1_ps(0.04045f), _CMP_GT_OQ), lin, curve);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerSRGBToLinear");
+	}
+
+	/// Encode single precision numbers in linear light as sRGB						
+	///	@param v - the linear numbers														
+	///	@return the sRGB numbers															
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerLinearToSRGB(const R& v) noexcept {
+		constexpr float GAMMA = 1.0f / 2.4f;
+		if constexpr (CT::Same<R, simde__m128>) {
+			const auto lin = simde_mm_mul_ps(v, simde_mm_set1_ps(12.92f));
+			const auto curve = simde_mm_sub_ps(simde_mm_mul_ps(simde_mm_set1_ps(1.055f),
+				PowerInner<float, 4>(v, simde_mm_set1_ps(GAMMA))), simde_mm_set1_ps(0.055f));
+			return simde_mm_blendv_ps(lin, curve, simde_mm_cmpgt_ps(v, simde_mm_set1_ps(0.0031308f)));
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			const auto lin = simde_mm256_mul_ps(v, simde_mm256_set1_ps(12.92f));
+			const auto curve = simde_mm256_sub_ps(simde_mm256_mul_ps(simde_mm256_set1_ps(1.055f),
+				PowerInner<float, 8>(v, simde_mm256_set1_ps(GAMMA))), simde_mm256_set1_ps(0.055f));
+			return simde_mm256_blendv_ps(lin, curve, simde_mm256_cmp_ps(v, simde_mm256_set1_ps(0.0031308f), _CMP_GT_OQ));
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			const auto lin = simde_mm512_mul_ps(v, simde_mm512_set1_ps(12.92f));
+			const auto curve = simde_mm512_sub_ps(simde_mm512_mul_ps(simde_mm512_set1_ps(1.055f),
+				PowerInner<float, 16>(v, simde_mm512_set1_ps(GAMMA))), simde_mm512_set1_ps(0.055f));
+			return simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(v, simde_mm512_set1_ps(0.0031308f), _CMP_GT_OQ), lin, curve);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerLinearToSRGB");
+	}
+
+	/// Decode sRGB to linear light															
+	/// Bytes are looked up in SRGBToLinearTable, gathering with AVX2 and up	
+	/// Floats are in [0, 1] and go through the curve, via SIMD::Power			
+	///	@param input - the sRGB bytes or floats										
+	///	@param output - [out] the linear floats										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void SRGBToLinearSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<SpanType<OUT>, float>, "Output must be a span of floats");
+
+		if constexpr (sizeof(T) == 1) {
+			const Count count = OverlapCount(input, output);
+			auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(input));
+			auto out = ::std::ranges::data(output);
+			const float* table = SRGBToLinearTable.data();
+			Count i = 0;
+
+			#if LANGULUS_SIMD(512BIT)
+				for (; i + 16 <= count; i += 16) {
+					const auto index = simde_mm512_cvtepu8_epi32(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i)));
+					simde_mm512_storeu_ps(out + i, simde_mm512_i32gather_ps(index, table, 4));
+				}
+			#endif
+
+			#if LANGULUS_SIMD(256BIT)
+				for (; i + 8 <= count; i += 8) {
+					const auto index = simde_mm256_cvtepu8_epi32(simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(in + i)));
+					simde_mm256_storeu_ps(out + i, simde_mm256_i32gather_ps(table, index, 4));
+				}
+			#endif
+
+			// Do the rest the old way													
+			for (; i < count; ++i)
+				out[i] = table[in[i]];
+		}
+		else {
+			static_assert(CT::RealSP<T>, "Input must be a span of bytes or floats");
+			StreamUnary<0>(
+				::std::ranges::data(input), ::std::ranges::data(output),
+				OverlapCount(input, output),
+				[](const MaxRegister<float>& v) noexcept {
+					return InnerSRGBToLinear(v);
+				},
+				[](const float& v) noexcept -> float {
+					return SRGBToLinearFallback(v);
+				}
+			);
+		}
+	}
+
+	/// Decode sRGB floats to linear light in place										
+	///	@param data - [in/out] the floats												
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void SRGBToLinearSpan(DATA&& data) noexcept {
+		SRGBToLinearSpan(data, data);
+	}
+
+	/// Encode linear light floats as sRGB, via SIMD::Power							
+	///	@param input - the linear floats													
+	///	@param output - [out] the sRGB floats											
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void LinearToSRGBSpan(IN&& input, OUT&& output) noexcept {
+		static_assert(CT::Same<SpanType<IN>, float> && CT::Same<SpanType<OUT>, float>,
+			"Input and output must be spans of floats");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<float>& v) noexcept {
+				return InnerLinearToSRGB(v);
+			},
+			[](const float& v) noexcept -> float {
+				return LinearToSRGBFallback(v);
+			}
+		);
+	}
+
+	/// Encode linear light floats as sRGB in place										
+	///	@param data - [in/out] the floats												
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void LinearToSRGBSpan(DATA&& data) noexcept {
+		LinearToSRGBSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,310 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include <array>
+#include <bit>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Number of SIZE-byte elements handled by a single compress/expand step	
+	/// Byte elements are done eight at a time, to keep the lookup table small	
+	template<Size SIZE>
+	constexpr Count CompressLanes = 16 / SIZE < 8 ? 16 / SIZE : 8;
+
+	/// Byte shuffle lookup tables for compressing and expanding					
+	/// Entry [bits] of the compress table moves the selected elements to the	
+	/// front of the register, while the expand table moves the front of the	
+	/// register into the selected elements. Unused bytes are 0x80, which		
+	/// makes pshufb zero them																	
+	///	@tparam SIZE - size of a single element, in bytes							
+	///	@tparam EXPAND - true to build the expand table								
+	template<Size SIZE, bool EXPAND>
+	constexpr auto CompressTable = []() {
+		constexpr Count K = CompressLanes<SIZE>;
+		::std::array<::std::array<::std::int8_t, 16>, (1 << K)> table {};
+		for (Count bits = 0; bits < (1 << K); ++bits) {
+			for (auto& b : table[bits])
+				b = -128;
+
+			Count packed = 0;
+			for (Count lane = 0; lane < K; ++lane) {
+				if (!(bits & (1 << lane)))
+					continue;
+
+				for (Count b = 0; b < SIZE; ++b) {
+					if constexpr (EXPAND)
+						table[bits][lane * SIZE + b] = static_cast<::std::int8_t>(packed * SIZE + b);
+					else
+						table[bits][packed * SIZE + b] = static_cast<::std::int8_t>(lane * SIZE + b);
+				}
+				++packed;
+			}
+		}
+		return table;
+	}();
+
+	/// Convert K booleans to a bitmask, one bit per boolean							
+	///	@tparam K - number of booleans													
+	///	@param mask - the first boolean													
+	///	@return the bitmask																	
+	template<Count K>
+	NOD() LANGULUS(ALWAYSINLINE) unsigned InnerCompressBits(const bool* mask) noexcept {
+		::std::int64_t bytes = 0;
+		::std::memcpy(&bytes, mask, K);
+		const auto zero = simde_mm_cmpeq_epi8(simde_mm_cvtsi64_si128(bytes), simde_mm_setzero_si128());
+		return ~static_cast<unsigned>(simde_mm_movemask_epi8(zero)) & ((1u << K) - 1);
+	}
+
+	/// Copy the elements, whose mask is true, to the front of the output		
+	/// This is the stream compaction primitive, for culling, filtering, etc.	
+	///	@param values - the elements														
+	///	@param mask - a boolean for each element										
+	///	@param output - [out] the selected elements, tightly packed				
+	///	@return the number of elements written to output							
+	template<CT::Span IN, CT::Span MASK, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count Compress(IN&& values, MASK&& mask, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(CT::Same<bool, SpanType<MASK>>, "Mask must be a span of booleans");
+		static_assert(sizeof(T) <= 8 && 16 % sizeof(T) == 0, "Unsupported element size");
+
+		const Count count = OverlapCount(values, mask);
+		const Count capacity = ::std::ranges::size(output);
+		const T* in = ::std::ranges::data(values);
+		const bool* m = ::std::ranges::data(mask);
+		T* out = ::std::ranges::data(output);
+		Count i = 0, written = 0;
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (sizeof(T) >= 4) {
+				// AVX-512 compresses and stores only the selected elements	
+				constexpr Count L = 64 / sizeof(T);
+				for (; i + L <= count; i += L) {
+					const auto bits = InnerCompressBits<8>(m + i)
+						| (L > 8 ? InnerCompressBits<8>(m + i + 8) << 8 : 0u);
+					const auto selected = static_cast<Count>(::std::popcount(bits));
+					if (written + selected > capacity)
+						break;
+
+					if constexpr (CT::RealSP<T>)
+						simde_mm512_mask_compressstoreu_ps(out + written, static_cast<simde__mmask16>(bits), simde_mm512_loadu_ps(in + i));
+					else if constexpr (CT::RealDP<T>)
+						simde_mm512_mask_compressstoreu_pd(out + written, static_cast<simde__mmask8>(bits), simde_mm512_loadu_pd(in + i));
+					else if constexpr (sizeof(T) == 4)
+						simde_mm512_mask_compressstoreu_epi32(out + written, static_cast<simde__mmask16>(bits), simde_mm512_loadu_si512(in + i));
+					else
+						simde_mm512_mask_compressstoreu_epi64(out + written, static_cast<simde__mmask8>(bits), simde_mm512_loadu_si512(in + i));
+					written += selected;
+				}
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count K = CompressLanes<sizeof(T)>;
+			constexpr auto& table = CompressTable<sizeof(T), false>;
+			for (; i + K <= count; i += K) {
+				const auto bits = InnerCompressBits<K>(m + i);
+				const auto selected = static_cast<Count>(::std::popcount(bits));
+				if (written + selected > capacity)
+					break;
+
+				// Byte elements are done eight at a time, so load only eight	
+				// bytes, or we would read past the end of the values			
+				simde__m128i source;
+				if constexpr (K * sizeof(T) == 8)
+					source = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(in + i));
+				else
+					source = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i));
+
+				const auto packed = simde_mm_shuffle_epi8(source,
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(table[bits].data()))
+				);
+
+				if (written + K <= capacity) {
+					// There's enough room to store all lanes, only the		
+					// selected ones will be kept, the rest get overwritten	
+					if constexpr (K * sizeof(T) == 8)
+						simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(out + written), packed);
+					else
+						simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + written), packed);
+				}
+				else {
+					T temp[16 / sizeof(T)];
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(temp), packed);
+					::std::memcpy(out + written, temp, selected * sizeof(T));
+				}
+				written += selected;
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count && written < capacity; ++i) {
+			if (m[i])
+				out[written++] = in[i];
+		}
+		return written;
+	}
+
+	/// Spread the front of the values into the output elements, whose mask		
+	/// is true. This is the inverse of Compress, output elements whose mask	
+	/// is false are left untouched															
+	///	@param values - the tightly packed elements									
+	///	@param mask - a boolean for each output element								
+	///	@param output - [out] the spread elements										
+	///	@return the number of values consumed											
+	template<CT::Span IN, CT::Span MASK, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) Count Expand(IN&& values, MASK&& mask, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(CT::Same<bool, SpanType<MASK>>, "Mask must be a span of booleans");
+		static_assert(sizeof(T) <= 8 && 16 % sizeof(T) == 0, "Unsupported element size");
+
+		const Count count = OverlapCount(output, mask);
+		const Count available = ::std::ranges::size(values);
+		const T* in = ::std::ranges::data(values);
+		const bool* m = ::std::ranges::data(mask);
+		T* out = ::std::ranges::data(output);
+		Count i = 0, consumed = 0;
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (sizeof(T) >= 4) {
+				// AVX-512 expands straight from unaligned memory				
+				constexpr Count L = 64 / sizeof(T);
+				for (; i + L <= count; i += L) {
+					const auto bits = InnerCompressBits<8>(m + i)
+						| (L > 8 ? InnerCompressBits<8>(m + i + 8) << 8 : 0u);
+					const auto selected = static_cast<Count>(::std::popcount(bits));
+					if (consumed + selected > available)
+						break;
+
+					if constexpr (CT::RealSP<T>) {
+						simde_mm512_storeu_ps(out + i, simde_mm512_mask_expandloadu_ps(
+							simde_mm512_loadu_ps(out + i), static_cast<simde__mmask16>(bits), in + consumed));
+					}
+					else if constexpr (CT::RealDP<T>) {
+						simde_mm512_storeu_pd(out + i, simde_mm512_mask_expandloadu_pd(
+							simde_mm512_loadu_pd(out + i), static_cast<simde__mmask8>(bits), in + consumed));
+					}
+					else if constexpr (sizeof(T) == 4) {
+						simde_mm512_storeu_si512(out + i, simde_mm512_mask_expandloadu_epi32(
+							simde_mm512_loadu_si512(out + i), static_cast<simde__mmask16>(bits), in + consumed));
+					}
+					else {
+						simde_mm512_storeu_si512(out + i, simde_mm512_mask_expandloadu_epi64(
+							simde_mm512_loadu_si512(out + i), static_cast<simde__mmask8>(bits), in + consumed));
+					}
+					consumed += selected;
+				}
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count K = CompressLanes<sizeof(T)>;
+			constexpr auto& table = CompressTable<sizeof(T), true>;
+			for (; i + K <= count; i += K) {
+				const auto bits = InnerCompressBits<K>(m + i);
+				const auto selected = static_cast<Count>(::std::popcount(bits));
+				if (consumed + selected > available)
+					break;
+
+				simde__m128i packed;
+				if (consumed + K <= available) {
+					if constexpr (K * sizeof(T) == 8)
+						packed = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(in + consumed));
+					else
+						packed = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + consumed));
+				}
+				else {
+					// Don't read past the end of the values						
+					T temp[16 / sizeof(T)] {};
+					::std::memcpy(temp, in + consumed, selected * sizeof(T));
+					packed = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(temp));
+				}
+
+				// Selected bytes have non-negative shuffle indices			
+				const auto shuffle = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(table[bits].data()));
+				const auto keep = simde_mm_cmpgt_epi8(shuffle, simde_mm_set1_epi8(-1));
+				T* target = out + i;
+				if constexpr (K * sizeof(T) == 8) {
+					const auto spread = simde_mm_blendv_epi8(
+						simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(target)),
+						simde_mm_shuffle_epi8(packed, shuffle), keep
+					);
+					simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(target), spread);
+				}
+				else {
+					const auto spread = simde_mm_blendv_epi8(
+						simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(target)),
+						simde_mm_shuffle_epi8(packed, shuffle), keep
+					);
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(target), spread);
+				}
+				consumed += selected;
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count && consumed < available; ++i) {
+			if (m[i])
+				out[i] = in[consumed++];
+		}
+		return consumed;
+	}
+
+	/// Copy the elements that satisfy a predicate to the front of the output	
+	/// The predicate is evaluated for a register's worth of elements, which	
+	/// are then packed in one go via Compress											
+	///	@param input - the elements														
+	///	@param output - [out] the selected elements, tightly packed				
+	///	@param predicate - a function taking const T& and returning bool		
+	///	@return the number of elements written to output							
+	template<CT::Span IN, CT::Span OUT, class F>
+	NOD() LANGULUS(ALWAYSINLINE) Count FilterIf(IN&& input, OUT&& output, F&& predicate) {
+		using T = SpanType<IN>;
+		constexpr Count K = 16 / sizeof(T);
+		const Count count = ::std::ranges::size(input);
+		const T* in = ::std::ranges::data(input);
+		T* out = ::std::ranges::data(output);
+		Count i = 0, written = 0;
+
+		bool mask[K];
+		for (; i + K <= count; i += K) {
+			for (Count j = 0; j < K; ++j)
+				mask[j] = predicate(in[i + j]);
+
+			// Safe when filtering in place, since written never exceeds i	
+			written += Compress(
+				::std::span<const T> {in + i, K}, mask,
+				::std::span<T> {out + written, ::std::ranges::size(output) - written}
+			);
+		}
+
+		// Do the rest the old way														
+		for (; i < count && written < ::std::ranges::size(output); ++i) {
+			if (predicate(in[i]))
+				out[written++] = in[i];
+		}
+		return written;
+	}
+
+	/// Keep only the elements that satisfy a predicate, packing them at the	
+	/// front of the span. The rest of the span is left in undefined state		
+	///	@param data - [in/out] the elements												
+	///	@param predicate - a function taking const T& and returning bool		
+	///	@return the number of elements kept												
+	template<CT::Span DATA, class F>
+	NOD() LANGULUS(ALWAYSINLINE) Count FilterIf(DATA&& data, F&& predicate) {
+		return FilterIf(data, data, predicate);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
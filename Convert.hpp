@@ -7,6 +7,8 @@
 ///																									
 #pragma once
 #include "Load.hpp"
+#include "Fixed.hpp"
+#include <limits>
 
 #include "IgnoreWarningsPush.inl"
 
@@ -25,53 +27,274 @@
 namespace Langulus::SIMD
 {
 
-	/// Convert from one array to another using SIMD									
-	///	@tparam DEF - default values for elements that are not loaded			
-	///	@tparam TT - type to convert to													
+	/// Apply the NaN and rounding policies to real numbers, before they are	
+	/// converted to integers. After rounding, all conversions are exact			
+	///	@tparam POLICY - the conversion options										
+	///	@param v - the real numbers														
+	///	@return the real numbers, rounded as the policy says						
+	template<ConvertPolicy POLICY, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerConvertRound(R v) noexcept {
+		constexpr int MODE = _MM_FROUND_NO_EXC | (
+			POLICY.mRounding == ConvertRounding::Truncate ? _MM_FROUND_TO_ZERO :
+			POLICY.mRounding == ConvertRounding::Floor ? _MM_FROUND_TO_NEG_INF :
+			POLICY.mRounding == ConvertRounding::Ceil ? _MM_FROUND_TO_POS_INF :
+			_MM_FROUND_TO_NEAREST_INT);
+		constexpr bool ROUND = POLICY.mRounding != ConvertRounding::Current;
+
+		if constexpr (CT::Same<R, simde__m128>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm_and_ps(v, simde_mm_cmpord_ps(v, v));
+			if constexpr (ROUND)
+				v = simde_mm_round_ps(v, MODE);
+		}
+		else if constexpr (CT::Same<R, simde__m128d>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm_and_pd(v, simde_mm_cmpord_pd(v, v));
+			if constexpr (ROUND)
+				v = simde_mm_round_pd(v, MODE);
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm256_and_ps(v, simde_mm256_cmp_ps(v, v, _CMP_ORD_Q));
+			if constexpr (ROUND)
+				v = simde_mm256_round_ps(v, MODE);
+		}
+		else if constexpr (CT::Same<R, simde__m256d>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm256_and_pd(v, simde_mm256_cmp_pd(v, v, _CMP_ORD_Q));
+			if constexpr (ROUND)
+				v = simde_mm256_round_pd(v, MODE);
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm512_maskz_mov_ps(simde_mm512_cmp_ps_mask(v, v, _CMP_ORD_Q), v);
+			if constexpr (ROUND)
+				v = simde_mm512_roundscale_ps(v, MODE);
+		}
+		else if constexpr (CT::Same<R, simde__m512d>) {
+			if constexpr (POLICY.mNaNToZero)
+				v = simde_mm512_maskz_mov_pd(simde_mm512_cmp_pd_mask(v, v, _CMP_ORD_Q), v);
+			if constexpr (ROUND)
+				v = simde_mm512_roundscale_pd(v, MODE);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertRound");
+		return v;
+	}
+
+	/// The biggest real number that doesn't exceed the range of an integer		
+	/// Integers wider than the mantissa have a limit that can't be represented
+	template<CT::Real REAL, CT::Integer TT>
+	NOD() constexpr REAL InnerConvertLimit() noexcept {
+		using L = ::std::numeric_limits<TT>;
+		constexpr int CUT = L::digits - ::std::numeric_limits<REAL>::digits;
+		if constexpr (CUT > 0)
+			return static_cast<REAL>(L::max() >> CUT << CUT);
+		else
+			return static_cast<REAL>(L::max());
+	}
+
+	/// Clamp real numbers to the range of an integer, if the policy says so	
+	/// NaN is clamped to the lowest integer, unless it was already zeroed		
+	///	@tparam POLICY - the conversion options										
+	///	@tparam TT - the integer the numbers will be converted to				
+	///	@param v - the real numbers														
+	///	@return the clamped real numbers													
+	template<ConvertPolicy POLICY, CT::Integer TT, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerConvertClamp(const R& v) noexcept {
+		constexpr auto lo = ::std::numeric_limits<TT>::min();
+
+		if constexpr (!POLICY.mSaturate)
+			return v;
+		else if constexpr (CT::Same<R, simde__m128>) {
+			const auto low = simde_mm_max_ps(v, simde_mm_set1_ps(static_cast<float>(lo)));
+			return simde_mm_min_ps(low, simde_mm_set1_ps(InnerConvertLimit<float, TT>()));
+		}
+		else if constexpr (CT::Same<R, simde__m128d>) {
+			const auto low = simde_mm_max_pd(v, simde_mm_set1_pd(static_cast<double>(lo)));
+			return simde_mm_min_pd(low, simde_mm_set1_pd(InnerConvertLimit<double, TT>()));
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			const auto low = simde_mm256_max_ps(v, simde_mm256_set1_ps(static_cast<float>(lo)));
+			return simde_mm256_min_ps(low, simde_mm256_set1_ps(InnerConvertLimit<float, TT>()));
+		}
+		else if constexpr (CT::Same<R, simde__m256d>) {
+			const auto low = simde_mm256_max_pd(v, simde_mm256_set1_pd(static_cast<double>(lo)));
+			return simde_mm256_min_pd(low, simde_mm256_set1_pd(InnerConvertLimit<double, TT>()));
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			const auto low = simde_mm512_max_ps(v, simde_mm512_set1_ps(static_cast<float>(lo)));
+			return simde_mm512_min_ps(low, simde_mm512_set1_ps(InnerConvertLimit<float, TT>()));
+		}
+		else if constexpr (CT::Same<R, simde__m512d>) {
+			const auto low = simde_mm512_max_pd(v, simde_mm512_set1_pd(static_cast<double>(lo)));
+			return simde_mm512_min_pd(low, simde_mm512_set1_pd(InnerConvertLimit<double, TT>()));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertClamp");
+	}
+
+	/// Clamping can't reach the upper limit of integers that are wider than	
+	/// the mantissa, so put the limit in every lane that was clamped				
+	///	@tparam POLICY - the conversion options										
+	///	@tparam TT - the integer the numbers were converted to					
+	///	@tparam FT - the real number type that was converted						
+	///	@param real - the real numbers, before they were clamped					
+	///	@param result - the converted integers											
+	///	@return the saturated integers													
+	template<ConvertPolicy POLICY, CT::Integer TT, CT::Real FT, CT::TSIMD R, CT::TSIMD RI>
+	NOD() LANGULUS(ALWAYSINLINE) RI InnerConvertSaturate(const R& real, const RI& result) noexcept {
+		using L = ::std::numeric_limits<TT>;
+		constexpr FT hi = InnerConvertLimit<FT, TT>();
+
+		if constexpr (!POLICY.mSaturate || L::digits <= ::std::numeric_limits<FT>::digits)
+			return result;
+		else if constexpr (CT::Same<R, simde__m512>) {
+			static_assert(sizeof(TT) == 4, "Can't saturate more than sixteen 64-bit integers");
+			const auto over = simde_mm512_cmp_ps_mask(real, simde_mm512_set1_ps(hi), _CMP_GT_OQ);
+			return simde_mm512_mask_mov_epi32(result, over, simde_mm512_set1_epi32(static_cast<int>(L::max())));
+		}
+		else if constexpr (CT::Same<R, simde__m512d>) {
+			const auto over = simde_mm512_cmp_pd_mask(real, simde_mm512_set1_pd(hi), _CMP_GT_OQ);
+			return simde_mm512_mask_mov_epi64(result, over, simde_mm512_set1_epi64(static_cast<long long>(L::max())));
+		}
+		else {
+			// Compare the reals, and widen the mask to the integer lanes	
+			const auto over = [&] {
+				if constexpr (CT::Same<R, simde__m128>)
+					return simde_mm_castps_si128(simde_mm_cmpgt_ps(real, simde_mm_set1_ps(hi)));
+				else if constexpr (CT::Same<R, simde__m128d>)
+					return simde_mm_castpd_si128(simde_mm_cmpgt_pd(real, simde_mm_set1_pd(hi)));
+				else if constexpr (CT::Same<R, simde__m256>)
+					return simde_mm256_castps_si256(simde_mm256_cmp_ps(real, simde_mm256_set1_ps(hi), _CMP_GT_OQ));
+				else if constexpr (CT::Same<R, simde__m256d>)
+					return simde_mm256_castpd_si256(simde_mm256_cmp_pd(real, simde_mm256_set1_pd(hi), _CMP_GT_OQ));
+				else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertSaturate");
+			}();
+
+			const auto mask = [&] {
+				if constexpr (sizeof(FT) == sizeof(TT))
+					return over;
+				else if constexpr (CT::Same<RI, simde__m128i>)
+					return simde_mm_cvtepi32_epi64(over);
+				else if constexpr (CT::Same<RI, simde__m256i>)
+					return simde_mm256_cvtepi32_epi64(over);
+				else if constexpr (CT::Same<RI, simde__m512i>)
+					return simde_mm512_cvtepi32_epi64(over);
+				else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertSaturate");
+			}();
+
+			if constexpr (CT::Same<RI, simde__m128i>) {
+				const auto max = sizeof(TT) == 4
+					? simde_mm_set1_epi32(static_cast<int>(L::max()))
+					: simde_mm_set1_epi64x(static_cast<long long>(L::max()));
+				return simde_mm_blendv_epi8(result, max, mask);
+			}
+			else if constexpr (CT::Same<RI, simde__m256i>) {
+				const auto max = sizeof(TT) == 4
+					? simde_mm256_set1_epi32(static_cast<int>(L::max()))
+					: simde_mm256_set1_epi64x(static_cast<long long>(L::max()));
+				return simde_mm256_blendv_epi8(result, max, mask);
+			}
+			else if constexpr (CT::Same<RI, simde__m512i>) {
+				const auto max = simde_mm512_set1_epi64(static_cast<long long>(L::max()));
+				return simde_mm512_or_si512(simde_mm512_andnot_si512(mask, result), simde_mm512_and_si512(mask, max));
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertSaturate");
+		}
+	}
+
+	/// Convert a register to another one													
+	///	@tparam TT - type to convert to, never a 16-bit real						
 	///	@tparam S - size of the source array											
-	///	@tparam FT - type to convert from												
-	///	@param in - the input data															
+	///	@tparam FT - type to convert from, never a 16-bit real					
+	///	@tparam TO - the register to convert to										
+	///	@tparam POLICY - the conversion options										
+	///	@param loaded - the register to convert										
 	///	@return the resulting register													
-	template<int DEF, class TT, Count S, class FT>
-	LANGULUS(ALWAYSINLINE) auto Convert(const FT(&in)[S]) noexcept {
-		using FROM = decltype(Load<DEF>(Uneval<Decay<FT>[S]>()));
-		using TO = decltype(Load<DEF>(Uneval<Decay<TT>[S]>()));
-		const FROM loaded = Load<DEF>(in);
-
-		if constexpr (CT::NotSupported<FROM> || CT::NotSupported<TO>)
-			return CT::Inner::NotSupported{};
-		else if constexpr (CT::Same<TT, FT>)
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY, CT::TSIMD FROM>
+	LANGULUS(ALWAYSINLINE) auto ConvertRegister(const FROM& loaded) noexcept {
+		if constexpr (CT::Same<TT, FT>)
 			return loaded;
 
 		#if LANGULUS_SIMD(128BIT)
 			else if constexpr (CT::Same<FROM, simde__m128>)
-				return ConvertFrom128<TT, S, FT, TO>(loaded);
+				return ConvertFrom128<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m128d>)
-				return ConvertFrom128d<TT, S, FT, TO>(loaded);
+				return ConvertFrom128d<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m128i>)
-				return ConvertFrom128i<TT, S, FT, TO>(loaded);
+				return ConvertFrom128i<TT, S, FT, TO, POLICY>(loaded);
 		#endif
 
 		#if LANGULUS_SIMD(256BIT)
 			else if constexpr (CT::Same<FROM, simde__m256>)
-				return ConvertFrom256<TT, S, FT, TO>(loaded);
+				return ConvertFrom256<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m256d>)
-				return ConvertFrom256d<TT, S, FT, TO>(loaded);
+				return ConvertFrom256d<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m256i>)
-				return ConvertFrom256i<TT, S, FT, TO>(loaded);
+				return ConvertFrom256i<TT, S, FT, TO, POLICY>(loaded);
 		#endif
 
 		#if LANGULUS_SIMD(512BIT)
 			else if constexpr (CT::Same<FROM, simde__m512>)
-				return ConvertFrom512<TT, S, FT, TO>(loaded);
+				return ConvertFrom512<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m512d>)
-				return ConvertFrom512d<TT, S, FT, TO>(loaded);
+				return ConvertFrom512d<TT, S, FT, TO, POLICY>(loaded);
 			else if constexpr (CT::Same<FROM, simde__m512i>)
-				return ConvertFrom512i<TT, S, FT, TO>(loaded);
+				return ConvertFrom512i<TT, S, FT, TO, POLICY>(loaded);
 		#endif
 
 		else LANGULUS_ASSERT("Can't convert from unsupported");
 	}
+
+	/// Convert from one array to another using SIMD									
+	///	@tparam DEF - default values for elements that are not loaded			
+	///	@tparam TT - type to convert to													
+	///	@tparam POLICY - the conversion options, see ConvertPolicy				
+	///	@tparam S - size of the source array											
+	///	@tparam FT - type to convert from												
+	///	@param in - the input data															
+	///	@return the resulting register													
+	template<int DEF, class TT, ConvertPolicy POLICY = {}, Count S, class FT>
+	LANGULUS(ALWAYSINLINE) auto Convert(const FT(&in)[S]) noexcept {
+		using FROM = decltype(Load<DEF>(Uneval<Decay<FT>[S]>()));
+		using TO = decltype(Load<DEF>(Uneval<Decay<TT>[S]>()));
+
+		// 16-bit reals are loaded and stored as floats, so convert as such
+		using WTT = CT::Inner::Widened<TT>;
+		using WFT = CT::Inner::Widened<FT>;
+
+		if constexpr (CT::NotSupported<FROM> || CT::NotSupported<TO>)
+			return CT::Inner::NotSupported{};
+		else if constexpr (CT::Same<WTT, WFT>)
+			return Load<DEF>(in);
+		else if constexpr (CT::FixedPoint<WFT>) {
+			// Fixed point numbers are loaded as integers, then scaled down
+			static_assert(CT::RealSP<WTT>, "Fixed point numbers convert only to and from float");
+			return InnerConvertFromFixed<WFT, TO>(Load<DEF>(in));
+		}
+		else if constexpr (CT::FixedPoint<WTT>) {
+			// Scale up, then round and saturate to the integer holding it	
+			static_assert(CT::RealSP<WFT>, "Fixed point numbers convert only to and from float");
+			using INT = typename WTT::Type;
+			constexpr ConvertPolicy FIXED {
+				.mFastRange = POLICY.mFastRange,
+				.mRounding = POLICY.mRounding,
+				.mSaturate = true,
+				.mNaNToZero = true
+			};
+			const FROM real = InnerConvertRound<FIXED>(InnerScaleFixed<WTT>(Load<DEF>(in)));
+			const auto clamped = InnerConvertClamp<FIXED, INT>(real);
+			const auto result = InnerConvertToFixed<WTT, TO>(clamped);
+			return InnerConvertSaturate<FIXED, INT, WFT>(real, result);
+		}
+		else if constexpr (CT::Real<WFT> && CT::Integer<WTT>) {
+			// Round and clamp first, so the conversion itself is exact		
+			const FROM real = InnerConvertRound<POLICY>(Load<DEF>(in));
+			const auto clamped = InnerConvertClamp<POLICY, WTT>(real);
+			const auto result = ConvertRegister<WTT, S, WFT, TO, POLICY>(clamped);
+			return InnerConvertSaturate<POLICY, WTT, WFT>(real, result);
+		}
+		else return ConvertRegister<WTT, S, WFT, TO, POLICY>(Load<DEF>(in));
+	}
 	
 	/// Attempt register encapsulation of LHS and RHS arrays							
 	/// Check if result of opSIMD is supported and return it, otherwise			
@@ -101,8 +324,8 @@ namespace Langulus::SIMD
 		else if constexpr (CT::Array<LHS> && CT::Array<RHS>) {
 			// Both LHS and RHS are arrays, so wrap in registers				
 			return opSIMD(
-				Convert<DEF, LOSSLESS, S>(lhs),
-				Convert<DEF, LOSSLESS, S>(rhs)
+				Convert<DEF, LOSSLESS>(lhs),
+				Convert<DEF, LOSSLESS>(rhs)
 			);
 		}
 		else if constexpr (CT::Array<LHS>) {
@@ -16,9 +16,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - register to convert to												
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom128(const simde__m128& v) noexcept {
 		//																						
 		// Converting FROM float[4]													
@@ -71,15 +72,12 @@ namespace Langulus::SIMD
 			}
 			else if constexpr (CT::UnsignedInteger32<TT> && S <= 4) {
 				// float[4] -> pcu32[4]													
-				return _mm_cvtps_epu32(v);
+				return float_to_uint32(v);
 			}
-			else if constexpr (CT::SignedInteger64<TT> && S <= 2) {
+			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// float[2] -> pci64[2]													
-				return _mm_cvtps_epi64(v);
-			}
-			else if constexpr (CT::UnsignedInteger64<TT> && S <= 2) {
 				// float[2] -> pcu64[2]													
-				return _mm_cvtps_epu64(v);
+				return InnerConvertToInt64<POLICY, TT>(simde_mm_cvtps_pd(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m128 to __m128i");
 		}
@@ -87,13 +85,10 @@ namespace Langulus::SIMD
 			//																					
 			// Converting TO pci64[4], pcu64[4]										
 			//																					
-			if constexpr (CT::SignedInteger64<TT> && S <= 4) {
+			if constexpr (CT::Integer64<TT> && S <= 4) {
 				// float[4] -> pci64[4]													
-				return _mm256_cvtps_epi64(v);
-			}
-			else if constexpr (CT::UnsignedInteger64<TT> && S <= 4) {
 				// float[4] -> pcu64[4]													
-				return _mm256_cvtps_epu64(v);
+				return InnerConvertToInt64<POLICY, TT>(simde_mm256_cvtps_pd(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m128 to __m256i");
 		}
@@ -112,9 +107,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - register to convert to												
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom128d(const simde__m128d& v) noexcept {
 		//																						
 		// Converting FROM double[2]													
@@ -161,17 +157,17 @@ namespace Langulus::SIMD
 				vi32_16 = simde_mm_packus_epi32(vi32_16, simde_mm_setzero_si128());
 				return vi32_16;
 			}
-			else if constexpr (CT::Integer32<TT> && S <= 2) {
-				// double[2] -> pci32[2] or pcu32[2]								
-				return simde_mm_cvtpd_pi32(v);
+			else if constexpr (CT::SignedInteger32<TT> && S <= 2) {
+				// double[2] -> pci32[2]												
+				return simde_mm_cvtpd_epi32(v);
 			}
-			else if constexpr (CT::SignedInteger64<TT> && S <= 2) {
-				// double[2] -> pci64[2] or pcu64[2]								
-				return _mm_cvtpd_epi64(v);
+			else if constexpr (CT::UnsignedInteger32<TT> && S <= 2) {
+				// double[2] -> pcu32[2]												
+				return double_to_uint32(v);
 			}
-			else if constexpr (CT::UnsignedInteger64<TT> && S <= 2) {
+			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// double[2] -> pci64[2] or pcu64[2]								
-				return _mm_cvtpd_epu64(v);
+				return InnerConvertToInt64<POLICY, TT>(v);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m128d to __m128i");
 		}
@@ -183,9 +179,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - register to convert to												
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom128i(const simde__m128i& v) noexcept {
 		//																						
 		// Converting FROM pci8[16], pcu8[16], pci16[8], pcu16[8]			
@@ -231,11 +228,19 @@ namespace Langulus::SIMD
 			}
 			else if constexpr (CT::SignedInteger64<FT> && S <= 2) {
 				// pci64[2] -> float[2]													
-				return _mm_cvtepi64_ps(v);
+				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+					return simde_mm_cvtepi64_ps(v);
+				#else
+					return InnerConvertInt64ToFloat<POLICY, FT>(v);
+				#endif
 			}
 			else if constexpr (CT::UnsignedInteger64<FT> && S <= 2) {
 				// pcu64[2] -> float[2]													
-				return _mm_cvtepu64_ps(v);
+				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+					return simde_mm_cvtepu64_ps(v);
+				#else
+					return InnerConvertInt64ToFloat<POLICY, FT>(v);
+				#endif
 			}
 			else LANGULUS_ASSERT("Can't convert from __m128i to __m128");
 		}
@@ -277,13 +282,10 @@ namespace Langulus::SIMD
 				// pcu32[2] -> double[2]												
 				return _mm_cvtepu32_pd(v);
 			}
-			else if constexpr (CT::SignedInteger64<FT> && S <= 2) {
+			else if constexpr (CT::Integer64<FT> && S <= 2) {
 				// pci64[2] -> double[2]												
-				return _mm_cvtepi64_pd(v);
-			}
-			else if constexpr (CT::UnsignedInteger64<FT> && S <= 2) {
 				// pcu64[2] -> double[2]												
-				return _mm_cvtepu64_pd(v);
+				return InnerConvertInt64<POLICY, FT>(v);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m128i to __m128d");
 		}
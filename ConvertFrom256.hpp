@@ -16,9 +16,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom256(const simde__m256& v) noexcept {
 		//																						
 		// Converting FROM float[8]													
@@ -71,21 +72,13 @@ namespace Langulus::SIMD
 			}
 			else if constexpr (CT::Same<TT, uint32_t> && S <= 4) {
 				// float[4] -> pcu32[4]													
-				return simde_mm_cvtps_epi32(simde_mm256_castps256_ps128(v));
+				return float_to_uint32(simde_mm256_castps256_ps128(v));
 			}
-			else if constexpr (CT::Same<TT, int64_t> && S <= 2) {
+			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// float[2] -> pci64[2]													
-				const auto vi32 = simde_mm256_cvtps_epi32(v);
-				const auto vi32_128 = simde_mm256_castsi256_si128(vi32);
-				const auto vi64 = simde_mm256_cvtepi32_epi64(vi32_128);
-				return simde_mm256_castsi256_si128(vi64);
-			}
-			else if constexpr (CT::Same<TT, uint64_t> && S <= 2) {
 				// float[2] -> pcu64[2]													
-				const auto vu32 = simde_mm256_cvtps_epi32(v);
-				const auto vu32_128 = simde_mm256_castsi256_si128(vu32);
-				const auto vu64 = simde_mm256_cvtepi32_epi64(vu32_128);
-				return simde_mm256_castsi256_si128(vu64);
+				const auto vd = simde_mm_cvtps_pd(simde_mm256_castps256_ps128(v));
+				return InnerConvertToInt64<POLICY, TT>(vd);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m256 to __m128i");
 		}
@@ -93,15 +86,11 @@ namespace Langulus::SIMD
 			//																					
 			// Converting TO pci64[4], pcu64[4]										
 			//																					
-			if constexpr (CT::Same<TT, int64_t> && S <= 4) {
+			if constexpr (CT::Integer64<TT> && S <= 4) {
 				// float[4] -> pci64[4]													
-				const auto v32 = simde_mm_cvtps_epi32(simde_mm256_castps256_ps128(v));
-				return simde_mm256_cvtepi32_epi64(v32);
-			}
-			else if constexpr (CT::Same<TT, uint64_t> && S <= 4) {
 				// float[4] -> pcu64[4] 												
-				const auto v32 = simde_mm_cvtps_epi32(simde_mm256_castps256_ps128(v));
-				return simde_mm256_cvtepu32_epi64(v32);
+				const auto vd = simde_mm256_cvtps_pd(simde_mm256_castps256_ps128(v));
+				return InnerConvertToInt64<POLICY, TT>(vd);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m256 to __m256i");
 		}
@@ -120,9 +109,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom256d(const simde__m256d& v) noexcept {
 		//																						
 		// Converting FROM double[4]													
@@ -142,7 +132,7 @@ namespace Langulus::SIMD
 			if constexpr (CT::SignedInteger8<TT> && S <= 4) {
 				// double[4] -> pci8[4]													
 				auto
-				vi32_16_8 = simde_mm_cvtps_epi32(simde_mm256_cvtpd_ps(v));
+				vi32_16_8 = simde_mm256_cvtpd_epi32(v);
 				vi32_16_8 = simde_mm_packs_epi32(vi32_16_8, vi32_16_8);
 				vi32_16_8 = simde_mm_packs_epi16(vi32_16_8, vi32_16_8);
 				return vi32_16_8;
@@ -150,7 +140,7 @@ namespace Langulus::SIMD
 			else if constexpr (CT::UnsignedInteger8<TT> && S <= 4) {
 				// double[4] -> pcu8[4]													
 				auto
-				vu32_16_8 = simde_mm_cvtps_epi32(simde_mm256_cvtpd_ps(v));
+				vu32_16_8 = simde_mm256_cvtpd_epi32(v);
 				vu32_16_8 = simde_mm_packus_epi32(vu32_16_8, vu32_16_8);
 				vu32_16_8 = simde_mm_packus_epi16(vu32_16_8, vu32_16_8);
 				return vu32_16_8;
@@ -158,30 +148,40 @@ namespace Langulus::SIMD
 			else if constexpr (CT::SignedInteger16<TT> && S <= 4) {
 				// double[4] -> pci16[4]												
 				auto
-				vi32_16 = simde_mm_cvtps_epi32(simde_mm256_cvtpd_ps(v));
+				vi32_16 = simde_mm256_cvtpd_epi32(v);
 				vi32_16 = simde_mm_packs_epi32(vi32_16, vi32_16);
 				return vi32_16;
 			}
 			else if constexpr (CT::UnsignedInteger16<TT> && S <= 4) {
 				// double[4] -> pcu16[4]												
 				auto
-				vu32_16 = simde_mm_cvtps_epi32(simde_mm256_cvtpd_ps(v));
+				vu32_16 = simde_mm256_cvtpd_epi32(v);
 				vu32_16 = simde_mm_packus_epi32(vu32_16, vu32_16);
 				return vu32_16;
 			}
-			else if constexpr (CT::Integer32<TT> && S <= 4) {
+			else if constexpr (CT::SignedInteger32<TT> && S <= 4) {
 				// double[4] -> pci32[4] 												
+				return simde_mm256_cvtpd_epi32(v);
+			}
+			else if constexpr (CT::UnsignedInteger32<TT> && S <= 4) {
 				// double[4] -> pcu32[4] 												
-				return simde_mm_cvtps_epi32(simde_mm256_cvtpd_ps(v));
+				return double_to_uint32(v);
 			}
 			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// double[2] -> pci64[2]												
 				// double[2] -> pcu64[2]												
-				const auto v32 = simde_mm256_cvtpd_epi32(v);
-				return simde_mm_unpacklo_epi32(v32, simde_mm_setzero_si128());
+				return InnerConvertToInt64<POLICY, TT>(simde_mm256_castpd256_pd128(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m256d to __m128i");
 		}
+		else if constexpr (CT::Same<TO, simde__m256i> && CT::Integer64<TT> && S <= 4) {
+			//																					
+			// Converting TO pci64[4], pcu64[4]										
+			//																					
+			// double[4] -> pci64[4]													
+			// double[4] -> pcu64[4]													
+			return InnerConvertToInt64<POLICY, TT>(v);
+		}
 		else LANGULUS_ASSERT("Can't convert from __m256d to unsupported");
 	}
 
@@ -190,9 +190,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom256i(const simde__m256i& v) noexcept {
 		//																						
 		// Converting FROM	pci8[32], pcu8[32], pci16[16], pcu16[16]		
@@ -233,9 +234,7 @@ namespace Langulus::SIMD
 				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
 					return simde_mm256_cvtepu64_ps(v);
 				#else
-					auto m1 = uint64_to_double_full(simde_mm256_extracti128_si256(v, 0));
-					auto m2 = uint64_to_double_full(simde_mm256_extracti128_si256(v, 1));
-					return simde_mm_movelh_ps(simde_mm_cvtpd_ps(m1), simde_mm_cvtpd_ps(m2));
+					return InnerConvertInt64ToFloat<POLICY, FT>(v);
 				#endif
 			}
 			else if constexpr (CT::SignedInteger64<FT> && S <= 4) {
@@ -244,9 +243,7 @@ namespace Langulus::SIMD
 				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
 					return simde_mm256_cvtepi64_ps(v);
 				#else
-					auto m1 = int64_to_double_full(simde_mm256_extracti128_si256(v, 0));
-					auto m2 = int64_to_double_full(simde_mm256_extracti128_si256(v, 1));
-					return simde_mm_movelh_ps(simde_mm_cvtpd_ps(m1), simde_mm_cvtpd_ps(m2));
+					return InnerConvertInt64ToFloat<POLICY, FT>(v);
 				#endif
 			}
 			else LANGULUS_ASSERT("Can't convert from __m256i to __m128");
@@ -280,26 +277,21 @@ namespace Langulus::SIMD
 				// pcu32[2] -> double[2]												
 				return simde_mm_cvtepi32_pd(simde_mm256_castsi256_si128(v));
 			}
-			else if constexpr (CT::UnsignedInteger64<FT> && S <= 2) {
-				// pcu64[2] -> double[2]												
-				//TODO generalize this when 512 stuff is added to SIMDe		
-				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
-					return simde_mm_cvtepu64_pd(simde_mm256_extracti128_si256(v, 0));
-				#else
-					return uint64_to_double_full(simde_mm256_extracti128_si256(v, 0));
-				#endif
-			}
-			else if constexpr (CT::SignedInteger64<FT> && S <= 2) {
+			else if constexpr (CT::Integer64<FT> && S <= 2) {
 				// pci64[2] -> double[2]												
-				//TODO generalize this when 512 stuff is added to SIMDe		
-				#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
-					return simde_mm_cvtepi64_pd(simde_mm256_extracti128_si256(v, 0));
-				#else
-					return int64_to_double_full(simde_mm256_extracti128_si256(v, 0));
-				#endif
+				// pcu64[2] -> double[2]												
+				return InnerConvertInt64<POLICY, FT>(simde_mm256_castsi256_si128(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m256i to __m128d");
 		}
+		else if constexpr (CT::Same<TO, simde__m256d> && CT::Integer64<FT> && S <= 4) {
+			//																					
+			// Converting TO double[4]													
+			//																					
+			// pci64[4] -> double[4]													
+			// pcu64[4] -> double[4]													
+			return InnerConvertInt64<POLICY, FT>(v);
+		}
 		else if constexpr (CT::Same<TO, simde__m128i>) {
 			if constexpr (CT::Same<FT, int8_t>) {
 				//																				
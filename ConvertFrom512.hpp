@@ -16,9 +16,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom512(const simde__m512& v) noexcept {
 		//																						
 		// Converting FROM float[16]													
@@ -82,16 +83,19 @@ namespace Langulus::SIMD
 				v1 = simde_mm256_packus_epi32(v1, v2);
 				return simde_mm256_castsi256_si128(v1);
 			}
-			else if constexpr (CT::Integer32<TT> && S <= 4) {
+			else if constexpr (CT::SignedInteger32<TT> && S <= 4) {
 				// float[4] -> pci32[4]													
-				// float[4] -> pcu32[4]													
 				return simde_mm_cvtps_epi32(simde_mm512_castps512_ps128(v));
 			}
+			else if constexpr (CT::UnsignedInteger32<TT> && S <= 4) {
+				// float[4] -> pcu32[4]													
+				return float_to_uint32(simde_mm512_castps512_ps128(v));
+			}
 			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// float[2] -> pci64[2]													
 				// float[2] -> pcu64[2]													
-				const auto i32 = simde_mm_cvtps_epi32(simde_mm512_castps512_ps128(v));
-				return simde_mm_cvtepi32_epi64(i32);
+				const auto vd = simde_mm_cvtps_pd(simde_mm512_castps512_ps128(v));
+				return InnerConvertToInt64<POLICY, TT>(vd);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m512 to __m128i");
 		}
@@ -154,16 +158,19 @@ namespace Langulus::SIMD
 				v1 = simde_mm256_packus_epi32(v1, v2);
 				return v1;
 			}
-			else if constexpr (CT::Integer32<TT> && S <= 8) {
+			else if constexpr (CT::SignedInteger32<TT> && S <= 8) {
 				// float[8] -> pci32[8]													
-				// float[8] -> pcu32[8]													
 				return simde_mm256_cvtps_epi32(simde_mm512_castps512_ps256(v));
 			}
+			else if constexpr (CT::UnsignedInteger32<TT> && S <= 8) {
+				// float[8] -> pcu32[8]													
+				return float_to_uint32(simde_mm512_castps512_ps256(v));
+			}
 			else if constexpr (CT::Integer64<TT> && S <= 4) {
 				// float[4] -> pci64[4]													
 				// float[4] -> pcu64[4]													
-				const auto i32 = simde_mm_cvtps_epi32(simde_mm512_castps512_ps128(v));
-				return simde_mm256_cvtepi32_epi64(i32);
+				const auto vd = simde_mm256_cvtps_pd(simde_mm512_castps512_ps128(v));
+				return InnerConvertToInt64<POLICY, TT>(vd);
 			}
 			else LANGULUS_ASSERT("Can't convert from __m512 to __m256i");
 		}
@@ -175,9 +182,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom512d(const simde__m512d& v) noexcept {
 		//																						
 		// Converting FROM double[8]													
@@ -203,61 +211,57 @@ namespace Langulus::SIMD
 			//																					
 			if constexpr (CT::SignedInteger8<TT> && S <= 8) {
 				// double[8] -> pci8[8]													
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
 				auto
-				i = simde_mm256_cvtps_epi32(f);
+				i = simde_mm512_cvtpd_epi32(v);
 				i = simde_mm256_packs_epi32(i, i);
 				i = simde_mm256_packs_epi16(i, i);
 				return simde_mm256_castsi256_si128(i);
 			}
 			else if constexpr (CT::UnsignedInteger8<TT> && S <= 8) {
 				// double[8] -> pcu8[8]													
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
 				auto
-				i = simde_mm256_cvtps_epi32(f);
+				i = simde_mm512_cvtpd_epi32(v);
 				i = simde_mm256_packus_epi32(i, i);
 				i = simde_mm256_packus_epi16(i, i);
 				return simde_mm256_castsi256_si128(i);
 			}
 			else if constexpr (CT::SignedInteger16<TT> && S <= 8) {
 				// double[8] -> pci16[8]												
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
 				auto
-				i = simde_mm256_cvtps_epi32(f);
+				i = simde_mm512_cvtpd_epi32(v);
 				i = simde_mm256_packs_epi32(i, i);
 				return simde_mm256_castsi256_si128(i);
 			}
 			else if constexpr (CT::UnsignedInteger16<TT> && S <= 8) {
 				// double[8] -> pcu16[8]												
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
 				auto
-				i = simde_mm256_cvtps_epi32(f);
+				i = simde_mm512_cvtpd_epi32(v);
 				i = simde_mm256_packus_epi32(i, i);
 				return simde_mm256_castsi256_si128(i);
 			}
-			else if constexpr (CT::Integer32<TT> && S <= 4) {
+			else if constexpr (CT::SignedInteger32<TT> && S <= 4) {
 				// double[4] -> pci32[4]												
+				return simde_mm256_castsi256_si128(simde_mm512_cvtpd_epi32(v));
+			}
+			else if constexpr (CT::UnsignedInteger32<TT> && S <= 4) {
 				// double[4] -> pcu32[4]												
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
-				return simde_mm256_castsi256_si128(simde_mm256_cvtps_epi32(f));
+				return double_to_uint32(simde_mm512_castpd512_pd256(v));
 			}
 			else if constexpr (CT::Integer64<TT> && S <= 2) {
 				// double[2] -> pci64[2]												
 				// double[2] -> pcu64[2]												
-				const auto
-				f = simde_mm512_castps512_ps256(simde_mm512_castpd_ps(v));
-				auto
-				i = simde_mm256_cvtps_epi32(f);
-				i = simde_mm256_cvtepi32_epi64(simde_mm256_castsi256_si128(i));
-				return simde_mm256_castsi256_si128(i);
+				return simde_mm512_castsi512_si128(InnerConvertToInt64<POLICY, TT>(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m512d to __m128i");
 		}
+		else if constexpr (CT::Same<TO, simde__m512i> && CT::Integer64<TT> && S <= 8) {
+			//																					
+			// Converting TO pci64[8], pcu64[8]										
+			//																					
+			// double[8] -> pci64[8]													
+			// double[8] -> pcu64[8]													
+			return InnerConvertToInt64<POLICY, TT>(v);
+		}
 		else LANGULUS_ASSERT("Can't convert from __m512d to unsupported");
 	}
 
@@ -266,9 +270,10 @@ namespace Langulus::SIMD
 	///	@tparam S - size of the input array												
 	///	@tparam FT - true type contained in the input								
 	///	@tparam TO - type of register to convert to									
+	///	@tparam POLICY - the conversion options										
 	///	@param v - the input data															
 	///	@return the resulting register													
-	template<class TT, Count S, class FT, class TO>
+	template<class TT, Count S, class FT, class TO, ConvertPolicy POLICY = {}>
 	LANGULUS(ALWAYSINLINE) auto ConvertFrom512i(const simde__m512i& v) noexcept {
 		//																						
 		// Converting FROM pci8[64], pcu8[64], pci16[32], pcu16[32]			
@@ -300,11 +305,13 @@ namespace Langulus::SIMD
 				// pcu32[4] -> float[4]													
 				return simde_mm_cvtepi32_ps(simde_mm512_castsi512_si128(v));
 			}
-			else if constexpr (CT::Integer64<FT> && S <= 2) {
+			else if constexpr (CT::SignedInteger64<FT> && S <= 2) {
 				// pci64[2] -> float[2]													
+				return simde_mm256_castps256_ps128(simde_mm512_cvtepi64_ps(v));
+			}
+			else if constexpr (CT::UnsignedInteger64<FT> && S <= 2) {
 				// pcu64[2] -> float[2]													
-				auto i32 = simde_mm512_cvtsepi64_epi32(v);
-				return simde_mm_cvtepi32_ps(simde_mm256_castsi256_si128(i32));
+				return simde_mm256_castps256_ps128(simde_mm512_cvtepu64_ps(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m512i to __m128");
 		}
@@ -335,13 +342,20 @@ namespace Langulus::SIMD
 				return simde_mm_cvtepi32_pd(simde_mm512_castsi512_si128(v));
 			}
 			else if constexpr (CT::Integer64<FT> && S <= 2) {
-				// pci64[2] -> float[2]													
-				// pcu64[2] -> float[2]													
-				auto i32 = simde_mm512_cvtsepi64_epi32(v);
-				return simde_mm_cvtepi32_pd(simde_mm256_castsi256_si128(i32));
+				// pci64[2] -> double[2]												
+				// pcu64[2] -> double[2]												
+				return simde_mm512_castpd512_pd128(InnerConvertInt64<POLICY, FT>(v));
 			}
 			else LANGULUS_ASSERT("Can't convert from __m512i to __m128d");
 		}
+		else if constexpr (CT::Same<TO, simde__m512d> && CT::Integer64<FT> && S <= 8) {
+			//																					
+			// Converting TO double[8]													
+			//																					
+			// pci64[8] -> double[8]													
+			// pcu64[8] -> double[8]													
+			return InnerConvertInt64<POLICY, FT>(v);
+		}
 		else if constexpr (CT::Same<TO, simde__m128i>) {
 			if constexpr (CT::Integer8<FT>) {
 				//																				
@@ -0,0 +1,150 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Intrinsics.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Load 16-bit real numbers, widening them to single precision				
+	/// Float16 uses F16C if available, and the old way otherwise. BFloat16 is	
+	/// just the upper half of a float, so it needs only integer shuffles		
+	///	@tparam T - Float16 or BFloat16													
+	///	@tparam TO - the float register to load, decides how many are loaded	
+	///	@param from - the numbers to load												
+	///	@return the widened numbers														
+	template<CT::RealHalf T, CT::TSIMD TO>
+	NOD() LANGULUS(ALWAYSINLINE) TO InnerLoadHalf(const T* from) noexcept {
+		constexpr Count N = sizeof(TO) / sizeof(float);
+
+		if constexpr (CT::RealHP<T> && !LANGULUS_SIMD(F16C)) {
+			// No F16C, so do it the old way											
+			alignas(TO) float wide[N];
+			for (Count i = 0; i < N; ++i)
+				wide[i] = from[i];
+
+			if constexpr (CT::Same<TO, simde__m128>)
+				return simde_mm_load_ps(wide);
+			else if constexpr (CT::Same<TO, simde__m256>)
+				return simde_mm256_load_ps(wide);
+			else if constexpr (CT::Same<TO, simde__m512>)
+				return simde_mm512_load_ps(wide);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerLoadHalf");
+		}
+		else if constexpr (CT::Same<TO, simde__m128>) {
+			const auto bits = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(from));
+			if constexpr (CT::RealHP<T>)
+				return simde_mm_cvtph_ps(bits);
+			else
+				return simde_mm_castsi128_ps(simde_mm_unpacklo_epi16(simde_mm_setzero_si128(), bits));
+		}
+		else if constexpr (CT::Same<TO, simde__m256>) {
+			const auto bits = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from));
+			if constexpr (CT::RealHP<T>)
+				return simde_mm256_cvtph_ps(bits);
+			else
+				return simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_cvtepu16_epi32(bits), 16));
+		}
+		else if constexpr (CT::Same<TO, simde__m512>) {
+			const auto bits = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from));
+			if constexpr (CT::RealHP<T>)
+				return simde_mm512_cvtph_ps(bits);
+			else
+				return simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_cvtepu16_epi32(bits), 16));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerLoadHalf");
+	}
+
+	/// Round single precision numbers to the nearest bfloat16, leaving each	
+	/// in the lower half of its 32-bit lane, sign-extended so it packs as is	
+	template<CT::TSIMD FROM>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerRoundBFloat16(const FROM& from) noexcept {
+		if constexpr (CT::Same<FROM, simde__m128>) {
+			const auto bits = simde_mm_castps_si128(from);
+			const auto odd = simde_mm_and_si128(simde_mm_srli_epi32(bits, 16), simde_mm_set1_epi32(1));
+			const auto rounded = simde_mm_add_epi32(bits, simde_mm_add_epi32(odd, simde_mm_set1_epi32(0x7FFF)));
+			const auto quiet = simde_mm_or_si128(bits, simde_mm_set1_epi32(0x400000));
+			const auto nan = simde_mm_castps_si128(simde_mm_cmpunord_ps(from, from));
+			return simde_mm_srai_epi32(simde_mm_or_si128(simde_mm_and_si128(nan, quiet), simde_mm_andnot_si128(nan, rounded)), 16);
+		}
+		else if constexpr (CT::Same<FROM, simde__m256>) {
+			const auto bits = simde_mm256_castps_si256(from);
+			const auto odd = simde_mm256_and_si256(simde_mm256_srli_epi32(bits, 16), simde_mm256_set1_epi32(1));
+			const auto rounded = simde_mm256_add_epi32(bits, simde_mm256_add_epi32(odd, simde_mm256_set1_epi32(0x7FFF)));
+			const auto quiet = simde_mm256_or_si256(bits, simde_mm256_set1_epi32(0x400000));
+			const auto nan = simde_mm256_castps_si256(simde_mm256_cmp_ps(from, from, _CMP_UNORD_Q));
+			return simde_mm256_srai_epi32(simde_mm256_blendv_epi8(rounded, quiet, nan), 16);
+		}
+		else if constexpr (CT::Same<FROM, simde__m512>) {
+			const auto bits = simde_mm512_castps_si512(from);
+			const auto odd = simde_mm512_and_si512(simde_mm512_srli_epi32(bits, 16), simde_mm512_set1_epi32(1));
+			const auto rounded = simde_mm512_add_epi32(bits, simde_mm512_add_epi32(odd, simde_mm512_set1_epi32(0x7FFF)));
+			const auto nan = simde_mm512_cmp_ps_mask(from, from, _CMP_UNORD_Q);
+			return simde_mm512_srai_epi32(simde_mm512_mask_or_epi32(rounded, nan, bits, simde_mm512_set1_epi32(0x400000)), 16);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerRoundBFloat16");
+	}
+
+	/// Store single precision numbers, narrowing them to 16-bit real numbers	
+	/// Rounds to nearest even, like the Float16 and BFloat16 constructors		
+	///	@tparam T - Float16 or BFloat16													
+	///	@param from - the float register, decides how many are stored			
+	///	@param to - [out] where to store the numbers									
+	template<CT::RealHalf T, CT::TSIMD FROM>
+	LANGULUS(ALWAYSINLINE) void InnerStoreHalf(const FROM& from, T* to) noexcept {
+		constexpr Count N = sizeof(FROM) / sizeof(float);
+
+		if constexpr (CT::RealHP<T> && !LANGULUS_SIMD(F16C)) {
+			// No F16C, so do it the old way											
+			alignas(FROM) float wide[N];
+			if constexpr (CT::Same<FROM, simde__m128>)
+				simde_mm_store_ps(wide, from);
+			else if constexpr (CT::Same<FROM, simde__m256>)
+				simde_mm256_store_ps(wide, from);
+			else if constexpr (CT::Same<FROM, simde__m512>)
+				simde_mm512_store_ps(wide, from);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerStoreHalf");
+
+			for (Count i = 0; i < N; ++i)
+				to[i] = wide[i];
+		}
+		else if constexpr (CT::Same<FROM, simde__m128>) {
+			if constexpr (CT::RealHP<T>)
+				simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(to), simde_mm_cvtps_ph(from, _MM_FROUND_TO_NEAREST_INT));
+			else {
+				const auto rounded = InnerRoundBFloat16(from);
+				simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(to), simde_mm_packs_epi32(rounded, rounded));
+			}
+		}
+		else if constexpr (CT::Same<FROM, simde__m256>) {
+			if constexpr (CT::RealHP<T>)
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), simde_mm256_cvtps_ph(from, _MM_FROUND_TO_NEAREST_INT));
+			else {
+				const auto rounded = InnerRoundBFloat16(from);
+				const auto packed = simde_mm256_permute4x64_epi64(simde_mm256_packs_epi32(rounded, rounded), 0xD8);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), simde_mm256_castsi256_si128(packed));
+			}
+		}
+		else if constexpr (CT::Same<FROM, simde__m512>) {
+			if constexpr (CT::RealHP<T>)
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to), simde_mm512_cvtps_ph(from, _MM_FROUND_TO_NEAREST_INT));
+			else {
+				const auto rounded = InnerRoundBFloat16(from);
+				const auto packed = simde_mm512_permutexvar_epi64(
+					simde_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7),
+					simde_mm512_packs_epi32(rounded, rounded));
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to), simde_mm512_castsi512_si256(packed));
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerStoreHalf");
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,651 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::CT
+{
+
+	/// Numbers that ConvertSpan streams through 32-bit lanes						
+	template<class T>
+	concept Lane32 = Integer8<T> || Integer16<T> || Integer32<T> || RealSP<T> || RealHalf<T>;
+
+	/// Numbers that ConvertSpan streams through double precision lanes			
+	template<class T>
+	concept Lane64 = Integer64<T> || RealDP<T> || RealSP<T>;
+
+} // namespace Langulus::CT
+
+namespace Langulus::SIMD
+{
+
+	/// Convert a single number the same way ConvertSpan does						
+	/// Reals are rounded to the nearest integer, NaN becomes zero, and			
+	/// anything that doesn't fit the destination saturates to its limits		
+	///	@param from - the number to convert												
+	///	@return the converted number														
+	template<class TT, class FT>
+	NOD() LANGULUS(ALWAYSINLINE) TT ConvertFallback(const FT& from) noexcept {
+		using W = CT::Inner::Widened<FT>;
+		using L = ::std::numeric_limits<TT>;
+		const W value = static_cast<W>(from);
+
+		if constexpr (CT::Real<W> && CT::Integer<TT>) {
+			if (value != value)
+				return TT {0};
+
+			const W whole = ::std::nearbyint(value);
+			if (whole <= static_cast<W>(L::min()))
+				return L::min();
+			if (whole >= static_cast<W>(L::max()))
+				return L::max();
+			return static_cast<TT>(whole);
+		}
+		else if constexpr (CT::Integer<W> && CT::Integer<TT>) {
+			// Compare as 64-bit integers, character types included			
+			using WF = Conditional<CT::Signed<W>, ::std::int64_t, ::std::uint64_t>;
+			using WT = Conditional<CT::Signed<TT>, ::std::int64_t, ::std::uint64_t>;
+			if (::std::cmp_less(static_cast<WF>(value), static_cast<WT>(L::min())))
+				return L::min();
+			if (::std::cmp_greater(static_cast<WF>(value), static_cast<WT>(L::max())))
+				return L::max();
+			return static_cast<TT>(value);
+		}
+		else return static_cast<TT>(value);
+	}
+
+	/// Load numbers, widening them to 32-bit lanes of a float or an int32		
+	/// register - the work register decides how many are loaded					
+	///	@tparam RF - the float register to widen reals into						
+	///	@tparam RI - the integer register to widen integers into					
+	///	@param from - the numbers to load												
+	///	@return the widened numbers														
+	template<class RF, class RI, CT::Lane32 FT>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerConvertWiden(const FT* from) noexcept {
+		if constexpr (CT::RealHalf<FT>)
+			return InnerLoadHalf<FT, RF>(from);
+		else if constexpr (CT::RealSP<FT>) {
+			if constexpr (CT::Same<RF, simde__m128>)
+				return simde_mm_loadu_ps(from);
+			else if constexpr (CT::Same<RF, simde__m256>)
+				return simde_mm256_loadu_ps(from);
+			else if constexpr (CT::Same<RF, simde__m512>)
+				return simde_mm512_loadu_ps(from);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertWiden");
+		}
+		else if constexpr (CT::Integer32<FT>) {
+			if constexpr (CT::Same<RI, simde__m128i>)
+				return simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from));
+			else if constexpr (CT::Same<RI, simde__m256i>)
+				return simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from));
+			else if constexpr (CT::Same<RI, simde__m512i>)
+				return simde_mm512_loadu_si512(from);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertWiden");
+		}
+		else if constexpr (CT::Integer16<FT>) {
+			if constexpr (CT::Same<RI, simde__m128i>) {
+				const auto bits = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(from));
+				if constexpr (CT::Signed<FT>)
+					return simde_mm_cvtepi16_epi32(bits);
+				else
+					return simde_mm_cvtepu16_epi32(bits);
+			}
+			else if constexpr (CT::Same<RI, simde__m256i>) {
+				const auto bits = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from));
+				if constexpr (CT::Signed<FT>)
+					return simde_mm256_cvtepi16_epi32(bits);
+				else
+					return simde_mm256_cvtepu16_epi32(bits);
+			}
+			else if constexpr (CT::Same<RI, simde__m512i>) {
+				const auto bits = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from));
+				if constexpr (CT::Signed<FT>)
+					return simde_mm512_cvtepi16_epi32(bits);
+				else
+					return simde_mm512_cvtepu16_epi32(bits);
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertWiden");
+		}
+		else if constexpr (CT::Integer8<FT>) {
+			if constexpr (CT::Same<RI, simde__m128i>) {
+				::std::int32_t four;
+				::std::memcpy(&four, from, sizeof(four));
+				const auto bits = simde_mm_cvtsi32_si128(four);
+				if constexpr (CT::Signed<FT>)
+					return simde_mm_cvtepi8_epi32(bits);
+				else
+					return simde_mm_cvtepu8_epi32(bits);
+			}
+			else if constexpr (CT::Same<RI, simde__m256i>) {
+				const auto bits = simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(from));
+				if constexpr (CT::Signed<FT>)
+					return simde_mm256_cvtepi8_epi32(bits);
+				else
+					return simde_mm256_cvtepu8_epi32(bits);
+			}
+			else if constexpr (CT::Same<RI, simde__m512i>) {
+				const auto bits = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from));
+				if constexpr (CT::Signed<FT>)
+					return simde_mm512_cvtepi8_epi32(bits);
+				else
+					return simde_mm512_cvtepu8_epi32(bits);
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertWiden");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::InnerConvertWiden");
+	}
+
+	/// Convert 32-bit lanes from the widened FT to the widened TT					
+	/// Reals are rounded to nearest, NaN becomes zero, and anything that		
+	/// doesn't fit in TT is clamped, so that narrowing can saturate safely		
+	///	@param v - the widened numbers													
+	///	@return the converted numbers, still in 32-bit lanes						
+	template<CT::Lane32 TT, CT::Lane32 FT, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerConvertLanes(const R& v) noexcept {
+		constexpr bool FROM_REAL = CT::RealSP<FT> || CT::RealHalf<FT>;
+		constexpr bool TO_REAL = CT::RealSP<TT> || CT::RealHalf<TT>;
+
+		if constexpr (FROM_REAL && TO_REAL) {
+			// Both are in float lanes already										
+			return v;
+		}
+		else if constexpr (TO_REAL) {
+			// Integer lanes to float lanes											
+			if constexpr (CT::UnsignedInteger32<FT>) {
+				// Split in halves, so that the only rounding is in the add	
+				if constexpr (CT::Same<R, simde__m128i>) {
+					const auto hi = simde_mm_cvtepi32_ps(simde_mm_srli_epi32(v, 16));
+					const auto lo = simde_mm_cvtepi32_ps(simde_mm_and_si128(v, simde_mm_set1_epi32(0xFFFF)));
+					return simde_mm_add_ps(simde_mm_mul_ps(hi, simde_mm_set1_ps(65536.f)), lo);
+				}
+				else if constexpr (CT::Same<R, simde__m256i>) {
+					const auto hi = simde_mm256_cvtepi32_ps(simde_mm256_srli_epi32(v, 16));
+					const auto lo = simde_mm256_cvtepi32_ps(simde_mm256_and_si256(v, simde_mm256_set1_epi32(0xFFFF)));
+					return simde_mm256_add_ps(simde_mm256_mul_ps(hi, simde_mm256_set1_ps(65536.f)), lo);
+				}
+				else if constexpr (CT::Same<R, simde__m512i>)
+					return simde_mm512_cvtepu32_ps(v);
+				else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLanes");
+			}
+			else if constexpr (CT::Same<R, simde__m128i>)
+				return simde_mm_cvtepi32_ps(v);
+			else if constexpr (CT::Same<R, simde__m256i>)
+				return simde_mm256_cvtepi32_ps(v);
+			else if constexpr (CT::Same<R, simde__m512i>)
+				return simde_mm512_cvtepi32_ps(v);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLanes");
+		}
+		else if constexpr (FROM_REAL) {
+			// Float lanes to integer lanes - clamping before rounding is	
+			// the same as saturating after it. The 32-bit results are fixed
+			// after rounding instead, as their limits aren't whole floats	
+			using L = ::std::numeric_limits<TT>;
+			constexpr float lo = static_cast<float>(L::min());
+			constexpr float hi = static_cast<float>(L::max());
+			constexpr bool NARROW = sizeof(TT) < 4;
+
+			if constexpr (CT::Same<R, simde__m128>) {
+				auto x = simde_mm_max_ps(simde_mm_and_ps(v, simde_mm_cmpord_ps(v, v)), simde_mm_set1_ps(lo));
+				if constexpr (NARROW)
+					return simde_mm_cvtps_epi32(simde_mm_min_ps(x, simde_mm_set1_ps(hi)));
+				else if constexpr (CT::SignedInteger32<TT>) {
+					const auto over = simde_mm_cmpge_ps(x, simde_mm_set1_ps(2147483648.f));
+					return simde_mm_xor_si128(simde_mm_cvtps_epi32(x), simde_mm_castps_si128(over));
+				}
+				else {
+					const auto big = simde_mm_cmpge_ps(x, simde_mm_set1_ps(2147483648.f));
+					const auto over = simde_mm_cmpge_ps(x, simde_mm_set1_ps(4294967296.f));
+					const auto y = simde_mm_sub_ps(x, simde_mm_and_ps(big, simde_mm_set1_ps(2147483648.f)));
+					const auto r = simde_mm_xor_si128(simde_mm_cvtps_epi32(y), simde_mm_slli_epi32(simde_mm_castps_si128(big), 31));
+					return simde_mm_or_si128(r, simde_mm_castps_si128(over));
+				}
+			}
+			else if constexpr (CT::Same<R, simde__m256>) {
+				auto x = simde_mm256_max_ps(simde_mm256_and_ps(v, simde_mm256_cmp_ps(v, v, _CMP_ORD_Q)), simde_mm256_set1_ps(lo));
+				if constexpr (NARROW)
+					return simde_mm256_cvtps_epi32(simde_mm256_min_ps(x, simde_mm256_set1_ps(hi)));
+				else if constexpr (CT::SignedInteger32<TT>) {
+					const auto over = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(2147483648.f), _CMP_GE_OQ);
+					return simde_mm256_xor_si256(simde_mm256_cvtps_epi32(x), simde_mm256_castps_si256(over));
+				}
+				else {
+					const auto big = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(2147483648.f), _CMP_GE_OQ);
+					const auto over = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(4294967296.f), _CMP_GE_OQ);
+					const auto y = simde_mm256_sub_ps(x, simde_mm256_and_ps(big, simde_mm256_set1_ps(2147483648.f)));
+					const auto r = simde_mm256_xor_si256(simde_mm256_cvtps_epi32(y), simde_mm256_slli_epi32(simde_mm256_castps_si256(big), 31));
+					return simde_mm256_or_si256(r, simde_mm256_castps_si256(over));
+				}
+			}
+			else if constexpr (CT::Same<R, simde__m512>) {
+				auto x = simde_mm512_maskz_mov_ps(simde_mm512_cmp_ps_mask(v, v, _CMP_ORD_Q), v);
+				x = simde_mm512_max_ps(x, simde_mm512_set1_ps(lo));
+				if constexpr (NARROW)
+					return simde_mm512_cvtps_epi32(simde_mm512_min_ps(x, simde_mm512_set1_ps(hi)));
+				else if constexpr (CT::SignedInteger32<TT>) {
+					const auto over = simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(2147483648.f), _CMP_GE_OQ);
+					return simde_mm512_mask_mov_epi32(simde_mm512_cvtps_epi32(x), over, simde_mm512_set1_epi32(0x7FFFFFFF));
+				}
+				else {
+					const auto over = simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(4294967296.f), _CMP_GE_OQ);
+					return simde_mm512_mask_mov_epi32(simde_mm512_cvtps_epu32(x), over, simde_mm512_set1_epi32(-1));
+				}
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLanes");
+		}
+		else if constexpr (CT::UnsignedInteger32<FT> && !CT::UnsignedInteger32<TT>) {
+			// Integer lanes to integer lanes - big unsigned numbers would	
+			// look negative to the signed packs, so clamp them first		
+			constexpr auto hi = static_cast<::std::int32_t>(
+				::std::numeric_limits<TT>::max() < 0x7FFFFFFF ? ::std::numeric_limits<TT>::max() : 0x7FFFFFFF);
+			if constexpr (CT::Same<R, simde__m128i>)
+				return simde_mm_min_epu32(v, simde_mm_set1_epi32(hi));
+			else if constexpr (CT::Same<R, simde__m256i>)
+				return simde_mm256_min_epu32(v, simde_mm256_set1_epi32(hi));
+			else if constexpr (CT::Same<R, simde__m512i>)
+				return simde_mm512_min_epu32(v, simde_mm512_set1_epi32(hi));
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLanes");
+		}
+		else if constexpr (CT::Signed<FT> && CT::UnsignedInteger32<TT>) {
+			// Negative numbers would look big to unsigned 32-bit lanes		
+			if constexpr (CT::Same<R, simde__m128i>)
+				return simde_mm_max_epi32(v, simde_mm_setzero_si128());
+			else if constexpr (CT::Same<R, simde__m256i>)
+				return simde_mm256_max_epi32(v, simde_mm256_setzero_si256());
+			else if constexpr (CT::Same<R, simde__m512i>)
+				return simde_mm512_max_epi32(v, simde_mm512_setzero_si512());
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLanes");
+		}
+		else {
+			// The packs will saturate the rest while narrowing				
+			return v;
+		}
+	}
+
+	/// Narrow 32-bit lanes of several registers down to TT, and store them		
+	/// Eight and 16-bit integers are packed with saturation, so four or two	
+	/// registers make a single one, and the lanes are put back in order			
+	///	@param v - the registers to narrow, one for 32-bit types and reals	
+	///	@param to - [out] where to store the numbers									
+	template<CT::Lane32 TT, CT::TSIMD R, Count K>
+	LANGULUS(ALWAYSINLINE) void InnerConvertNarrow(const R(&v)[K], TT* to) noexcept {
+		if constexpr (CT::RealHalf<TT>)
+			InnerStoreHalf(v[0], to);
+		else if constexpr (CT::RealSP<TT>) {
+			if constexpr (CT::Same<R, simde__m128>)
+				simde_mm_storeu_ps(to, v[0]);
+			else if constexpr (CT::Same<R, simde__m256>)
+				simde_mm256_storeu_ps(to, v[0]);
+			else if constexpr (CT::Same<R, simde__m512>)
+				simde_mm512_storeu_ps(to, v[0]);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertNarrow");
+		}
+		else if constexpr (CT::Integer32<TT>) {
+			if constexpr (CT::Same<R, simde__m128i>)
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), v[0]);
+			else if constexpr (CT::Same<R, simde__m256i>)
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to), v[0]);
+			else if constexpr (CT::Same<R, simde__m512i>)
+				simde_mm512_storeu_si512(to, v[0]);
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertNarrow");
+		}
+		else if constexpr (CT::Integer16<TT>) {
+			static_assert(K == 2, "Two registers make one of 16-bit integers");
+			if constexpr (CT::Same<R, simde__m128i>) {
+				const auto packed = CT::Signed<TT>
+					? simde_mm_packs_epi32(v[0], v[1])
+					: simde_mm_packus_epi32(v[0], v[1]);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), packed);
+			}
+			else if constexpr (CT::Same<R, simde__m256i>) {
+				const auto packed = CT::Signed<TT>
+					? simde_mm256_packs_epi32(v[0], v[1])
+					: simde_mm256_packus_epi32(v[0], v[1]);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to),
+					simde_mm256_permute4x64_epi64(packed, 0xD8));
+			}
+			else if constexpr (CT::Same<R, simde__m512i>) {
+				const auto packed = CT::Signed<TT>
+					? simde_mm512_packs_epi32(v[0], v[1])
+					: simde_mm512_packus_epi32(v[0], v[1]);
+				simde_mm512_storeu_si512(to, simde_mm512_permutexvar_epi64(
+					simde_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), packed));
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertNarrow");
+		}
+		else if constexpr (CT::Integer8<TT>) {
+			static_assert(K == 4, "Four registers make one of 8-bit integers");
+			// Pack to signed 16-bit first, so that packus sees no garbage	
+			if constexpr (CT::Same<R, simde__m128i>) {
+				const auto ab = simde_mm_packs_epi32(v[0], v[1]);
+				const auto cd = simde_mm_packs_epi32(v[2], v[3]);
+				const auto packed = CT::Signed<TT>
+					? simde_mm_packs_epi16(ab, cd)
+					: simde_mm_packus_epi16(ab, cd);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), packed);
+			}
+			else if constexpr (CT::Same<R, simde__m256i>) {
+				const auto ab = simde_mm256_packs_epi32(v[0], v[1]);
+				const auto cd = simde_mm256_packs_epi32(v[2], v[3]);
+				const auto packed = CT::Signed<TT>
+					? simde_mm256_packs_epi16(ab, cd)
+					: simde_mm256_packus_epi16(ab, cd);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to), simde_mm256_permutevar8x32_epi32(
+					packed, simde_mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+			}
+			else if constexpr (CT::Same<R, simde__m512i>) {
+				const auto ab = simde_mm512_packs_epi32(v[0], v[1]);
+				const auto cd = simde_mm512_packs_epi32(v[2], v[3]);
+				const auto packed = CT::Signed<TT>
+					? simde_mm512_packs_epi16(ab, cd)
+					: simde_mm512_packus_epi16(ab, cd);
+				simde_mm512_storeu_si512(to, simde_mm512_permutexvar_epi32(
+					simde_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15), packed));
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertNarrow");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::InnerConvertNarrow");
+	}
+
+	/// Load numbers into double precision lanes											
+	///	@tparam RD - the double register, decides how many are loaded			
+	///	@param from - the numbers to load												
+	///	@return the numbers as doubles													
+	template<ConvertPolicy POLICY, class RD, CT::Lane64 FT>
+	NOD() LANGULUS(ALWAYSINLINE) RD InnerConvertLoad64(const FT* from) noexcept {
+		if constexpr (CT::Same<RD, simde__m128d>) {
+			if constexpr (CT::RealDP<FT>)
+				return simde_mm_loadu_pd(from);
+			else if constexpr (CT::RealSP<FT>)
+				return simde_mm_cvtps_pd(simde_mm_castsi128_ps(simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(from))));
+			else
+				return InnerConvertInt64<POLICY, FT>(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from)));
+		}
+		else if constexpr (CT::Same<RD, simde__m256d>) {
+			if constexpr (CT::RealDP<FT>)
+				return simde_mm256_loadu_pd(from);
+			else if constexpr (CT::RealSP<FT>)
+				return simde_mm256_cvtps_pd(simde_mm_loadu_ps(from));
+			else
+				return InnerConvertInt64<POLICY, FT>(simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from)));
+		}
+		else if constexpr (CT::Same<RD, simde__m512d>) {
+			if constexpr (CT::RealDP<FT>)
+				return simde_mm512_loadu_pd(from);
+			else if constexpr (CT::RealSP<FT>)
+				return simde_mm512_cvtps_pd(simde_mm256_loadu_ps(from));
+			else
+				return InnerConvertInt64<POLICY, FT>(simde_mm512_loadu_si512(from));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLoad64");
+	}
+
+	/// Store double precision lanes, converting them to TT							
+	///	@param v - the doubles to store													
+	///	@param to - [out] where to store the numbers									
+	template<ConvertPolicy POLICY, CT::Lane64 TT, CT::TSIMD RD>
+	LANGULUS(ALWAYSINLINE) void InnerConvertStore64(const RD& v, TT* to) noexcept {
+		if constexpr (CT::Same<RD, simde__m128d>) {
+			if constexpr (CT::RealDP<TT>)
+				simde_mm_storeu_pd(to, v);
+			else if constexpr (CT::RealSP<TT>)
+				simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(to), simde_mm_castps_si128(simde_mm_cvtpd_ps(v)));
+			else {
+				const auto integers = InnerConvertToInt64<POLICY, TT>(v);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(to), integers);
+			}
+		}
+		else if constexpr (CT::Same<RD, simde__m256d>) {
+			if constexpr (CT::RealDP<TT>)
+				simde_mm256_storeu_pd(to, v);
+			else if constexpr (CT::RealSP<TT>)
+				simde_mm_storeu_ps(to, simde_mm256_cvtpd_ps(v));
+			else {
+				const auto integers = InnerConvertToInt64<POLICY, TT>(v);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(to), integers);
+			}
+		}
+		else if constexpr (CT::Same<RD, simde__m512d>) {
+			if constexpr (CT::RealDP<TT>)
+				simde_mm512_storeu_pd(to, v);
+			else if constexpr (CT::RealSP<TT>)
+				simde_mm256_storeu_ps(to, simde_mm512_cvtpd_ps(v));
+			else {
+				const auto integers = InnerConvertToInt64<POLICY, TT>(v);
+				simde_mm512_storeu_si512(to, integers);
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertStore64");
+	}
+
+	/// Convert 64-bit integers to floats, rounding only once, and store them	
+	///	@tparam RD - the double register, decides how many are converted		
+	///	@param from - the integers to convert											
+	///	@param to - [out] where to store the floats									
+	template<ConvertPolicy POLICY, class RD, CT::Integer64 FT>
+	LANGULUS(ALWAYSINLINE) void InnerConvertInt64ToFloats(const FT* from, float* to) noexcept {
+		if constexpr (CT::Same<RD, simde__m128d>) {
+			const auto floats = InnerConvertInt64ToFloat<POLICY, FT>(
+				simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from)));
+			simde_mm_storel_epi64(reinterpret_cast<simde__m128i*>(to), simde_mm_castps_si128(floats));
+		}
+		else if constexpr (CT::Same<RD, simde__m256d>) {
+			simde_mm_storeu_ps(to, InnerConvertInt64ToFloat<POLICY, FT>(
+				simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from))));
+		}
+		else if constexpr (CT::Same<RD, simde__m512d>) {
+			const auto integers = simde_mm512_loadu_si512(from);
+			if constexpr (CT::SignedInteger64<FT>)
+				simde_mm256_storeu_ps(to, simde_mm512_cvtepi64_ps(integers));
+			else
+				simde_mm256_storeu_ps(to, simde_mm512_cvtepu64_ps(integers));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertInt64ToFloats");
+	}
+
+	/// Convert 32-bit integer lanes to doubles, and store them					
+	/// Each half of the register makes a register of doubles						
+	///	@tparam UNSIGNED - true if lanes are uint32_t - their top bit is		
+	///		flipped, so they fit cvtepi32_pd, and 2^31 is added back after		
+	///	@param v - the integers to convert												
+	///	@param to - [out] where to store the doubles									
+	template<bool UNSIGNED, CT::TSIMD RI>
+	LANGULUS(ALWAYSINLINE) void InnerConvertStoreDoubles(const RI& v, double* to) noexcept {
+		if constexpr (CT::Same<RI, simde__m128i>) {
+			const auto x = UNSIGNED ? simde_mm_xor_si128(v, simde_mm_set1_epi32(INT32_MIN)) : v;
+			auto lo = simde_mm_cvtepi32_pd(x);
+			auto hi = simde_mm_cvtepi32_pd(simde_mm_unpackhi_epi64(x, x));
+			if constexpr (UNSIGNED) {
+				lo = simde_mm_add_pd(lo, simde_mm_set1_pd(2147483648.0));
+				hi = simde_mm_add_pd(hi, simde_mm_set1_pd(2147483648.0));
+			}
+			simde_mm_storeu_pd(to, lo);
+			simde_mm_storeu_pd(to + 2, hi);
+		}
+		else if constexpr (CT::Same<RI, simde__m256i>) {
+			const auto x = UNSIGNED ? simde_mm256_xor_si256(v, simde_mm256_set1_epi32(INT32_MIN)) : v;
+			auto lo = simde_mm256_cvtepi32_pd(simde_mm256_castsi256_si128(x));
+			auto hi = simde_mm256_cvtepi32_pd(simde_mm256_extractf128_si256(x, 1));
+			if constexpr (UNSIGNED) {
+				lo = simde_mm256_add_pd(lo, simde_mm256_set1_pd(2147483648.0));
+				hi = simde_mm256_add_pd(hi, simde_mm256_set1_pd(2147483648.0));
+			}
+			simde_mm256_storeu_pd(to, lo);
+			simde_mm256_storeu_pd(to + 4, hi);
+		}
+		else if constexpr (CT::Same<RI, simde__m512i>) {
+			if constexpr (UNSIGNED) {
+				simde_mm512_storeu_pd(to, simde_mm512_cvtepu32_pd(simde_mm512_castsi512_si256(v)));
+				simde_mm512_storeu_pd(to + 8, simde_mm512_cvtepu32_pd(simde_mm512_extracti64x4_epi64(v, 1)));
+			}
+			else {
+				simde_mm512_storeu_pd(to, simde_mm512_cvtepi32_pd(simde_mm512_castsi512_si256(v)));
+				simde_mm512_storeu_pd(to + 8, simde_mm512_cvtepi32_pd(simde_mm512_extracti64x4_epi64(v, 1)));
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertStoreDoubles");
+	}
+
+	/// Load two registers of doubles, and convert them to 32-bit integer		
+	/// lanes of a single register, ready to be narrowed to TT						
+	/// NaN becomes zero, and the rest is clamped to TT - its limits are whole	
+	/// doubles, so clamping before rounding is the same as saturating after	
+	/// Unsigned 32-bit results are shifted down by 2^31 to fit cvtpd_epi32,	
+	/// and get their top bit flipped back after										
+	///	@tparam RI - the integer register, decides how many are loaded			
+	///	@param from - the doubles to load												
+	///	@return the converted numbers, in 32-bit lanes								
+	template<CT::Lane32 TT, class RI>
+	NOD() LANGULUS(ALWAYSINLINE) RI InnerConvertLoadDoubles(const double* from) noexcept {
+		using L = ::std::numeric_limits<TT>;
+		constexpr double lo = static_cast<double>(L::min());
+		constexpr double hi = static_cast<double>(L::max());
+		constexpr bool UNSIGNED = CT::UnsignedInteger32<TT>;
+		constexpr double shift = UNSIGNED ? 2147483648.0 : 0.0;
+
+		if constexpr (CT::Same<RI, simde__m128i>) {
+			const auto round = [](const double* f) noexcept {
+				const auto v = simde_mm_loadu_pd(f);
+				const auto x = simde_mm_min_pd(simde_mm_max_pd(simde_mm_and_pd(v, simde_mm_cmpord_pd(v, v)),
+					simde_mm_set1_pd(lo)), simde_mm_set1_pd(hi));
+				return simde_mm_cvtpd_epi32(simde_mm_sub_pd(x, simde_mm_set1_pd(shift)));
+			};
+			const auto r = simde_mm_unpacklo_epi64(round(from), round(from + 2));
+			return UNSIGNED ? simde_mm_xor_si128(r, simde_mm_set1_epi32(INT32_MIN)) : r;
+		}
+		else if constexpr (CT::Same<RI, simde__m256i>) {
+			const auto round = [](const double* f) noexcept {
+				const auto v = simde_mm256_loadu_pd(f);
+				const auto x = simde_mm256_min_pd(simde_mm256_max_pd(simde_mm256_and_pd(v, simde_mm256_cmp_pd(v, v, _CMP_ORD_Q)),
+					simde_mm256_set1_pd(lo)), simde_mm256_set1_pd(hi));
+				return simde_mm256_cvtpd_epi32(simde_mm256_sub_pd(x, simde_mm256_set1_pd(shift)));
+			};
+			const auto r = simde_mm256_set_m128i(round(from + 4), round(from));
+			return UNSIGNED ? simde_mm256_xor_si256(r, simde_mm256_set1_epi32(INT32_MIN)) : r;
+		}
+		else if constexpr (CT::Same<RI, simde__m512i>) {
+			const auto round = [](const double* f) noexcept {
+				const auto v = simde_mm512_loadu_pd(f);
+				const auto x = simde_mm512_min_pd(simde_mm512_max_pd(simde_mm512_maskz_mov_pd(simde_mm512_cmp_pd_mask(v, v, _CMP_ORD_Q), v),
+					simde_mm512_set1_pd(lo)), simde_mm512_set1_pd(hi));
+				return simde_mm512_cvtpd_epi32(simde_mm512_sub_pd(x, simde_mm512_set1_pd(shift)));
+			};
+			const auto r = simde_mm512_inserti64x4(simde_mm512_castsi256_si512(round(from)), round(from + 8), 1);
+			return UNSIGNED ? simde_mm512_xor_si512(r, simde_mm512_set1_epi32(INT32_MIN)) : r;
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertLoadDoubles");
+	}
+
+	/// Stream elements through a conversion step, that consumes and produces	
+	/// N of them at a time. The tail is padded with zeroes inside temporary	
+	/// arrays, so that it gets the exact same treatment								
+	///	@param in - the first input element												
+	///	@param out - the first output element											
+	///	@param count - number of elements to stream									
+	///	@param step - the function to invoke on each N elements					
+	template<Count N, class FT, class TT, class F>
+	LANGULUS(ALWAYSINLINE) void StreamConvert(const FT* in, TT* out, Count count, F&& step) noexcept {
+		Count i = 0;
+		for (; i + N <= count; i += N)
+			step(in + i, out + i);
+
+		if (i < count) {
+			FT tempIn[N] {};
+			TT tempOut[N];
+			::std::memcpy(tempIn, in + i, (count - i) * sizeof(FT));
+			step(tempIn, tempOut);
+			::std::memcpy(out + i, tempOut, (count - i) * sizeof(TT));
+		}
+	}
+
+	/// Convert a span of numbers to another type, in bulk							
+	/// Narrowing packs several input registers into each output register,		
+	/// for example four float registers make a single one of 8-bit integers	
+	/// Reals are rounded to nearest, NaN becomes zero, and integer results		
+	/// saturate to the range of the output type. The only exception are			
+	/// doubles out of the 64-bit integer range, which give unspecified results
+	/// Half precision reals go through single precision, 64-bit integers go	
+	/// through doubles, as the policy says, except when converted to floats,	
+	/// which are rounded only once. Smaller integers to doubles and back go	
+	/// through 32-bit lanes, two double registers for each. The rest is done	
+	/// the old way																				
+	///	@tparam POLICY - the conversion options, see ConvertPolicy				
+	///	@param input - the numbers to convert											
+	///	@param output - [out] the converted numbers, must not overlap input	
+	template<ConvertPolicy POLICY = {}, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void ConvertSpan(IN&& input, OUT&& output) noexcept {
+		using FT = Decay<SpanType<IN>>;
+		using TT = Decay<SpanType<OUT>>;
+		using RF = MaxRegister<float>;
+		using RI = MaxRegister<::std::int32_t>;
+		using RD = MaxRegister<double>;
+		const FT* in = ::std::ranges::data(input);
+		TT* out = ::std::ranges::data(output);
+		const Count count = OverlapCount(input, output);
+
+		if constexpr (CT::Same<FT, TT>) {
+			// Nothing to convert														
+			::std::memcpy(out, in, count * sizeof(TT));
+		}
+		else if constexpr (CT::Lane32<FT> && CT::Lane32<TT> && !CT::NotSupported<RF> && MaxLanes<float> > 1) {
+			// Widen to 32-bit lanes, convert, and narrow back					
+			constexpr Count W = MaxLanes<float>;
+			constexpr Count K = CT::Integer8<TT> ? 4 : CT::Integer16<TT> ? 2 : 1;
+			StreamConvert<K * W>(in, out, count, [](const FT* from, TT* to) noexcept {
+				using WORK = decltype(InnerConvertLanes<TT, FT>(InnerConvertWiden<RF, RI>(from)));
+				WORK work[K];
+				for (Count k = 0; k < K; ++k)
+					work[k] = InnerConvertLanes<TT, FT>(InnerConvertWiden<RF, RI>(from + k * W));
+				InnerConvertNarrow(work, to);
+			});
+		}
+		else if constexpr (CT::Integer64<FT> && CT::RealSP<TT> && !CT::NotSupported<RD> && MaxLanes<double> > 1) {
+			// Going through double precision lanes would round twice			
+			StreamConvert<MaxLanes<double>>(in, out, count, [](const FT* from, TT* to) noexcept {
+				InnerConvertInt64ToFloats<POLICY, RD>(from, to);
+			});
+		}
+		else if constexpr (CT::Lane64<FT> && CT::Lane64<TT> && !(CT::Integer64<FT> && CT::Integer64<TT>)
+		&& !CT::NotSupported<RD> && MaxLanes<double> > 1) {
+			// Go through double precision lanes									
+			StreamConvert<MaxLanes<double>>(in, out, count, [](const FT* from, TT* to) noexcept {
+				InnerConvertStore64<POLICY>(InnerConvertLoad64<POLICY, RD>(from), to);
+			});
+		}
+		else if constexpr ((CT::Integer8<FT> || CT::Integer16<FT> || CT::Integer32<FT>) && CT::RealDP<TT>
+		&& !CT::NotSupported<RI> && MaxLanes<double> > 1) {
+			// Widen to 32-bit lanes, and convert each half to doubles		
+			StreamConvert<MaxLanes<::std::int32_t>>(in, out, count, [](const FT* from, TT* to) noexcept {
+				InnerConvertStoreDoubles<CT::UnsignedInteger32<FT>>(InnerConvertWiden<RF, RI>(from), to);
+			});
+		}
+		else if constexpr (CT::RealDP<FT> && (CT::Integer8<TT> || CT::Integer16<TT> || CT::Integer32<TT>)
+		&& !CT::NotSupported<RI> && MaxLanes<double> > 1) {
+			// Convert pairs of double registers to 32-bit lanes, and narrow	
+			constexpr Count W = MaxLanes<::std::int32_t>;
+			constexpr Count K = CT::Integer8<TT> ? 4 : CT::Integer16<TT> ? 2 : 1;
+			StreamConvert<K * W>(in, out, count, [](const FT* from, TT* to) noexcept {
+				RI work[K];
+				for (Count k = 0; k < K; ++k)
+					work[k] = InnerConvertLoadDoubles<TT, RI>(from + k * W);
+				InnerConvertNarrow(work, to);
+			});
+		}
+		else {
+			// No SIMD for these, so do it the old way							
+			for (Count i = 0; i < count; ++i)
+				out[i] = ConvertFallback<TT>(in[i]);
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
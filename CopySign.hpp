@@ -0,0 +1,151 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Store.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto CopySignInner(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Combine the magnitudes of lhs with the signs of rhs using SIMD			
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the magnitudes														
+	///	@param rhs - the signs																
+	///	@return the combined elements as a register									
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto CopySignInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::CopySignInner doesn't work for whole numbers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					const auto mask = simde_mm_set1_ps(-0.0F);
+					return simde_mm_or_ps(simde_mm_andnot_ps(mask, lhs), simde_mm_and_ps(mask, rhs));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					const auto mask = simde_mm_set1_pd(-0.0);
+					return simde_mm_or_pd(simde_mm_andnot_pd(mask, lhs), simde_mm_and_pd(mask, rhs));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::CopySignInner of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					const auto mask = simde_mm256_set1_ps(-0.0F);
+					return simde_mm256_or_ps(simde_mm256_andnot_ps(mask, lhs), simde_mm256_and_ps(mask, rhs));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					const auto mask = simde_mm256_set1_pd(-0.0);
+					return simde_mm256_or_pd(simde_mm256_andnot_pd(mask, lhs), simde_mm256_and_pd(mask, rhs));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::CopySignInner of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					const auto mask = simde_mm512_set1_ps(-0.0F);
+					return simde_mm512_or_ps(simde_mm512_andnot_ps(mask, lhs), simde_mm512_and_ps(mask, rhs));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					const auto mask = simde_mm512_set1_pd(-0.0);
+					return simde_mm512_or_pd(simde_mm512_andnot_pd(mask, lhs), simde_mm512_and_pd(mask, rhs));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::CopySignInner of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::CopySignInner");
+	}
+
+	///																								
+	template<class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) auto CopySign(const LHS& lhsOrig, const RHS& rhsOrig) noexcept {
+		using REGISTER = CT::Register<LHS, RHS>;
+		using LOSSLESS = CT::Lossless<LHS, RHS>;
+		constexpr auto S = OverlapCount<LHS, RHS>();
+		return AttemptSIMD<0, REGISTER, LOSSLESS>(
+			lhsOrig, rhsOrig,
+			[](const REGISTER& lhs, const REGISTER& rhs) noexcept {
+				return CopySignInner<LOSSLESS, S>(lhs, rhs);
+			},
+			[](const LOSSLESS& lhs, const LOSSLESS& rhs) noexcept -> LOSSLESS {
+				return ::std::copysign(lhs, rhs);
+			}
+		);
+	}
+
+	///																								
+	template<class LHS, class RHS, class OUT>
+	LANGULUS(ALWAYSINLINE) void CopySign(const LHS& lhs, const RHS& rhs, OUT& output) noexcept {
+		const auto result = CopySign<LHS, RHS>(lhs, rhs);
+		if constexpr (CT::TSIMD<decltype(result)>) {
+			// Extract from register													
+			Store(result, output);
+		}
+		else if constexpr (!CT::Array<OUT>) {
+			// Extract from number														
+			output = result;
+		}
+		else {
+			// Extract from std::array													
+			StoreFallback(result, output);
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER CopySignWrap(const LHS& lhs, const RHS& rhs) noexcept {
+		WRAPPER result;
+		CopySign<LHS, RHS>(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Combine the magnitudes of one span with the signs of another				
+	///	@param lhs - the magnitudes														
+	///	@param rhs - the signs																
+	///	@param output - [out] the combined numbers									
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void CopySignSpan(LHS&& lhs, RHS&& rhs, OUT&& output) noexcept {
+		using T = SpanType<LHS>;
+		static_assert(CT::Same<T, SpanType<RHS>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		const auto count = OverlapCount(lhs, rhs);
+		StreamBinary<0>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs), ::std::ranges::data(output),
+			count < ::std::ranges::size(output) ? count : ::std::ranges::size(output),
+			[](const REGISTER& l, const REGISTER& r) noexcept {
+				return CopySignInner<T, MaxLanes<T>>(l, r);
+			},
+			[](const T& l, const T& r) noexcept -> T {
+				return ::std::copysign(l, r);
+			}
+		);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,147 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Multiply.hpp"
+#include "Subtract.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerCross(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the cross product of two 3D vectors via SIMD, by rotating the		
+	/// components to yzx order, instead of doing it twice for each operand		
+	/// The fourth component of the result is always zero								
+	///	@tparam T - the type of the vector components								
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left vector														
+	///	@param rhs - the right vector														
+	///	@return the cross product															
+	template<class T, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerCross(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerCross is implemented only for real numbers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					const auto lhsYZX = simde_mm_shuffle_ps(lhs, lhs, Shuffle(3, 0, 2, 1));
+					const auto rhsYZX = simde_mm_shuffle_ps(rhs, rhs, Shuffle(3, 0, 2, 1));
+					const auto zxy = simde_mm_sub_ps(simde_mm_mul_ps(lhs, rhsYZX), simde_mm_mul_ps(lhsYZX, rhs));
+					return simde_mm_shuffle_ps(zxy, zxy, Shuffle(3, 0, 2, 1));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerCross of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealDP<T>) {
+					const auto lhsYZX = simde_mm256_permute4x64_pd(lhs, Shuffle(3, 0, 2, 1));
+					const auto rhsYZX = simde_mm256_permute4x64_pd(rhs, Shuffle(3, 0, 2, 1));
+					const auto zxy = simde_mm256_sub_pd(simde_mm256_mul_pd(lhs, rhsYZX), simde_mm256_mul_pd(lhsYZX, rhs));
+					return simde_mm256_permute4x64_pd(zxy, Shuffle(3, 0, 2, 1));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerCross of 32-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerCross");
+	}
+
+	/// Get the cross product of two 3D vectors											
+	/// If the vectors have a fourth component, it is set to zero in the output
+	///	@param lhs - the left vector														
+	///	@param rhs - the right vector														
+	///	@param output - [out] the cross product										
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Cross(const T(&lhs)[S], const T(&rhs)[S], T(&output)[S]) noexcept {
+		static_assert(S == 3 || S == 4, "Cross product is defined only for 3D vectors");
+		using REGISTER = decltype(Load<0>(lhs));
+		if constexpr (CT::Real<T> && !CT::NotSupported<REGISTER>) {
+			Store(InnerCross<T>(Load<0>(lhs), Load<0>(rhs)), output);
+		}
+		else {
+			const T x = lhs[1] * rhs[2] - lhs[2] * rhs[1];
+			const T y = lhs[2] * rhs[0] - lhs[0] * rhs[2];
+			const T z = lhs[0] * rhs[1] - lhs[1] * rhs[0];
+			output[0] = x;
+			output[1] = y;
+			output[2] = z;
+			if constexpr (S == 4)
+				output[3] = T {0};
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class T, Count S>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER CrossWrap(const T(&lhs)[S], const T(&rhs)[S]) noexcept {
+		WRAPPER result;
+		Cross(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Get the cross products of a batch of 3D vectors, stored as structure	
+	/// of arrays - one span per component													
+	///	@param lhs - the left components													
+	///	@param rhs - the right components												
+	///	@param output - [out] the cross product components (can be an input)	
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void CrossSpan(const IN(&lhs)[3], const IN(&rhs)[3], OUT(&output)[3]) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = ::std::ranges::size(output[0]);
+		for (Count c = 0; c < 3; ++c) {
+			count = ::std::ranges::size(output[c]) < count ? ::std::ranges::size(output[c]) : count;
+			count = OverlapCount(lhs[c], rhs[c]) < count ? OverlapCount(lhs[c], rhs[c]) : count;
+		}
+
+		const T* l[3] {::std::ranges::data(lhs[0]), ::std::ranges::data(lhs[1]), ::std::ranges::data(lhs[2])};
+		const T* r[3] {::std::ranges::data(rhs[0]), ::std::ranges::data(rhs[1]), ::std::ranges::data(rhs[2])};
+		T* o[3] {::std::ranges::data(output[0]), ::std::ranges::data(output[1]), ::std::ranges::data(output[2])};
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			const auto load = [](const T* from) noexcept {
+				return Load<0>(reinterpret_cast<const CHUNK&>(*from));
+			};
+
+			for (; i + L <= count; i += L) {
+				const REGISTER lx = load(l[0] + i), ly = load(l[1] + i), lz = load(l[2] + i);
+				const REGISTER rx = load(r[0] + i), ry = load(r[1] + i), rz = load(r[2] + i);
+				Store(SubtractInner<T, L>(MultiplyInner<T, L>(ly, rz), MultiplyInner<T, L>(lz, ry)), reinterpret_cast<CHUNK&>(o[0][i]));
+				Store(SubtractInner<T, L>(MultiplyInner<T, L>(lz, rx), MultiplyInner<T, L>(lx, rz)), reinterpret_cast<CHUNK&>(o[1][i]));
+				Store(SubtractInner<T, L>(MultiplyInner<T, L>(lx, ry), MultiplyInner<T, L>(ly, rx)), reinterpret_cast<CHUNK&>(o[2][i]));
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const T x = l[1][i] * r[2][i] - l[2][i] * r[1][i];
+			const T y = l[2][i] * r[0][i] - l[0][i] * r[2][i];
+			const T z = l[0][i] * r[1][i] - l[1][i] * r[0][i];
+			o[0][i] = x;
+			o[1][i] = y;
+			o[2][i] = z;
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,181 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Add.hpp"
+#include "Multiply.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Sum all elements inside a register													
+	///	@tparam T - the type of the elements											
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the register to sum												
+	///	@return the sum of all elements													
+	template<class T, CT::TSIMD REGISTER>
+	NOD() LANGULUS(ALWAYSINLINE) T InnerHorizontalAdd(const REGISTER& value) noexcept {
+		static_assert(CT::Real<T> || CT::Integer32<T>,
+			"SIMD::InnerHorizontalAdd is implemented only for real numbers and 32-bit integers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					const auto pairs = simde_mm_add_ps(value, simde_mm_movehl_ps(value, value));
+					return simde_mm_cvtss_f32(simde_mm_add_ss(pairs, simde_mm_movehdup_ps(pairs)));
+				}
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_cvtsd_f64(simde_mm_add_sd(value, simde_mm_unpackhi_pd(value, value)));
+				else if constexpr (CT::Integer32<T>) {
+					const auto pairs = simde_mm_add_epi32(value, simde_mm_shuffle_epi32(value, 0x4E));
+					return static_cast<T>(simde_mm_cvtsi128_si32(simde_mm_add_epi32(pairs, simde_mm_shuffle_epi32(pairs, 0xB1))));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerHorizontalAdd of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					return InnerHorizontalAdd<T>(simde_mm_add_ps(
+						simde_mm256_castps256_ps128(value),
+						simde_mm256_extractf128_ps(value, 1)
+					));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					return InnerHorizontalAdd<T>(simde_mm_add_pd(
+						simde_mm256_castpd256_pd128(value),
+						simde_mm256_extractf128_pd(value, 1)
+					));
+				}
+				else if constexpr (CT::Integer32<T>) {
+					return InnerHorizontalAdd<T>(simde_mm_add_epi32(
+						simde_mm256_castsi256_si128(value),
+						simde_mm256_extracti128_si256(value, 1)
+					));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerHorizontalAdd of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm512_reduce_add_ps(value);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm512_reduce_add_pd(value);
+				else if constexpr (CT::Integer32<T>)
+					return static_cast<T>(simde_mm512_reduce_add_epi32(value));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerHorizontalAdd of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerHorizontalAdd");
+	}
+
+	/// Get the dot product of two registers												
+	/// Elements outside S must be zero in at least one of the registers			
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left vector														
+	///	@param rhs - the right vector														
+	///	@return the dot product																
+	template<class T, Count S, CT::TSIMD REGISTER>
+	NOD() LANGULUS(ALWAYSINLINE) T InnerDot(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerDot is implemented only for real numbers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				// A single dpps/dppd does the job									
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_cvtss_f32(simde_mm_dp_ps(lhs, rhs, 0xF1));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_cvtsd_f64(simde_mm_dp_pd(lhs, rhs, 0x31));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerDot of 16-byte package");
+			}
+			else
+		#endif
+
+		return InnerHorizontalAdd<T>(MultiplyInner<T, S>(lhs, rhs));
+	}
+
+	/// Get the dot product of two vectors													
+	///	@param lhs - the left vector														
+	///	@param rhs - the right vector														
+	///	@return the dot product																
+	template<class T, Count S>
+	NOD() LANGULUS(ALWAYSINLINE) T Dot(const T(&lhs)[S], const T(&rhs)[S]) noexcept {
+		using REGISTER = decltype(Load<0>(lhs));
+		if constexpr (CT::NotSupported<REGISTER>) {
+			T result {};
+			for (Count i = 0; i < S; ++i)
+				result += lhs[i] * rhs[i];
+			return result;
+		}
+		else return InnerDot<T, S>(Load<0>(lhs), Load<0>(rhs));
+	}
+
+	/// Get the dot products of a batch of vectors, stored as structure of		
+	/// arrays - one span per component. Each register processes as many			
+	/// vectors as it has lanes, and no horizontal operations are involved		
+	///	@tparam C - number of components (deducible)									
+	///	@param lhs - the left components													
+	///	@param rhs - the right components												
+	///	@param output - [out] the dot products											
+	template<Count C, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void DotSpan(const IN(&lhs)[C], const IN(&rhs)[C], OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = ::std::ranges::size(output);
+		for (Count c = 0; c < C; ++c) {
+			count = OverlapCount(lhs[c], rhs[c]) < count
+				? OverlapCount(lhs[c], rhs[c]) : count;
+		}
+
+		auto out = ::std::ranges::data(output);
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			for (; i + L <= count; i += L) {
+				auto accumulator = MultiplyInner<T, L>(
+					Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(lhs[0])[i])),
+					Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(rhs[0])[i]))
+				);
+
+				for (Count c = 1; c < C; ++c) {
+					accumulator = AddInner<T, L>(accumulator, MultiplyInner<T, L>(
+						Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(lhs[c])[i])),
+						Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(rhs[c])[i]))
+					));
+				}
+
+				Store(accumulator, reinterpret_cast<CHUNK&>(out[i]));
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			T result {};
+			for (Count c = 0; c < C; ++c)
+				result += ::std::ranges::data(lhs[c])[i] * ::std::ranges::data(rhs[c])[i];
+			out[i] = result;
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -22,6 +22,8 @@ namespace Langulus::SIMD
 		auto& value = MakeDense(valueOrig);
 		if constexpr (CT::Same<REGISTER,T>)
 			return value;
+		else if constexpr (CT::FixedPoint<T>)
+			return Fill<REGISTER>(value.mBits);
 		else if constexpr (CT::Same<REGISTER,simde__m128i>) {
 			if constexpr (CT::Integer8<T>)
 				return simde_mm_set1_epi8(value);
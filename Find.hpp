@@ -0,0 +1,381 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Max.hpp"
+#include "Min.hpp"
+#include "Span.hpp"
+#include <bit>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Size of the registers used for searching, in bytes							
+	/// Searching relies on byte movemasks, which stop at 256 bits					
+	constexpr Size SearchRegisterSize =
+		LANGULUS_SIMD(256BIT) ? 32 :
+		LANGULUS_SIMD(128BIT) ? 16 : 0;
+
+	/// Integer register type used for searching											
+	#if LANGULUS_SIMD(256BIT)
+		using SearchRegister = simde__m256i;
+	#elif LANGULUS_SIMD(128BIT)
+		using SearchRegister = simde__m128i;
+	#endif
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Load a search register from unaligned memory								
+		///	@param from - the first element												
+		///	@return the loaded register													
+		template<class T>
+		NOD() LANGULUS(ALWAYSINLINE) SearchRegister InnerSearchLoad(const T* from) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				return simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(from));
+			#else
+				return simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(from));
+			#endif
+		}
+
+		/// Load a search register from aligned memory									
+		///	@param from - the first byte, aligned to SearchRegisterSize			
+		///	@return the loaded register													
+		template<class T>
+		NOD() LANGULUS(ALWAYSINLINE) SearchRegister InnerSearchLoadAligned(const T* from) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				return simde_mm256_load_si256(reinterpret_cast<const simde__m256i*>(from));
+			#else
+				return simde_mm_load_si128(reinterpret_cast<const simde__m128i*>(from));
+			#endif
+		}
+
+		/// Fill a search register with a single value									
+		///	@param value - the value to fill with										
+		///	@return the filled register													
+		template<class T>
+		NOD() LANGULUS(ALWAYSINLINE) SearchRegister InnerSearchFill(const T& value) noexcept {
+			T lanes[SearchRegisterSize / sizeof(T)];
+			for (auto& lane : lanes)
+				lane = value;
+			return InnerSearchLoad(lanes);
+		}
+
+		/// Get a bitmask with a bit set for every byte of every element in		
+		/// haystack that is equal to the corresponding element in needle			
+		///	@param haystack - the elements to search									
+		///	@param needle - the elements to search for								
+		///	@return sizeof(T) bits for each matching element						
+		template<class T>
+		NOD() LANGULUS(ALWAYSINLINE) ::std::uint32_t InnerFindMask(const SearchRegister& haystack, const SearchRegister& needle) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				if constexpr (CT::RealSP<T>) {
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_castps_si256(simde_mm256_cmp_ps(
+						simde_mm256_castsi256_ps(haystack), simde_mm256_castsi256_ps(needle), _CMP_EQ_OQ))));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_castpd_si256(simde_mm256_cmp_pd(
+						simde_mm256_castsi256_pd(haystack), simde_mm256_castsi256_pd(needle), _CMP_EQ_OQ))));
+				}
+				else if constexpr (sizeof(T) == 1)
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi8(haystack, needle)));
+				else if constexpr (sizeof(T) == 2)
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi16(haystack, needle)));
+				else if constexpr (sizeof(T) == 4)
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi32(haystack, needle)));
+				else if constexpr (sizeof(T) == 8)
+					return static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi64(haystack, needle)));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerFindMask of 32-byte package");
+			#else
+				if constexpr (CT::RealSP<T>) {
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_castps_si128(simde_mm_cmpeq_ps(
+						simde_mm_castsi128_ps(haystack), simde_mm_castsi128_ps(needle)))));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_castpd_si128(simde_mm_cmpeq_pd(
+						simde_mm_castsi128_pd(haystack), simde_mm_castsi128_pd(needle)))));
+				}
+				else if constexpr (sizeof(T) == 1)
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_cmpeq_epi8(haystack, needle)));
+				else if constexpr (sizeof(T) == 2)
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_cmpeq_epi16(haystack, needle)));
+				else if constexpr (sizeof(T) == 4)
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_cmpeq_epi32(haystack, needle)));
+				else if constexpr (sizeof(T) == 8)
+					return static_cast<::std::uint32_t>(simde_mm_movemask_epi8(simde_mm_cmpeq_epi64(haystack, needle)));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerFindMask of 16-byte package");
+			#endif
+		}
+
+		/// Get a register with all bits set for each element in lhs that is		
+		/// strictly lower than the corresponding element in rhs						
+		/// Works only for 32-bit and 64-bit elements									
+		///	@param lhs - the left elements												
+		///	@param rhs - the right elements												
+		///	@return the comparison mask													
+		template<class T>
+		NOD() LANGULUS(ALWAYSINLINE) SearchRegister InnerLesserMask(const SearchRegister& lhs, const SearchRegister& rhs) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				if constexpr (CT::RealSP<T>) {
+					return simde_mm256_castps_si256(simde_mm256_cmp_ps(
+						simde_mm256_castsi256_ps(lhs), simde_mm256_castsi256_ps(rhs), _CMP_LT_OQ));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					return simde_mm256_castpd_si256(simde_mm256_cmp_pd(
+						simde_mm256_castsi256_pd(lhs), simde_mm256_castsi256_pd(rhs), _CMP_LT_OQ));
+				}
+				else if constexpr (CT::SignedInteger32<T>)
+					return simde_mm256_cmpgt_epi32(rhs, lhs);
+				else if constexpr (CT::UnsignedInteger32<T>) {
+					// Flipping the sign bits turns unsigned order into signed
+					const auto flip = simde_mm256_set1_epi32(static_cast<int>(0x80000000u));
+					return simde_mm256_cmpgt_epi32(simde_mm256_xor_si256(rhs, flip), simde_mm256_xor_si256(lhs, flip));
+				}
+				else if constexpr (CT::SignedInteger64<T>)
+					return simde_mm256_cmpgt_epi64(rhs, lhs);
+				else if constexpr (CT::UnsignedInteger64<T>) {
+					const auto flip = simde_mm256_set1_epi64x(static_cast<::std::int64_t>(0x8000000000000000ull));
+					return simde_mm256_cmpgt_epi64(simde_mm256_xor_si256(rhs, flip), simde_mm256_xor_si256(lhs, flip));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerLesserMask of 32-byte package");
+			#else
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_castps_si128(simde_mm_cmplt_ps(simde_mm_castsi128_ps(lhs), simde_mm_castsi128_ps(rhs)));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_castpd_si128(simde_mm_cmplt_pd(simde_mm_castsi128_pd(lhs), simde_mm_castsi128_pd(rhs)));
+				else if constexpr (CT::SignedInteger32<T>)
+					return simde_mm_cmpgt_epi32(rhs, lhs);
+				else if constexpr (CT::UnsignedInteger32<T>) {
+					// Flipping the sign bits turns unsigned order into signed
+					const auto flip = simde_mm_set1_epi32(static_cast<int>(0x80000000u));
+					return simde_mm_cmpgt_epi32(simde_mm_xor_si128(rhs, flip), simde_mm_xor_si128(lhs, flip));
+				}
+				else if constexpr (CT::SignedInteger64<T>)
+					return simde_mm_cmpgt_epi64(rhs, lhs);
+				else if constexpr (CT::UnsignedInteger64<T>) {
+					const auto flip = simde_mm_set1_epi64x(static_cast<::std::int64_t>(0x8000000000000000ull));
+					return simde_mm_cmpgt_epi64(simde_mm_xor_si128(rhs, flip), simde_mm_xor_si128(lhs, flip));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerLesserMask of 16-byte package");
+			#endif
+		}
+
+		/// Pick bytes from rhs where mask is set, and from lhs otherwise			
+		///	@param lhs - the bytes to pick where mask isn't set					
+		///	@param rhs - the bytes to pick where mask is set						
+		///	@param mask - the selection mask												
+		///	@return the blended register													
+		NOD() LANGULUS(ALWAYSINLINE) SearchRegister InnerSearchBlend(const SearchRegister& lhs, const SearchRegister& rhs, const SearchRegister& mask) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				return simde_mm256_blendv_epi8(lhs, rhs, mask);
+			#else
+				return simde_mm_blendv_epi8(lhs, rhs, mask);
+			#endif
+		}
+	#endif
+
+	/// Find the index of the first element equal to a key							
+	/// Registers are compared until any of their elements matches, and the		
+	/// position of the match comes straight from the movemask						
+	///	@param data - the elements to search											
+	///	@param key - the element to search for											
+	///	@return the index of the first match, or the size of data if none		
+	template<CT::Span DATA>
+	NOD() LANGULUS(ALWAYSINLINE) Offset FindFirst(DATA&& data, const SpanType<DATA>& key) noexcept {
+		using T = SpanType<DATA>;
+		const Count count = ::std::ranges::size(data);
+		const T* in = ::std::ranges::data(data);
+		Offset i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (sizeof(T) <= 8) {
+				constexpr Count L = SearchRegisterSize / sizeof(T);
+				const auto needle = InnerSearchFill(key);
+				for (; i + L <= count; i += L) {
+					const auto found = InnerFindMask<T>(InnerSearchLoad(in + i), needle);
+					if (found)
+						return i + ::std::countr_zero(found) / sizeof(T);
+				}
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			if (in[i] == key)
+				return i;
+		}
+		return count;
+	}
+
+	/// Find the index of the last element equal to a key								
+	/// Registers are compared backwards, until any of their elements matches	
+	///	@param data - the elements to search											
+	///	@param key - the element to search for											
+	///	@return the index of the last match, or the size of data if none		
+	template<CT::Span DATA>
+	NOD() LANGULUS(ALWAYSINLINE) Offset FindLast(DATA&& data, const SpanType<DATA>& key) noexcept {
+		using T = SpanType<DATA>;
+		const Count count = ::std::ranges::size(data);
+		const T* in = ::std::ranges::data(data);
+		Offset i = count;
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (sizeof(T) <= 8) {
+				constexpr Count L = SearchRegisterSize / sizeof(T);
+				const auto needle = InnerSearchFill(key);
+				for (; i >= L; i -= L) {
+					const auto found = InnerFindMask<T>(InnerSearchLoad(in + i - L), needle);
+					if (found)
+						return i - L + (31 - ::std::countl_zero(found)) / sizeof(T);
+				}
+			}
+		#endif
+
+		// Do the rest the old way														
+		while (i > 0) {
+			if (in[--i] == key)
+				return i;
+		}
+		return count;
+	}
+
+	/// Find the index of the smallest (or biggest) element							
+	///	@tparam MAX - true to find the biggest element								
+	///	@param data - the elements to search											
+	///	@return the index of the first extreme element, or the size of data	
+	///		if it's empty																		
+	template<bool MAX, CT::Span DATA>
+	NOD() LANGULUS(ALWAYSINLINE) Offset InnerArgExtreme(DATA&& data) noexcept {
+		using T = SpanType<DATA>;
+		const Count count = ::std::ranges::size(data);
+		const T* in = ::std::ranges::data(data);
+		if (count == 0)
+			return count;
+
+		const auto better = [](const T& a, const T& b) noexcept {
+			if constexpr (MAX)
+				return b < a;
+			else
+				return a < b;
+		};
+
+		Offset best = 0;
+		Offset i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+				// Track the best value and its index in each lane, by using
+				// same-sized integers for the indices								
+				using INDEX = ::std::conditional_t<sizeof(T) == 4, ::std::int32_t, ::std::int64_t>;
+				constexpr Count L = SearchRegisterSize / sizeof(T);
+				if (count >= L * 2 && count <= static_cast<Count>(::std::numeric_limits<INDEX>::max())) {
+					INDEX initial[L];
+					for (Count lane = 0; lane < L; ++lane)
+						initial[lane] = static_cast<INDEX>(lane);
+
+					auto bestValues = InnerSearchLoad(in);
+					auto bestIndices = InnerSearchLoad(initial);
+					auto indices = bestIndices;
+					const auto step = InnerSearchFill(static_cast<INDEX>(L));
+					for (i = L; i + L <= count; i += L) {
+						#if LANGULUS_SIMD(256BIT)
+							if constexpr (sizeof(T) == 4)
+								indices = simde_mm256_add_epi32(indices, step);
+							else
+								indices = simde_mm256_add_epi64(indices, step);
+						#else
+							if constexpr (sizeof(T) == 4)
+								indices = simde_mm_add_epi32(indices, step);
+							else
+								indices = simde_mm_add_epi64(indices, step);
+						#endif
+
+						// Strict comparison keeps the earliest index in a lane
+						const auto values = InnerSearchLoad(in + i);
+						const auto mask = MAX
+							? InnerLesserMask<T>(bestValues, values)
+							: InnerLesserMask<T>(values, bestValues);
+						bestValues = InnerSearchBlend(bestValues, values, mask);
+						bestIndices = InnerSearchBlend(bestIndices, indices, mask);
+					}
+
+					T laneValues[L];
+					INDEX laneIndices[L];
+					::std::memcpy(laneValues, &bestValues, sizeof(laneValues));
+					::std::memcpy(laneIndices, &bestIndices, sizeof(laneIndices));
+					best = static_cast<Offset>(laneIndices[0]);
+					for (Count lane = 1; lane < L; ++lane) {
+						const auto index = static_cast<Offset>(laneIndices[lane]);
+						if (better(laneValues[lane], in[best])
+						|| (!better(in[best], laneValues[lane]) && index < best))
+							best = index;
+					}
+				}
+			}
+			else if constexpr (sizeof(T) < 4) {
+				// Indices don't fit small lanes, so find the extreme value	
+				// first, and then search for its first occurence				
+				using REGISTER = MaxRegister<T>;
+				constexpr Count L = MaxLanes<T>;
+				if constexpr (!CT::NotSupported<REGISTER>) {
+					using CHUNK = T[L];
+					if (count >= L) {
+						auto extremes = Load<0>(reinterpret_cast<const CHUNK&>(*in));
+						for (i = L; i + L <= count; i += L) {
+							const auto values = Load<0>(reinterpret_cast<const CHUNK&>(in[i]));
+							if constexpr (MAX)
+								extremes = MaxInner<T, L>(extremes, values);
+							else
+								extremes = MinInner<T, L>(extremes, values);
+						}
+
+						CHUNK lanes;
+						Store(extremes, lanes);
+						T extreme = lanes[0];
+						for (Count lane = 1; lane < L; ++lane) {
+							if (better(lanes[lane], extreme))
+								extreme = lanes[lane];
+						}
+
+						for (; i < count; ++i) {
+							if (better(in[i], extreme))
+								extreme = in[i];
+						}
+						return FindFirst(data, extreme);
+					}
+				}
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			if (better(in[i], in[best]))
+				best = i;
+		}
+		return best;
+	}
+
+	/// Find the index of the smallest element											
+	///	@param data - the elements to search											
+	///	@return the index of the first smallest element, or the size of data	
+	///		if it's empty																		
+	template<CT::Span DATA>
+	NOD() LANGULUS(ALWAYSINLINE) Offset ArgMin(DATA&& data) noexcept {
+		return InnerArgExtreme<false>(data);
+	}
+
+	/// Find the index of the biggest element												
+	///	@param data - the elements to search											
+	///	@return the index of the first biggest element, or the size of data	
+	///		if it's empty																		
+	template<CT::Span DATA>
+	NOD() LANGULUS(ALWAYSINLINE) Offset ArgMax(DATA&& data) noexcept {
+		return InnerArgExtreme<true>(data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,296 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Intrinsics.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Put the biggest or smallest 32-bit integer in lanes that overflowed		
+	/// Lanes overflow towards the sign of lhs, when adding or subtracting		
+	///	@param lhs - the left operand														
+	///	@param result - the wrapped around result										
+	///	@param overflow - lanes that overflowed have their sign bit set		
+	///	@return the saturated result														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerSaturateFixed32(const R& lhs, const R& result, const R& overflow) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			const auto sat = simde_mm_xor_si128(simde_mm_srai_epi32(lhs, 31), simde_mm_set1_epi32(0x7FFFFFFF));
+			return simde_mm_castps_si128(simde_mm_blendv_ps(
+				simde_mm_castsi128_ps(result), simde_mm_castsi128_ps(sat), simde_mm_castsi128_ps(overflow)));
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			const auto sat = simde_mm256_xor_si256(simde_mm256_srai_epi32(lhs, 31), simde_mm256_set1_epi32(0x7FFFFFFF));
+			return simde_mm256_castps_si256(simde_mm256_blendv_ps(
+				simde_mm256_castsi256_ps(result), simde_mm256_castsi256_ps(sat), simde_mm256_castsi256_ps(overflow)));
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			const auto sat = simde_mm512_xor_si512(simde_mm512_srai_epi32(lhs, 31), simde_mm512_set1_epi32(0x7FFFFFFF));
+			const auto over = simde_mm512_cmplt_epi32_mask(overflow, simde_mm512_setzero_si512());
+			return simde_mm512_mask_mov_epi32(result, over, sat);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerSaturateFixed32");
+	}
+
+	/// Add fixed point numbers, saturating on overflow								
+	///	@tparam T - the fixed point number type										
+	///	@param lhs - the left-hand-side numbers										
+	///	@param rhs - the right-hand-side numbers										
+	///	@return the added numbers															
+	template<CT::FixedPoint T, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerAddFixed(const R& lhs, const R& rhs) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm_adds_epi16(lhs, rhs);
+			else {
+				const auto sum = simde_mm_add_epi32(lhs, rhs);
+				const auto overflow = simde_mm_and_si128(simde_mm_xor_si128(lhs, sum), simde_mm_xor_si128(rhs, sum));
+				return InnerSaturateFixed32(lhs, sum, overflow);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm256_adds_epi16(lhs, rhs);
+			else {
+				const auto sum = simde_mm256_add_epi32(lhs, rhs);
+				const auto overflow = simde_mm256_and_si256(simde_mm256_xor_si256(lhs, sum), simde_mm256_xor_si256(rhs, sum));
+				return InnerSaturateFixed32(lhs, sum, overflow);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm512_adds_epi16(lhs, rhs);
+			else {
+				const auto sum = simde_mm512_add_epi32(lhs, rhs);
+				const auto overflow = simde_mm512_and_si512(simde_mm512_xor_si512(lhs, sum), simde_mm512_xor_si512(rhs, sum));
+				return InnerSaturateFixed32(lhs, sum, overflow);
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerAddFixed");
+	}
+
+	/// Subtract fixed point numbers, saturating on overflow							
+	///	@tparam T - the fixed point number type										
+	///	@param lhs - the left-hand-side numbers										
+	///	@param rhs - the right-hand-side numbers										
+	///	@return the subtracted numbers													
+	template<CT::FixedPoint T, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerSubtractFixed(const R& lhs, const R& rhs) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm_subs_epi16(lhs, rhs);
+			else {
+				const auto diff = simde_mm_sub_epi32(lhs, rhs);
+				const auto overflow = simde_mm_and_si128(simde_mm_xor_si128(lhs, rhs), simde_mm_xor_si128(lhs, diff));
+				return InnerSaturateFixed32(lhs, diff, overflow);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm256_subs_epi16(lhs, rhs);
+			else {
+				const auto diff = simde_mm256_sub_epi32(lhs, rhs);
+				const auto overflow = simde_mm256_and_si256(simde_mm256_xor_si256(lhs, rhs), simde_mm256_xor_si256(lhs, diff));
+				return InnerSaturateFixed32(lhs, diff, overflow);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm512_subs_epi16(lhs, rhs);
+			else {
+				const auto diff = simde_mm512_sub_epi32(lhs, rhs);
+				const auto overflow = simde_mm512_and_si512(simde_mm512_xor_si512(lhs, rhs), simde_mm512_xor_si512(lhs, diff));
+				return InnerSaturateFixed32(lhs, diff, overflow);
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerSubtractFixed");
+	}
+
+	/// Multiply fixed point numbers, rounding half up and saturating				
+	/// Q15 is what _mm_mulhrs_epi16 does, except for -1 * -1, which it wraps	
+	/// Q31 is emulated with two 32x32->64 bit multiplications. Other 32-bit	
+	/// formats aren't supported, and fall back to the scalar operator			
+	///	@tparam T - the fixed point number type										
+	///	@param lhs - the left-hand-side numbers										
+	///	@param rhs - the right-hand-side numbers										
+	///	@return the multiplied numbers													
+	template<CT::FixedPoint T, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerMultiplyFixed(const R& lhs, const R& rhs) noexcept {
+		constexpr int F = T::Fraction;
+
+		if constexpr (CT::FixedPoint32<T> && F != 31)
+			return CT::Inner::NotSupported {};
+		else if constexpr (CT::Same<R, simde__m128i>) {
+			if constexpr (CT::FixedPoint16<T> && F == 15) {
+				const auto min = simde_mm_set1_epi16(::std::numeric_limits<::std::int16_t>::min());
+				const auto both = simde_mm_and_si128(simde_mm_cmpeq_epi16(lhs, min), simde_mm_cmpeq_epi16(rhs, min));
+				return simde_mm_xor_si128(simde_mm_mulhrs_epi16(lhs, rhs), both);
+			}
+			else if constexpr (CT::FixedPoint16<T>) {
+				// Get the 32-bit products, and round them						
+				const auto lo = simde_mm_mullo_epi16(lhs, rhs);
+				const auto hi = simde_mm_mulhi_epi16(lhs, rhs);
+				const auto round = simde_mm_set1_epi32(1 << (F - 1));
+				const auto a = simde_mm_srai_epi32(simde_mm_add_epi32(simde_mm_unpacklo_epi16(lo, hi), round), F);
+				const auto b = simde_mm_srai_epi32(simde_mm_add_epi32(simde_mm_unpackhi_epi16(lo, hi), round), F);
+				return simde_mm_packs_epi32(a, b);
+			}
+			else {
+				// Multiply even and odd lanes separately, into 64 bits		
+				const auto round = simde_mm_set1_epi64x(1ll << 30);
+				const auto even = simde_mm_add_epi64(simde_mm_mul_epi32(lhs, rhs), round);
+				const auto odd = simde_mm_add_epi64(simde_mm_mul_epi32(
+					simde_mm_srli_epi64(lhs, 32), simde_mm_srli_epi64(rhs, 32)), round);
+				const auto result = simde_mm_blend_epi16(
+					simde_mm_srli_epi64(even, 31), simde_mm_slli_epi64(odd, 1), 0xCC);
+				const auto min = simde_mm_set1_epi32(::std::numeric_limits<::std::int32_t>::min());
+				const auto both = simde_mm_and_si128(simde_mm_cmpeq_epi32(lhs, min), simde_mm_cmpeq_epi32(rhs, min));
+				return simde_mm_xor_si128(result, both);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			if constexpr (CT::FixedPoint16<T> && F == 15) {
+				const auto min = simde_mm256_set1_epi16(::std::numeric_limits<::std::int16_t>::min());
+				const auto both = simde_mm256_and_si256(simde_mm256_cmpeq_epi16(lhs, min), simde_mm256_cmpeq_epi16(rhs, min));
+				return simde_mm256_xor_si256(simde_mm256_mulhrs_epi16(lhs, rhs), both);
+			}
+			else if constexpr (CT::FixedPoint16<T>) {
+				// Unpacking and packing are both per 128-bit lane, so the	
+				// numbers end up where they started								
+				const auto lo = simde_mm256_mullo_epi16(lhs, rhs);
+				const auto hi = simde_mm256_mulhi_epi16(lhs, rhs);
+				const auto round = simde_mm256_set1_epi32(1 << (F - 1));
+				const auto a = simde_mm256_srai_epi32(simde_mm256_add_epi32(simde_mm256_unpacklo_epi16(lo, hi), round), F);
+				const auto b = simde_mm256_srai_epi32(simde_mm256_add_epi32(simde_mm256_unpackhi_epi16(lo, hi), round), F);
+				return simde_mm256_packs_epi32(a, b);
+			}
+			else {
+				const auto round = simde_mm256_set1_epi64x(1ll << 30);
+				const auto even = simde_mm256_add_epi64(simde_mm256_mul_epi32(lhs, rhs), round);
+				const auto odd = simde_mm256_add_epi64(simde_mm256_mul_epi32(
+					simde_mm256_srli_epi64(lhs, 32), simde_mm256_srli_epi64(rhs, 32)), round);
+				const auto result = simde_mm256_blend_epi16(
+					simde_mm256_srli_epi64(even, 31), simde_mm256_slli_epi64(odd, 1), 0xCC);
+				const auto min = simde_mm256_set1_epi32(::std::numeric_limits<::std::int32_t>::min());
+				const auto both = simde_mm256_and_si256(simde_mm256_cmpeq_epi32(lhs, min), simde_mm256_cmpeq_epi32(rhs, min));
+				return simde_mm256_xor_si256(result, both);
+			}
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			if constexpr (CT::FixedPoint16<T> && F == 15) {
+				const auto min = simde_mm512_set1_epi16(::std::numeric_limits<::std::int16_t>::min());
+				const auto both = simde_mm512_cmpeq_epi16_mask(lhs, min) & simde_mm512_cmpeq_epi16_mask(rhs, min);
+				return simde_mm512_mask_mov_epi16(simde_mm512_mulhrs_epi16(lhs, rhs), both, simde_mm512_set1_epi16(0x7FFF));
+			}
+			else if constexpr (CT::FixedPoint16<T>) {
+				const auto lo = simde_mm512_mullo_epi16(lhs, rhs);
+				const auto hi = simde_mm512_mulhi_epi16(lhs, rhs);
+				const auto round = simde_mm512_set1_epi32(1 << (F - 1));
+				const auto a = simde_mm512_srai_epi32(simde_mm512_add_epi32(simde_mm512_unpacklo_epi16(lo, hi), round), F);
+				const auto b = simde_mm512_srai_epi32(simde_mm512_add_epi32(simde_mm512_unpackhi_epi16(lo, hi), round), F);
+				return simde_mm512_packs_epi32(a, b);
+			}
+			else {
+				const auto round = simde_mm512_set1_epi64(1ll << 30);
+				const auto even = simde_mm512_add_epi64(simde_mm512_mul_epi32(lhs, rhs), round);
+				const auto odd = simde_mm512_add_epi64(simde_mm512_mul_epi32(
+					simde_mm512_srli_epi64(lhs, 32), simde_mm512_srli_epi64(rhs, 32)), round);
+				const auto result = simde_mm512_mask_blend_epi32(0xAAAA,
+					simde_mm512_srli_epi64(even, 31), simde_mm512_slli_epi64(odd, 1));
+				const auto min = simde_mm512_set1_epi32(::std::numeric_limits<::std::int32_t>::min());
+				const auto both = simde_mm512_cmpeq_epi32_mask(lhs, min) & simde_mm512_cmpeq_epi32_mask(rhs, min);
+				return simde_mm512_mask_mov_epi32(result, both, simde_mm512_set1_epi32(0x7FFFFFFF));
+			}
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerMultiplyFixed");
+	}
+
+	/// Scale single precision numbers by the fixed point's 2^FRACTION,			
+	/// so that they can be rounded and converted to the integer holding it		
+	///	@tparam T - the fixed point number type										
+	///	@param v - the numbers to scale													
+	///	@return the scaled numbers															
+	template<CT::FixedPoint T, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerScaleFixed(const R& v) noexcept {
+		constexpr float SCALE = static_cast<float>(1ll << T::Fraction);
+		if constexpr (CT::Same<R, simde__m128>)
+			return simde_mm_mul_ps(v, simde_mm_set1_ps(SCALE));
+		else if constexpr (CT::Same<R, simde__m256>)
+			return simde_mm256_mul_ps(v, simde_mm256_set1_ps(SCALE));
+		else if constexpr (CT::Same<R, simde__m512>)
+			return simde_mm512_mul_ps(v, simde_mm512_set1_ps(SCALE));
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerScaleFixed");
+	}
+
+	/// Convert scaled, rounded and clamped single precision numbers to the		
+	/// integers that hold fixed point numbers											
+	///	@tparam T - the fixed point number type										
+	///	@tparam TO - the integer register to convert to								
+	///	@param v - the numbers to convert												
+	///	@return the fixed point numbers													
+	template<CT::FixedPoint T, CT::TSIMD TO, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) TO InnerConvertToFixed(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128>) {
+			const auto wide = simde_mm_cvtps_epi32(v);
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm_packs_epi32(wide, wide);
+			else
+				return wide;
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			const auto wide = simde_mm256_cvtps_epi32(v);
+			if constexpr (CT::FixedPoint16<T>) {
+				return simde_mm_packs_epi32(
+					simde_mm256_castsi256_si128(wide),
+					simde_mm256_extracti128_si256(wide, 1));
+			}
+			else return wide;
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			const auto wide = simde_mm512_cvtps_epi32(v);
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm512_cvtsepi32_epi16(wide);
+			else
+				return wide;
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertToFixed");
+	}
+
+	/// Convert the integers that hold fixed point numbers to single precision	
+	///	@tparam T - the fixed point number type										
+	///	@tparam TO - the float register to convert to								
+	///	@param v - the fixed point numbers												
+	///	@return the single precision numbers											
+	template<CT::FixedPoint T, CT::TSIMD TO, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) TO InnerConvertFromFixed(const R& v) noexcept {
+		constexpr float SCALE = 1.0f / static_cast<float>(1ll << T::Fraction);
+		if constexpr (CT::Same<TO, simde__m128>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm_mul_ps(simde_mm_cvtepi32_ps(simde_mm_cvtepi16_epi32(v)), simde_mm_set1_ps(SCALE));
+			else
+				return simde_mm_mul_ps(simde_mm_cvtepi32_ps(v), simde_mm_set1_ps(SCALE));
+		}
+		else if constexpr (CT::Same<TO, simde__m256>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm256_mul_ps(simde_mm256_cvtepi32_ps(simde_mm256_cvtepi16_epi32(v)), simde_mm256_set1_ps(SCALE));
+			else
+				return simde_mm256_mul_ps(simde_mm256_cvtepi32_ps(v), simde_mm256_set1_ps(SCALE));
+		}
+		else if constexpr (CT::Same<TO, simde__m512>) {
+			if constexpr (CT::FixedPoint16<T>)
+				return simde_mm512_mul_ps(simde_mm512_cvtepi32_ps(simde_mm512_cvtepi16_epi32(v)), simde_mm512_set1_ps(SCALE));
+			else
+				return simde_mm512_mul_ps(simde_mm512_cvtepi32_ps(v), simde_mm512_set1_ps(SCALE));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertFromFixed");
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -8,10 +8,16 @@
 #pragma once
 #include "Fill.hpp"
 #include "Convert.hpp"
+#include "Span.hpp"
 
 namespace Langulus::SIMD
 {
 
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerFloor(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
 	/// Get floored values via SIMD															
 	///	@tparam T - the type of the array element										
 	///	@tparam S - the size of the array												
@@ -55,4 +61,38 @@ namespace Langulus::SIMD
 		return InnerFloor<T, S>(Load<0>(value));
 	}
 
+	/// Floor a span of real numbers, writing the results to another span		
+	///	@param input - the numbers to floor												
+	///	@param output - [out] the floored numbers										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void FloorSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerFloor<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ::std::floor(v);
+			}
+		);
+	}
+
+	/// Floor a span of real numbers in place												
+	///	@param data - [in/out] the numbers to floor									
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void FloorSpan(DATA&& data) noexcept {
+		FloorSpan(data, data);
+	}
+
+	/// Floor an array, writing the results to another array							
+	///	@param value - the numbers to floor												
+	///	@param output - [out] the floored numbers										
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Floor(const T(&value)[S], T(&output)[S]) noexcept {
+		FloorSpan(value, output);
+	}
+
 } // namespace Langulus::SIMD
\ No newline at end of file
@@ -0,0 +1,104 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Floor.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerFract(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the fractional parts via SIMD, calculated as x - floor(x)				
+	/// The results are always in the range [0, 1), even for negative x			
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the array															
+	///	@return the fractional parts														
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerFract(const REGISTER& value) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerFract is suboptimal and pointless for whole numbers, avoid calling it on such");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_sub_ps(value, InnerFloor<T, S>(value));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_sub_pd(value, InnerFloor<T, S>(value));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerFract of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm256_sub_ps(value, InnerFloor<T, S>(value));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm256_sub_pd(value, InnerFloor<T, S>(value));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerFract of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm512_sub_ps(value, InnerFloor<T, S>(value));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm512_sub_pd(value, InnerFloor<T, S>(value));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerFract of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerFract");
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) auto Fract(const T(&value)[S]) noexcept {
+		return InnerFract<T, S>(Load<0>(value));
+	}
+
+	/// Get the fractional parts of a span of real numbers							
+	///	@param input - the numbers to get the fractional parts of				
+	///	@param output - [out] the fractional parts									
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void FractSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerFract<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return v - ::std::floor(v);
+			}
+		);
+	}
+
+	/// Get the fractional parts of a span of real numbers in place				
+	///	@param data - [in/out] the numbers to get the fractional parts of		
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void FractSpan(DATA&& data) noexcept {
+		FractSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
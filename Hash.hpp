@@ -0,0 +1,420 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "XOr.hpp"
+#include "Span.hpp"
+#include <cstring>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// The primes of XXH64																		
+	constexpr ::std::uint64_t XXHash64Prime1 = 0x9E3779B185EBCA87ull;
+	constexpr ::std::uint64_t XXHash64Prime2 = 0xC2B2AE3D27D4EB4Full;
+	constexpr ::std::uint64_t XXHash64Prime3 = 0x165667B19E3779F9ull;
+	constexpr ::std::uint64_t XXHash64Prime4 = 0x85EBCA77C2B2AE63ull;
+	constexpr ::std::uint64_t XXHash64Prime5 = 0x27D4EB2F165667C5ull;
+
+	/// The hashing helpers below work both on registers of 64-bit lanes, and	
+	/// on plain 64-bit numbers, so that all lanes and the scalar fallback		
+	/// share the exact same XXH64 code														
+
+	/// Fill all 64-bit lanes with the same number										
+	///	@tparam R - the register, or std::uint64_t									
+	///	@param value - the number															
+	///	@return the filled register														
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashFill(::std::uint64_t value) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return value;
+		else if constexpr (CT::SIMD128<R>)
+			return simde_mm_set1_epi64x(static_cast<::std::int64_t>(value));
+		else if constexpr (CT::SIMD256<R>)
+			return simde_mm256_set1_epi64x(static_cast<::std::int64_t>(value));
+		else if constexpr (CT::SIMD512<R>)
+			return simde_mm512_set1_epi64(static_cast<::std::int64_t>(value));
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashFill");
+	}
+
+	/// Add 64-bit lanes, wrapping around													
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashAdd(const R& lhs, const R& rhs) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return lhs + rhs;
+		else if constexpr (CT::SIMD128<R>)
+			return simde_mm_add_epi64(lhs, rhs);
+		else if constexpr (CT::SIMD256<R>)
+			return simde_mm256_add_epi64(lhs, rhs);
+		else if constexpr (CT::SIMD512<R>)
+			return simde_mm512_add_epi64(lhs, rhs);
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashAdd");
+	}
+
+	/// XOr 64-bit lanes																			
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashXOr(const R& lhs, const R& rhs) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return lhs ^ rhs;
+		else
+			return XOrInner<::std::uint64_t, sizeof(R) / 8>(lhs, rhs);
+	}
+
+	/// Multiply 64-bit lanes, keeping the low 64 bits of the products			
+	/// Without AVX512DQ there is no such instruction, so the products are		
+	/// assembled from three 32x32 bit multiplications									
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashMultiply(const R& lhs, const R& rhs) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return lhs * rhs;
+		else if constexpr (CT::SIMD128<R>) {
+			#if LANGULUS_SIMD(AVX512)
+				return simde_mm_mullo_epi64(lhs, rhs);
+			#else
+				const auto cross = simde_mm_add_epi64(
+					simde_mm_mul_epu32(simde_mm_srli_epi64(lhs, 32), rhs),
+					simde_mm_mul_epu32(lhs, simde_mm_srli_epi64(rhs, 32)));
+				return simde_mm_add_epi64(simde_mm_mul_epu32(lhs, rhs), simde_mm_slli_epi64(cross, 32));
+			#endif
+		}
+		else if constexpr (CT::SIMD256<R>) {
+			#if LANGULUS_SIMD(AVX512)
+				return simde_mm256_mullo_epi64(lhs, rhs);
+			#else
+				const auto cross = simde_mm256_add_epi64(
+					simde_mm256_mul_epu32(simde_mm256_srli_epi64(lhs, 32), rhs),
+					simde_mm256_mul_epu32(lhs, simde_mm256_srli_epi64(rhs, 32)));
+				return simde_mm256_add_epi64(simde_mm256_mul_epu32(lhs, rhs), simde_mm256_slli_epi64(cross, 32));
+			#endif
+		}
+		else if constexpr (CT::SIMD512<R>)
+			return simde_mm512_mullo_epi64(lhs, rhs);
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashMultiply");
+	}
+
+	/// Rotate 64-bit lanes left																
+	///	@tparam BITS - the number of bits to rotate by								
+	template<int BITS, class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashRotate(const R& value) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return (value << BITS) | (value >> (64 - BITS));
+		else if constexpr (CT::SIMD128<R>) {
+			#if LANGULUS_SIMD(AVX512)
+				return simde_mm_rol_epi64(value, BITS);
+			#else
+				return simde_mm_or_si128(simde_mm_slli_epi64(value, BITS), simde_mm_srli_epi64(value, 64 - BITS));
+			#endif
+		}
+		else if constexpr (CT::SIMD256<R>) {
+			#if LANGULUS_SIMD(AVX512)
+				return simde_mm256_rol_epi64(value, BITS);
+			#else
+				return simde_mm256_or_si256(simde_mm256_slli_epi64(value, BITS), simde_mm256_srli_epi64(value, 64 - BITS));
+			#endif
+		}
+		else if constexpr (CT::SIMD512<R>)
+			return simde_mm512_rol_epi64(value, BITS);
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashRotate");
+	}
+
+	/// Mix the high bits of 64-bit lanes into the low ones							
+	///	@tparam BITS - the number of bits to shift right by						
+	template<int BITS, class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashShiftXOr(const R& value) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return value ^ (value >> BITS);
+		else if constexpr (CT::SIMD128<R>)
+			return InnerHashXOr(value, simde_mm_srli_epi64(value, BITS));
+		else if constexpr (CT::SIMD256<R>)
+			return InnerHashXOr(value, simde_mm256_srli_epi64(value, BITS));
+		else if constexpr (CT::SIMD512<R>)
+			return InnerHashXOr(value, simde_mm512_srli_epi64(value, BITS));
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashShiftXOr");
+	}
+
+	/// Shift 64-bit lanes left																
+	///	@tparam BITS - the number of bits to shift left by							
+	template<int BITS, class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashShiftLeft(const R& value) noexcept {
+		if constexpr (CT::Same<R, ::std::uint64_t>)
+			return value << BITS;
+		else if constexpr (CT::SIMD128<R>)
+			return simde_mm_slli_epi64(value, BITS);
+		else if constexpr (CT::SIMD256<R>)
+			return simde_mm256_slli_epi64(value, BITS);
+		else if constexpr (CT::SIMD512<R>)
+			return simde_mm512_slli_epi64(value, BITS);
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashShiftLeft");
+	}
+
+	/// Accumulate an input word into an XXH64 accumulator							
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerXXHash64Round(const R& accumulator, const R& input) noexcept {
+		const auto sum = InnerHashAdd(accumulator, InnerHashMultiply(input, InnerHashFill<R>(XXHash64Prime2)));
+		return InnerHashMultiply(InnerHashRotate<31>(sum), InnerHashFill<R>(XXHash64Prime1));
+	}
+
+	/// Scramble the bits of an XXH64 hash, so that they all depend on input	
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerXXHash64Avalanche(R hash) noexcept {
+		hash = InnerHashMultiply(InnerHashShiftXOr<33>(hash), InnerHashFill<R>(XXHash64Prime2));
+		hash = InnerHashMultiply(InnerHashShiftXOr<29>(hash), InnerHashFill<R>(XXHash64Prime3));
+		return InnerHashShiftXOr<32>(hash);
+	}
+
+	/// Set up the four XXH64 accumulators													
+	template<class R>
+	LANGULUS(ALWAYSINLINE) void InnerXXHash64Start(R(&accumulators)[4], ::std::uint64_t seed) noexcept {
+		accumulators[0] = InnerHashFill<R>(seed + XXHash64Prime1 + XXHash64Prime2);
+		accumulators[1] = InnerHashFill<R>(seed + XXHash64Prime2);
+		accumulators[2] = InnerHashFill<R>(seed);
+		accumulators[3] = InnerHashFill<R>(seed - XXHash64Prime1);
+	}
+
+	/// Accumulate a range of 32-byte stripes into the XXH64 accumulators		
+	///	@param accumulators - [in/out] the accumulators								
+	///	@param from - the first stripe													
+	///	@param to - the stripe after the last one										
+	///	@param load - loads the word at an offset, with a given size			
+	template<class R, class LOAD>
+	LANGULUS(ALWAYSINLINE) void InnerXXHash64Stripes(R(&accumulators)[4], Count from, Count to, LOAD&& load) noexcept {
+		for (Count stripe = from; stripe < to; ++stripe) {
+			for (Count i = 0; i < 4; ++i)
+				accumulators[i] = InnerXXHash64Round(accumulators[i], load(stripe * 32 + i * 8, 8));
+		}
+	}
+
+	/// Merge the four XXH64 accumulators into a single hash							
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerXXHash64Converge(const R(&accumulators)[4]) noexcept {
+		auto hash = InnerHashAdd(
+			InnerHashAdd(InnerHashRotate<1>(accumulators[0]), InnerHashRotate<7>(accumulators[1])),
+			InnerHashAdd(InnerHashRotate<12>(accumulators[2]), InnerHashRotate<18>(accumulators[3])));
+
+		for (auto& accumulator : accumulators) {
+			hash = InnerHashXOr(hash, InnerXXHash64Round(InnerHashFill<R>(0), accumulator));
+			hash = InnerHashAdd(InnerHashMultiply(hash, InnerHashFill<R>(XXHash64Prime1)), InnerHashFill<R>(XXHash64Prime4));
+		}
+		return hash;
+	}
+
+	/// Hash the bytes that don't fill a stripe, and finalize the hash			
+	///	@param hash - the hash so far														
+	///	@param offset - the first byte after the last stripe						
+	///	@param length - the total number of bytes										
+	///	@param load - loads the word at an offset, with a given size			
+	///	@return the final hash																
+	template<class R, class LOAD>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerXXHash64Tail(R hash, Count offset, Count length, LOAD&& load) noexcept {
+		hash = InnerHashAdd(hash, InnerHashFill<R>(length));
+		for (; offset + 8 <= length; offset += 8) {
+			hash = InnerHashXOr(hash, InnerXXHash64Round(InnerHashFill<R>(0), load(offset, 8)));
+			hash = InnerHashAdd(InnerHashMultiply(InnerHashRotate<27>(hash), InnerHashFill<R>(XXHash64Prime1)), InnerHashFill<R>(XXHash64Prime4));
+		}
+
+		if (offset + 4 <= length) {
+			hash = InnerHashXOr(hash, InnerHashMultiply(load(offset, 4), InnerHashFill<R>(XXHash64Prime1)));
+			hash = InnerHashAdd(InnerHashMultiply(InnerHashRotate<23>(hash), InnerHashFill<R>(XXHash64Prime2)), InnerHashFill<R>(XXHash64Prime3));
+			offset += 4;
+		}
+
+		for (; offset < length; ++offset) {
+			hash = InnerHashXOr(hash, InnerHashMultiply(load(offset, 1), InnerHashFill<R>(XXHash64Prime5)));
+			hash = InnerHashMultiply(InnerHashRotate<11>(hash), InnerHashFill<R>(XXHash64Prime1));
+		}
+
+		return InnerXXHash64Avalanche(hash);
+	}
+
+	/// Hash a fixed-width integer key, exactly as XXH64 hashes its bytes		
+	///	@tparam T - the type of the key, 32 or 64-bit integer						
+	///	@param key - the keys, zero-extended to 64 bits								
+	///	@param seed - the seed in every lane											
+	///	@return the hashes																	
+	template<class T, class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerXXHash64Key(const R& key, const R& seed) noexcept {
+		auto hash = InnerHashAdd(seed, InnerHashFill<R>(XXHash64Prime5 + sizeof(T)));
+		if constexpr (sizeof(T) == 8) {
+			hash = InnerHashXOr(hash, InnerXXHash64Round(InnerHashFill<R>(0), key));
+			hash = InnerHashAdd(InnerHashMultiply(InnerHashRotate<27>(hash), InnerHashFill<R>(XXHash64Prime1)), InnerHashFill<R>(XXHash64Prime4));
+		}
+		else {
+			hash = InnerHashXOr(hash, InnerHashMultiply(key, InnerHashFill<R>(XXHash64Prime1)));
+			hash = InnerHashAdd(InnerHashMultiply(InnerHashRotate<23>(hash), InnerHashFill<R>(XXHash64Prime2)), InnerHashFill<R>(XXHash64Prime3));
+		}
+		return InnerXXHash64Avalanche(hash);
+	}
+
+	/// Load consecutive integer keys, zero-extending them to 64-bit lanes		
+	template<class R, class T>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerHashLoadKeys(const T* keys) noexcept {
+		if constexpr (CT::SIMD128<R>) {
+			if constexpr (sizeof(T) == 8)
+				return simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(keys));
+			else
+				return simde_mm_cvtepu32_epi64(simde_mm_loadl_epi64(reinterpret_cast<const simde__m128i*>(keys)));
+		}
+		else if constexpr (CT::SIMD256<R>) {
+			if constexpr (sizeof(T) == 8)
+				return simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(keys));
+			else
+				return simde_mm256_cvtepu32_epi64(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(keys)));
+		}
+		else if constexpr (CT::SIMD512<R>) {
+			if constexpr (sizeof(T) == 8)
+				return simde_mm512_loadu_si512(keys);
+			else
+				return simde_mm512_cvtepu32_epi64(simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(keys)));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHashLoadKeys");
+	}
+
+	/// Hash some bytes with XXH64															
+	///	@param bytes - the bytes to hash													
+	///	@param seed - the seed																
+	///	@return the hash																		
+	template<CT::Span IN>
+	NOD() LANGULUS(ALWAYSINLINE) ::std::uint64_t XXHash64(IN&& bytes, ::std::uint64_t seed = 0) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		const Count length = ::std::ranges::size(bytes);
+		const auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes));
+		const auto load = [in](Count offset, Count size) noexcept {
+			::std::uint64_t word = 0;
+			::std::memcpy(&word, in + offset, size);
+			return word;
+		};
+
+		::std::uint64_t accumulators[4];
+		InnerXXHash64Start(accumulators, seed);
+		InnerXXHash64Stripes(accumulators, 0, length / 32, load);
+		const auto hash = length >= 32 ? InnerXXHash64Converge(accumulators) : seed + XXHash64Prime5;
+		return InnerXXHash64Tail(hash, length / 32 * 32, length, load);
+	}
+
+	/// Hash fixed-width integer keys, for example before probing a hash table	
+	/// Each hash is the XXH64 of the key's bytes. Keys are hashed in 64-bit	
+	/// lanes, two registers at a time - 4, 8 or 16 keys per step, depending	
+	/// on the widest available register													
+	///	@param keys - the 32 or 64-bit integer keys									
+	///	@param hashes - [out] the hashes													
+	///	@param seed - the seed																
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void XXHash64Span(IN&& keys, OUT&& hashes, ::std::uint64_t seed = 0) noexcept {
+		using T = SpanType<IN>;
+		using REGISTER = MaxRegister<::std::uint64_t>;
+		constexpr Count L = MaxLanes<::std::uint64_t>;
+		static_assert(CT::Integer32<T> || CT::Integer64<T>, "Keys must be 32 or 64-bit integers");
+		static_assert(CT::Same<SpanType<OUT>, ::std::uint64_t>, "Hashes must be 64-bit unsigned integers");
+		const Count count = OverlapCount(keys, hashes);
+		const T* in = ::std::ranges::data(keys);
+		::std::uint64_t* out = ::std::ranges::data(hashes);
+		Count i = 0;
+
+		if constexpr (L >= 2 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = ::std::uint64_t[L];
+			const auto seeds = InnerHashFill<REGISTER>(seed);
+			for (; i + 2 * L <= count; i += 2 * L) {
+				const auto h0 = InnerXXHash64Key<T>(InnerHashLoadKeys<REGISTER>(in + i), seeds);
+				const auto h1 = InnerXXHash64Key<T>(InnerHashLoadKeys<REGISTER>(in + i + L), seeds);
+				Store(h0, reinterpret_cast<CHUNK&>(out[i]));
+				Store(h1, reinterpret_cast<CHUNK&>(out[i + L]));
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const auto key = static_cast<::std::uint64_t>(static_cast<::std::make_unsigned_t<T>>(in[i]));
+			out[i] = InnerXXHash64Key<T>(key, seed);
+		}
+	}
+
+	/// Hash a batch of byte strings, each with XXH64									
+	/// Strings are hashed in parallel lanes, one string per lane. The stripes	
+	/// all strings in a group have are done in registers, and if the strings	
+	/// are all of the same length, so is the rest - otherwise each string is	
+	/// finished the old way																	
+	///	@param strings - the byte strings, such as std::string_view				
+	///	@param hashes - [out] the hashes													
+	///	@param seed - the seed																
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void XXHash64Batch(IN&& strings, OUT&& hashes, ::std::uint64_t seed = 0) noexcept {
+		using STRING = SpanType<IN>;
+		using REGISTER = MaxRegister<::std::uint64_t>;
+		constexpr Count L = MaxLanes<::std::uint64_t>;
+		static_assert(CT::Span<STRING> && sizeof(SpanType<STRING>) == 1, "Strings must be spans of bytes");
+		static_assert(CT::Same<SpanType<OUT>, ::std::uint64_t>, "Hashes must be 64-bit unsigned integers");
+		const Count count = OverlapCount(strings, hashes);
+		const STRING* in = ::std::ranges::data(strings);
+		::std::uint64_t* out = ::std::ranges::data(hashes);
+		Count i = 0;
+
+		if constexpr (L >= 2 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = ::std::uint64_t[L];
+			for (; i + L <= count; i += L) {
+				const ::std::uint8_t* data[L];
+				Count lengths[L];
+				Count stripes = ::std::numeric_limits<Count>::max();
+				bool same = true;
+				for (Count lane = 0; lane < L; ++lane) {
+					data[lane] = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(in[i + lane]));
+					lengths[lane] = ::std::ranges::size(in[i + lane]);
+					stripes = ::std::min(stripes, lengths[lane] / 32);
+					same &= lengths[lane] == lengths[0];
+				}
+
+				// Gather a word from every string into a register				
+				const auto gather = [&data](Count offset, Count size) noexcept {
+					alignas(REGISTER) CHUNK words {};
+					for (Count lane = 0; lane < L; ++lane)
+						::std::memcpy(&words[lane], data[lane] + offset, size);
+					return Load<0>(words);
+				};
+
+				REGISTER accumulators[4];
+				InnerXXHash64Start(accumulators, seed);
+				InnerXXHash64Stripes(accumulators, 0, stripes, gather);
+
+				if (same) {
+					const Count length = lengths[0];
+					const auto hash = length >= 32
+						? InnerXXHash64Converge(accumulators)
+						: InnerHashFill<REGISTER>(seed + XXHash64Prime5);
+					Store(InnerXXHash64Tail(hash, stripes * 32, length, gather), reinterpret_cast<CHUNK&>(out[i]));
+					continue;
+				}
+
+				// Finish each string the old way									
+				CHUNK lanes[4];
+				for (Count a = 0; a < 4; ++a)
+					Store(accumulators[a], lanes[a]);
+
+				for (Count lane = 0; lane < L; ++lane) {
+					const auto bytes = data[lane];
+					const Count length = lengths[lane];
+					const auto load = [bytes](Count offset, Count size) noexcept {
+						::std::uint64_t word = 0;
+						::std::memcpy(&word, bytes + offset, size);
+						return word;
+					};
+
+					::std::uint64_t scalar[4] {lanes[0][lane], lanes[1][lane], lanes[2][lane], lanes[3][lane]};
+					InnerXXHash64Stripes(scalar, stripes, length / 32, load);
+					const auto hash = length >= 32 ? InnerXXHash64Converge(scalar) : seed + XXHash64Prime5;
+					out[i + lane] = InnerXXHash64Tail(hash, length / 32 * 32, length, load);
+				}
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i)
+			out[i] = XXHash64(in[i], seed);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,257 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Get the value of a hexadecimal digit												
+	///	@param digit - the digit, in either case										
+	///	@return the value of the digit, or -1 if not a hexadecimal digit		
+	NOD() constexpr int HexValue(::std::uint8_t digit) noexcept {
+		if (digit >= '0' && digit <= '9')
+			return digit - '0';
+		digit |= 0x20;
+		if (digit >= 'a' && digit <= 'f')
+			return digit - 'a' + 10;
+		return -1;
+	}
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Encode bytes as hexadecimal digits, high nibble first					
+		///	@param input - the bytes to encode											
+		///	@param digits - the sixteen digits to use, in each 16-byte lane	
+		///	@param output - [out] the digits of the bytes, in order				
+		template<class REGISTER>
+		LANGULUS(ALWAYSINLINE) void InnerHexEncode(REGISTER input, const REGISTER& digits, REGISTER(&output)[2]) noexcept {
+			if constexpr (CT::SIMD128<REGISTER>) {
+				const auto nibble = simde_mm_set1_epi8(0x0F);
+				const auto high = simde_mm_shuffle_epi8(digits, simde_mm_and_si128(simde_mm_srli_epi16(input, 4), nibble));
+				const auto low = simde_mm_shuffle_epi8(digits, simde_mm_and_si128(input, nibble));
+				output[0] = simde_mm_unpacklo_epi8(high, low);
+				output[1] = simde_mm_unpackhi_epi8(high, low);
+			}
+			else if constexpr (CT::SIMD256<REGISTER>) {
+				// Unpacking works inside lanes, so reorder the quarters first
+				input = simde_mm256_permute4x64_epi64(input, 0xD8);
+				const auto nibble = simde_mm256_set1_epi8(0x0F);
+				const auto high = simde_mm256_shuffle_epi8(digits, simde_mm256_and_si256(simde_mm256_srli_epi16(input, 4), nibble));
+				const auto low = simde_mm256_shuffle_epi8(digits, simde_mm256_and_si256(input, nibble));
+				output[0] = simde_mm256_unpacklo_epi8(high, low);
+				output[1] = simde_mm256_unpackhi_epi8(high, low);
+			}
+			else if constexpr (CT::SIMD512<REGISTER>) {
+				input = simde_mm512_permutexvar_epi64(simde_mm512_set_epi64(7, 3, 6, 2, 5, 1, 4, 0), input);
+				const auto nibble = simde_mm512_set1_epi8(0x0F);
+				const auto high = simde_mm512_shuffle_epi8(digits, simde_mm512_and_si512(simde_mm512_srli_epi16(input, 4), nibble));
+				const auto low = simde_mm512_shuffle_epi8(digits, simde_mm512_and_si512(input, nibble));
+				output[0] = simde_mm512_unpacklo_epi8(high, low);
+				output[1] = simde_mm512_unpackhi_epi8(high, low);
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHexEncode");
+		}
+
+		/// Decode hexadecimal digits of either case to bytes							
+		///	@param input - the digits to decode, high nibble first				
+		///	@param output - [out] the decoded bytes									
+		///	@return false if any of the characters isn't a hexadecimal digit	
+		template<class REGISTER>
+		NOD() LANGULUS(ALWAYSINLINE) bool InnerHexDecode(const REGISTER(&input)[2], REGISTER& output) noexcept {
+			REGISTER nibbles[2];
+			if constexpr (CT::SIMD128<REGISTER>) {
+				for (int r = 0; r < 2; ++r) {
+					const auto digit = simde_mm_sub_epi8(input[r], simde_mm_set1_epi8('0'));
+					const auto letter = simde_mm_sub_epi8(simde_mm_or_si128(input[r], simde_mm_set1_epi8(0x20)), simde_mm_set1_epi8('a'));
+					const auto isDigit = simde_mm_cmpeq_epi8(simde_mm_min_epu8(digit, simde_mm_set1_epi8(9)), digit);
+					const auto isLetter = simde_mm_cmpeq_epi8(simde_mm_min_epu8(letter, simde_mm_set1_epi8(5)), letter);
+					if (simde_mm_movemask_epi8(simde_mm_or_si128(isDigit, isLetter)) != 0xFFFF)
+						return false;
+
+					const auto values = simde_mm_or_si128(
+						simde_mm_and_si128(isDigit, digit),
+						simde_mm_andnot_si128(isDigit, simde_mm_add_epi8(letter, simde_mm_set1_epi8(10))));
+					nibbles[r] = simde_mm_maddubs_epi16(values, simde_mm_set1_epi16(0x0110));
+				}
+
+				output = simde_mm_packus_epi16(nibbles[0], nibbles[1]);
+				return true;
+			}
+			else if constexpr (CT::SIMD256<REGISTER>) {
+				for (int r = 0; r < 2; ++r) {
+					const auto digit = simde_mm256_sub_epi8(input[r], simde_mm256_set1_epi8('0'));
+					const auto letter = simde_mm256_sub_epi8(simde_mm256_or_si256(input[r], simde_mm256_set1_epi8(0x20)), simde_mm256_set1_epi8('a'));
+					const auto isDigit = simde_mm256_cmpeq_epi8(simde_mm256_min_epu8(digit, simde_mm256_set1_epi8(9)), digit);
+					const auto isLetter = simde_mm256_cmpeq_epi8(simde_mm256_min_epu8(letter, simde_mm256_set1_epi8(5)), letter);
+					if (simde_mm256_movemask_epi8(simde_mm256_or_si256(isDigit, isLetter)) != -1)
+						return false;
+
+					const auto values = simde_mm256_or_si256(
+						simde_mm256_and_si256(isDigit, digit),
+						simde_mm256_andnot_si256(isDigit, simde_mm256_add_epi8(letter, simde_mm256_set1_epi8(10))));
+					nibbles[r] = simde_mm256_maddubs_epi16(values, simde_mm256_set1_epi16(0x0110));
+				}
+
+				// Packing works inside lanes, so reorder the quarters after
+				output = simde_mm256_permute4x64_epi64(simde_mm256_packus_epi16(nibbles[0], nibbles[1]), 0xD8);
+				return true;
+			}
+			else if constexpr (CT::SIMD512<REGISTER>) {
+				for (int r = 0; r < 2; ++r) {
+					const auto digit = simde_mm512_sub_epi8(input[r], simde_mm512_set1_epi8('0'));
+					const auto letter = simde_mm512_sub_epi8(simde_mm512_or_si512(input[r], simde_mm512_set1_epi8(0x20)), simde_mm512_set1_epi8('a'));
+					const auto isDigit = simde_mm512_cmple_epu8_mask(digit, simde_mm512_set1_epi8(9));
+					const auto isLetter = simde_mm512_cmple_epu8_mask(letter, simde_mm512_set1_epi8(5));
+					if (~(isDigit | isLetter))
+						return false;
+
+					const auto values = simde_mm512_mask_blend_epi8(isDigit, simde_mm512_add_epi8(letter, simde_mm512_set1_epi8(10)), digit);
+					nibbles[r] = simde_mm512_maddubs_epi16(values, simde_mm512_set1_epi16(0x0110));
+				}
+
+				output = simde_mm512_permutexvar_epi64(simde_mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0),
+					simde_mm512_packus_epi16(nibbles[0], nibbles[1]));
+				return true;
+			}
+			else LANGULUS_ASSERT("Unsupported register for SIMD::InnerHexDecode");
+		}
+	#endif
+
+	/// Encode bytes as hexadecimal text, two digits per byte						
+	/// Encoding stops at the last byte that fits text									
+	///	@param bytes - the bytes to encode												
+	///	@param text - [out] the hexadecimal digits									
+	///	@param uppercase - whether to use uppercase letters for digits above 9
+	///	@return the number of characters written										
+	template<CT::Span IN, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count HexEncode(IN&& bytes, OUT&& text, bool uppercase = false) noexcept {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of bytes");
+		static_assert(sizeof(SpanType<OUT>) == 1, "Output must be a span of characters");
+		const Count count = ::std::ranges::size(bytes);
+		const Count capacity = ::std::ranges::size(text);
+		auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(bytes));
+		auto out = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(text));
+		const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+		Count i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			const auto lane = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(digits));
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			const auto digits512 = simde_mm512_broadcast_i32x4(lane);
+			for (; i + 64 <= count && 2 * (i + 64) <= capacity; i += 64) {
+				simde__m512i output[2];
+				InnerHexEncode(simde_mm512_loadu_si512(in + i), digits512, output);
+				simde_mm512_storeu_si512(out + 2 * i, output[0]);
+				simde_mm512_storeu_si512(out + 2 * i + 64, output[1]);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			const auto digits256 = simde_mm256_broadcastsi128_si256(lane);
+			for (; i + 32 <= count && 2 * (i + 32) <= capacity; i += 32) {
+				simde__m256i output[2];
+				InnerHexEncode(simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(in + i)), digits256, output);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + 2 * i), output[0]);
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + 2 * i + 32), output[1]);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			for (; i + 16 <= count && 2 * (i + 16) <= capacity; i += 16) {
+				simde__m128i output[2];
+				InnerHexEncode(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i)), lane, output);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + 2 * i), output[0]);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + 2 * i + 16), output[1]);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count && 2 * (i + 1) <= capacity; ++i) {
+			out[2 * i] = digits[in[i] >> 4];
+			out[2 * i + 1] = digits[in[i] & 0x0F];
+		}
+
+		return 2 * i;
+	}
+
+	/// Decode hexadecimal text of either case, two digits per byte				
+	/// Decoding stops at the last byte that fits output								
+	///	@param text - the hexadecimal digits to decode, high nibble first		
+	///	@param bytes - [out] the decoded bytes											
+	///	@return the number of bytes written												
+	template<CT::Span IN, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count HexDecode(IN&& text, OUT&& bytes) {
+		static_assert(sizeof(SpanType<IN>) == 1, "Input must be a span of characters");
+		static_assert(sizeof(SpanType<OUT>) == 1, "Output must be a span of bytes");
+		const Count count = ::std::ranges::size(text);
+		const Count capacity = ::std::ranges::size(bytes);
+		auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(text));
+		auto out = reinterpret_cast<::std::uint8_t*>(::std::ranges::data(bytes));
+		if (count % 2)
+			Throw<Except::Encoding>();
+
+		const Count total = count / 2 < capacity ? count / 2 : capacity;
+		Count i = 0;
+
+		#if LANGULUS_SIMD(512BIT)
+			for (; i + 64 <= total; i += 64) {
+				const simde__m512i input[2] {
+					simde_mm512_loadu_si512(in + 2 * i),
+					simde_mm512_loadu_si512(in + 2 * i + 64)
+				};
+				simde__m512i output;
+				if (!InnerHexDecode(input, output))
+					Throw<Except::Encoding>();
+				simde_mm512_storeu_si512(out + i, output);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			for (; i + 32 <= total; i += 32) {
+				const simde__m256i input[2] {
+					simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(in + 2 * i)),
+					simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i*>(in + 2 * i + 32))
+				};
+				simde__m256i output;
+				if (!InnerHexDecode(input, output))
+					Throw<Except::Encoding>();
+				simde_mm256_storeu_si256(reinterpret_cast<simde__m256i*>(out + i), output);
+			}
+		#endif
+
+		#if LANGULUS_SIMD(128BIT)
+			for (; i + 16 <= total; i += 16) {
+				const simde__m128i input[2] {
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + 2 * i)),
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + 2 * i + 16))
+				};
+				simde__m128i output;
+				if (!InnerHexDecode(input, output))
+					Throw<Except::Encoding>();
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i), output);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < total; ++i) {
+			const auto high = HexValue(in[2 * i]);
+			const auto low = HexValue(in[2 * i + 1]);
+			if (high < 0 || low < 0)
+				Throw<Except::Encoding>();
+			out[i] = static_cast<::std::uint8_t>((high << 4) | low);
+		}
+
+		return total;
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
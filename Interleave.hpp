@@ -0,0 +1,155 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include <array>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Byte shuffle masks for (de)interleaving N components of SIZE bytes		
+	/// A block is N 16-byte registers, holding 16 * N / SIZE elements			
+	/// For deinterleaving, mask[c][k] picks the bytes of component c that are	
+	/// inside interleaved register k. For interleaving, mask[k][c] picks the	
+	/// bytes of interleaved register k that come from component register c		
+	/// Bytes that don't come from the given source are set to 0x80, which		
+	/// makes pshufb zero them, so results can simply be OR-ed together			
+	///	@tparam N - number of components													
+	///	@tparam SIZE - size of a single component, in bytes						
+	///	@tparam INTERLEAVE - true to build interleaving masks						
+	template<Count N, Size SIZE, bool INTERLEAVE>
+	constexpr auto InterleaveMasks = []() {
+		::std::array<::std::array<::std::array<::std::int8_t, 16>, N>, N> masks {};
+		for (Count dst = 0; dst < N; ++dst) {
+			for (Count src = 0; src < N; ++src) {
+				for (Count b = 0; b < 16; ++b) {
+					if constexpr (INTERLEAVE) {
+						// Byte b of interleaved register dst						
+						const Count global = dst * 16 + b;
+						const Count element = global / SIZE;
+						const Count fromByte = (element / N) * SIZE + global % SIZE;
+						masks[dst][src][b] = element % N == src
+							? static_cast<::std::int8_t>(fromByte) : ::std::int8_t(-128);
+					}
+					else {
+						// Byte b of component register dst							
+						const Count global = ((b / SIZE) * N + dst) * SIZE + b % SIZE;
+						masks[dst][src][b] = global / 16 == src
+							? static_cast<::std::int8_t>(global % 16) : ::std::int8_t(-128);
+					}
+				}
+			}
+		}
+		return masks;
+	}();
+
+	/// Shuffle N registers into N other registers, using byte masks				
+	///	@tparam N - number of registers													
+	///	@tparam SIZE - size of a single component, in bytes						
+	///	@tparam INTERLEAVE - true to interleave, false to deinterleave			
+	///	@param from - the source registers												
+	///	@param to - [out] the shuffled registers										
+	template<Count N, Size SIZE, bool INTERLEAVE>
+	LANGULUS(ALWAYSINLINE) void InnerInterleave(const simde__m128i(&from)[N], simde__m128i(&to)[N]) noexcept {
+		constexpr auto& masks = InterleaveMasks<N, SIZE, INTERLEAVE>;
+		for (Count dst = 0; dst < N; ++dst) {
+			to[dst] = simde_mm_shuffle_epi8(from[0],
+				simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(masks[dst][0].data())));
+			for (Count src = 1; src < N; ++src) {
+				to[dst] = simde_mm_or_si128(to[dst], simde_mm_shuffle_epi8(from[src],
+					simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(masks[dst][src].data()))));
+			}
+		}
+	}
+
+	/// Split an interleaved stream (like xyzxyz... or rgbargba...) into one	
+	/// span per component (structure of arrays)											
+	///	@tparam N - number of interleaved components (2, 3 or 4)					
+	///	@param input - the interleaved elements										
+	///	@param output - [out] the component spans										
+	template<Count N, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void Deinterleave(IN&& input, OUT(&output)[N]) noexcept {
+		static_assert(N >= 2 && N <= 4, "Only 2, 3 or 4 components can be deinterleaved");
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(sizeof(T) <= 8 && 16 % sizeof(T) == 0, "Unsupported element size");
+
+		Count count = ::std::ranges::size(input) / N;
+		T* out[N];
+		for (Count c = 0; c < N; ++c) {
+			count = ::std::ranges::size(output[c]) < count ? ::std::ranges::size(output[c]) : count;
+			out[c] = ::std::ranges::data(output[c]);
+		}
+
+		const T* in = ::std::ranges::data(input);
+		Count i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count L = 16 / sizeof(T);
+			for (; i + L <= count; i += L) {
+				simde__m128i from[N], to[N];
+				for (Count k = 0; k < N; ++k)
+					from[k] = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i * N + k * L));
+				InnerInterleave<N, sizeof(T), false>(from, to);
+				for (Count c = 0; c < N; ++c)
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out[c] + i), to[c]);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			for (Count c = 0; c < N; ++c)
+				out[c][i] = in[i * N + c];
+		}
+	}
+
+	/// Merge one span per component (structure of arrays) into a single			
+	/// interleaved stream (like xyzxyz... or rgbargba...)							
+	///	@tparam N - number of components (2, 3 or 4)									
+	///	@param input - the component spans												
+	///	@param output - [out] the interleaved elements								
+	template<Count N, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void Interleave(const IN(&input)[N], OUT&& output) noexcept {
+		static_assert(N >= 2 && N <= 4, "Only 2, 3 or 4 components can be interleaved");
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(sizeof(T) <= 8 && 16 % sizeof(T) == 0, "Unsupported element size");
+
+		Count count = ::std::ranges::size(output) / N;
+		const T* in[N];
+		for (Count c = 0; c < N; ++c) {
+			count = ::std::ranges::size(input[c]) < count ? ::std::ranges::size(input[c]) : count;
+			in[c] = ::std::ranges::data(input[c]);
+		}
+
+		T* out = ::std::ranges::data(output);
+		Count i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count L = 16 / sizeof(T);
+			for (; i + L <= count; i += L) {
+				simde__m128i from[N], to[N];
+				for (Count c = 0; c < N; ++c)
+					from[c] = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in[c] + i));
+				InnerInterleave<N, sizeof(T), true>(from, to);
+				for (Count k = 0; k < N; ++k)
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i * N + k * L), to[k]);
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			for (Count c = 0; c < N; ++c)
+				out[i * N + c] = in[c][i];
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -9,6 +9,8 @@
 #include <immintrin.h>
 #include <Langulus.Core.hpp>
 #include <array>
+#include <bit>
+#include <limits>
 
 #include <simde/x86/avx2.h>
 #include <simde/x86/avx.h>
@@ -18,9 +20,13 @@
 #include <simde/x86/sse3.h>
 #include <simde/x86/sse2.h>
 #include <simde/x86/sse.h>
+#include <simde/x86/clmul.h>
+#include <simde/x86/f16c.h>
+#include <simde/x86/fma.h>
 #include <simde/x86/svml.h>
 
 LANGULUS_EXCEPTION(DivisionByZero);
+LANGULUS_EXCEPTION(Encoding);
 
 #define LANGULUS_SIMD(a) LANGULUS_SIMD_##a()
 
@@ -42,6 +48,9 @@ LANGULUS_EXCEPTION(DivisionByZero);
 #define LANGULUS_SIMD_SSE3() 0
 #define LANGULUS_SIMD_SSE2() 0
 #define LANGULUS_SIMD_SSE() 0
+#define LANGULUS_SIMD_PCLMUL() 0
+#define LANGULUS_SIMD_F16C() 0
+#define LANGULUS_SIMD_FMA() 0
 
 /// Categorization based on register size													
 #define LANGULUS_SIMD_128BIT() 0
@@ -164,8 +173,188 @@ LANGULUS_EXCEPTION(DivisionByZero);
 	#define LANGULUS_SIMD_128BIT() 1
 #endif
 
+#if defined(__PCLMUL__) && LANGULUS_ALIGNMENT >= 16
+	#undef LANGULUS_SIMD_PCLMUL
+	#define LANGULUS_SIMD_PCLMUL() 1
+#endif
+
+#if defined(__F16C__) && LANGULUS_ALIGNMENT >= 16
+	#undef LANGULUS_SIMD_F16C
+	#define LANGULUS_SIMD_F16C() 1
+#endif
+
+#if defined(__FMA__) && LANGULUS_ALIGNMENT >= 16
+	#undef LANGULUS_SIMD_FMA
+	#define LANGULUS_SIMD_FMA() 1
+#endif
+
 #include "IgnoreWarningsPush.inl"
 
+namespace Langulus
+{
+
+	/// IEEE 754 half precision real number, as it is stored in memory			
+	/// There is no arithmetic on it - it converts to and from float, and all	
+	/// SIMD operations widen it to float on load and narrow it on store			
+	struct Float16 {
+		::std::uint16_t mBits = 0;
+
+		constexpr Float16() noexcept = default;
+
+		/// Round a single precision number to the nearest half precision one	
+		///	@param value - the number to round											
+		constexpr Float16(float value) noexcept {
+			auto bits = ::std::bit_cast<::std::uint32_t>(value);
+			const auto sign = static_cast<::std::uint16_t>((bits >> 16) & 0x8000);
+			bits &= 0x7FFFFFFF;
+
+			if (bits >= 0x47800000) {
+				// Too big, infinity, or NaN - quieten the latter				
+				mBits = bits > 0x7F800000 ? 0x7E00 : 0x7C00;
+			}
+			else if (bits < 0x38800000) {
+				// Becomes denormal or zero, so let float addition round		
+				mBits = static_cast<::std::uint16_t>(::std::bit_cast<::std::uint32_t>(
+					::std::bit_cast<float>(bits) + 0.5f) - 0x3F000000);
+			}
+			else {
+				// Rebias the exponent, and round to nearest even				
+				bits += 0xC8000FFF + ((bits >> 13) & 1);
+				mBits = static_cast<::std::uint16_t>(bits >> 13);
+			}
+			mBits |= sign;
+		}
+
+		/// Widen to single precision, which is always exact							
+		constexpr operator float() const noexcept {
+			auto bits = static_cast<::std::uint32_t>(mBits & 0x7FFF) << 13;
+			const auto exponent = bits & 0x0F800000;
+			bits += 0x38000000;
+			if (exponent == 0x0F800000)
+				bits += 0x38000000;
+			else if (exponent == 0) {
+				// Denormal or zero, so let float subtraction normalize it	
+				bits = ::std::bit_cast<::std::uint32_t>(
+					::std::bit_cast<float>(bits + 0x00800000) - ::std::bit_cast<float>(0x38800000u));
+			}
+			return ::std::bit_cast<float>(bits | (static_cast<::std::uint32_t>(mBits & 0x8000) << 16));
+		}
+	};
+
+	/// Brain floating point number - the upper half of a float, as it is		
+	/// stored in memory. Like Float16, it is operated on as a float				
+	struct BFloat16 {
+		::std::uint16_t mBits = 0;
+
+		constexpr BFloat16() noexcept = default;
+
+		/// Round a single precision number to the nearest bfloat16 one			
+		///	@param value - the number to round											
+		constexpr BFloat16(float value) noexcept {
+			const auto bits = ::std::bit_cast<::std::uint32_t>(value);
+			if ((bits & 0x7FFFFFFF) > 0x7F800000)
+				mBits = static_cast<::std::uint16_t>((bits >> 16) | 0x40);
+			else
+				mBits = static_cast<::std::uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+		}
+
+		/// Widen to single precision, which is always exact							
+		constexpr operator float() const noexcept {
+			return ::std::bit_cast<float>(static_cast<::std::uint32_t>(mBits) << 16);
+		}
+	};
+
+	/// Signed fixed point number, with FRACTION of its bits after the point	
+	/// SIMD operations work on the integer that holds it, and saturate			
+	///	@tparam T - the integer that holds the number, int16_t or int32_t		
+	///	@tparam FRACTION - how many of the bits are after the point				
+	template<class T, int FRACTION>
+	struct FixedPoint {
+		static_assert(CT::SignedInteger<T> && (sizeof(T) == 2 || sizeof(T) == 4),
+			"Fixed point numbers are held only in 16-bit or 32-bit signed integers");
+		static_assert(FRACTION > 0 && FRACTION < static_cast<int>(sizeof(T) * 8),
+			"Fixed point numbers need at least one bit after the point");
+
+		using Type = T;
+		static constexpr int Fraction = FRACTION;
+
+		T mBits = 0;
+
+		constexpr FixedPoint() noexcept = default;
+
+		/// Round a real number to the nearest even fixed point one					
+		/// NaN becomes zero, and numbers out of range saturate						
+		///	@param value - the number to round											
+		constexpr FixedPoint(double value) noexcept {
+			if (value != value)
+				return;
+
+			constexpr double lo = ::std::numeric_limits<T>::min();
+			constexpr double hi = ::std::numeric_limits<T>::max();
+			double scaled = value * static_cast<double>(1ll << FRACTION);
+			scaled = scaled < lo ? lo : scaled > hi ? hi : scaled;
+
+			// Scaled number is in range, so its fraction is exact			
+			auto whole = static_cast<::std::int64_t>(scaled);
+			const double rest = scaled - static_cast<double>(whole);
+			if (rest > 0.5 || (rest == 0.5 && (whole & 1)))
+				++whole;
+			else if (rest < -0.5 || (rest == -0.5 && (whole & 1)))
+				--whole;
+			mBits = static_cast<T>(whole);
+		}
+
+		/// Make a fixed point number from the integer that holds it				
+		///	@param bits - the integer														
+		///	@return the fixed point number												
+		NOD() static constexpr FixedPoint FromBits(T bits) noexcept {
+			FixedPoint result;
+			result.mBits = bits;
+			return result;
+		}
+
+		/// Clamp a wider integer to the range of the one that holds us			
+		NOD() static constexpr FixedPoint Saturate(::std::int64_t bits) noexcept {
+			using L = ::std::numeric_limits<T>;
+			return FromBits(static_cast<T>(bits < L::min() ? L::min() : bits > L::max() ? L::max() : bits));
+		}
+
+		/// Convert to single precision, rounding if more than 24 bits are used	
+		constexpr operator float() const noexcept {
+			return static_cast<float>(mBits) / static_cast<float>(1ll << FRACTION);
+		}
+
+		/// Convert to double precision, which is always exact						
+		constexpr explicit operator double() const noexcept {
+			return static_cast<double>(mBits) / static_cast<double>(1ll << FRACTION);
+		}
+
+		NOD() friend constexpr FixedPoint operator + (FixedPoint lhs, FixedPoint rhs) noexcept {
+			return Saturate(static_cast<::std::int64_t>(lhs.mBits) + rhs.mBits);
+		}
+
+		NOD() friend constexpr FixedPoint operator - (FixedPoint lhs, FixedPoint rhs) noexcept {
+			return Saturate(static_cast<::std::int64_t>(lhs.mBits) - rhs.mBits);
+		}
+
+		/// Multiply, rounding half up, like _mm_mulhrs_epi16 does for Q15		
+		NOD() friend constexpr FixedPoint operator * (FixedPoint lhs, FixedPoint rhs) noexcept {
+			const auto product = static_cast<::std::int64_t>(lhs.mBits) * rhs.mBits;
+			return Saturate((product + (1ll << (FRACTION - 1))) >> FRACTION);
+		}
+
+		NOD() friend constexpr bool operator == (FixedPoint, FixedPoint) noexcept = default;
+	};
+
+	/// Fixed point numbers in [-1, 1), commonly used in signal processing		
+	using Q15 = FixedPoint<::std::int16_t, 15>;
+	using Q31 = FixedPoint<::std::int32_t, 31>;
+
+	/// Fixed point numbers in [-128, 128), with 8 bits after the point			
+	using Q8_8 = FixedPoint<::std::int16_t, 8>;
+
+} // namespace Langulus
+
 namespace Langulus::CT
 {
 
@@ -200,10 +389,48 @@ namespace Langulus::CT
 	template<class T>
 	concept NotSupported = Same<T, Inner::NotSupported>;
 
+	/// Half precision real number concept												
+	template<class T>
+	concept RealHP = Same<::Langulus::Float16, T>;
+
+	/// Brain floating point number concept												
+	template<class T>
+	concept RealBF16 = Same<::Langulus::BFloat16, T>;
+
+	/// Any 16-bit real number concept - these are widened to single precision	
+	/// for any arithmetic																		
+	template<class T>
+	concept RealHalf = RealHP<T> || RealBF16<T>;
+
+	namespace Inner
+	{
+		template<class T>
+		constexpr bool IsFixedPoint = false;
+		template<class T, int FRACTION>
+		constexpr bool IsFixedPoint<::Langulus::FixedPoint<T, FRACTION>> = true;
+	}
+
+	/// Fixed point number concept															
+	template<class T>
+	concept FixedPoint = Inner::IsFixedPoint<T>;
+
+	/// Fixed point numbers held in 16-bit or 32-bit integers						
+	template<class T>
+	concept FixedPoint16 = FixedPoint<T> && sizeof(T) == 2;
+	template<class T>
+	concept FixedPoint32 = FixedPoint<T> && sizeof(T) == 4;
+
+	namespace Inner
+	{
+		/// Type that a number is operated on as										
+		template<class T>
+		using Widened = Conditional<RealHalf<T>, float, Decay<T>>;
+	}
+
 	/// When given two arithmetic types, choose the one that is most lossless	
 	/// after an arithmetic operation of any kind is performed between both		
 	template<class T1, class T2>
-	using Lossless = Conditional<
+	using LosslessOf = Conditional<
 			// Always pick real numbers over integers if available			
 			(Real<T1> && Integer<T2>)
 			// Always pick signed type if available								
@@ -212,6 +439,10 @@ namespace Langulus::CT
 			|| (sizeof(Decay<T1>) > sizeof(Decay<T2>)
 		), Decay<T1>, Decay<T2>>;
 
+	/// Half precision numbers are always widened to single precision first		
+	template<class T1, class T2>
+	using Lossless = LosslessOf<Inner::Widened<T1>, Inner::Widened<T2>>;
+
 	/// Byte concept																				
 	template<class T>
 	concept Byte = Same<::Langulus::Byte, T>;
@@ -276,6 +507,97 @@ namespace Langulus::SIMD
 		return simde_mm_add_pd(f, simde_mm_castsi128_pd(xL));
 	}
 
+	inline simde__m256d uint64_to_double_full(simde__m256i x) {
+		simde__m256i xH = simde_mm256_srli_epi64(x, 32);
+		xH = simde_mm256_or_si256(xH, simde_mm256_castpd_si256(simde_mm256_set1_pd(19342813113834066795298816.)));       //  2^84
+		simde__m256i xL = simde_mm256_blend_epi16(x, simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0010000000000000)), 0xcc);   //  2^52
+		simde__m256d f = simde_mm256_sub_pd(simde_mm256_castsi256_pd(xH), simde_mm256_set1_pd(19342813118337666422669312.));  //  2^84 + 2^52
+		return simde_mm256_add_pd(f, simde_mm256_castsi256_pd(xL));
+	}
+
+	inline simde__m256d int64_to_double_full(simde__m256i x) {
+		simde__m256i xH = simde_mm256_srai_epi32(x, 16);
+		xH = simde_mm256_blend_epi16(xH, simde_mm256_setzero_si256(), 0x33);
+		xH = simde_mm256_add_epi64(xH, simde_mm256_castpd_si256(simde_mm256_set1_pd(442721857769029238784.)));           //  3*2^67
+		simde__m256i xL = simde_mm256_blend_epi16(x, simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0010000000000000)), 0x88);   //  2^52
+		simde__m256d f = simde_mm256_sub_pd(simde_mm256_castsi256_pd(xH), simde_mm256_set1_pd(442726361368656609280.));       //  3*2^67 + 2^52
+		return simde_mm256_add_pd(f, simde_mm256_castsi256_pd(xL));
+	}
+
+	/// Works for all inputs in the range of int64_t, rounding to nearest		
+	/// even, like _mm_cvtpd_epi64 does with the default rounding mode			
+	/// Numbers below 2^52 get their fraction rounded away, bigger ones are		
+	/// always whole, so their mantissa is just shifted into place					
+	inline simde__m128i double_to_int64_full(simde__m128d x) {
+		const auto magic = simde_mm_set1_pd(0x0010000000000000);
+		const auto magnitude = simde_mm_andnot_pd(simde_mm_set1_pd(-0.0), x);
+		const auto rounded = simde_mm_sub_pd(simde_mm_add_pd(magnitude, magic), magic);
+		const auto bits = simde_mm_castpd_si128(simde_mm_blendv_pd(magnitude, rounded, simde_mm_cmplt_pd(magnitude, magic)));
+		const auto shift = simde_mm_sub_epi64(simde_mm_srli_epi64(bits, 52), simde_mm_set1_epi64x(1075));
+		const auto mantissa = simde_mm_or_si128(
+			simde_mm_and_si128(bits, simde_mm_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+			simde_mm_set1_epi64x(0x0010000000000000ll)
+		);
+
+		// Shifts of 64 and more give zero, so only one of these remains	
+		const auto whole = simde_mm_or_si128(
+			simde_mm_sllv_epi64(mantissa, shift),
+			simde_mm_srlv_epi64(mantissa, simde_mm_sub_epi64(simde_mm_setzero_si128(), shift))
+		);
+		const auto sign = simde_mm_castpd_si128(simde_mm_cmplt_pd(x, simde_mm_setzero_pd()));
+		return simde_mm_sub_epi64(simde_mm_xor_si128(whole, sign), sign);
+	}
+
+	/// Works for all inputs in the range of uint64_t, rounding to nearest		
+	/// even, like _mm_cvtpd_epu64 does with the default rounding mode			
+	inline simde__m128i double_to_uint64_full(simde__m128d x) {
+		const auto magic = simde_mm_set1_pd(0x0010000000000000);
+		const auto rounded = simde_mm_sub_pd(simde_mm_add_pd(x, magic), magic);
+		const auto bits = simde_mm_castpd_si128(simde_mm_blendv_pd(x, rounded, simde_mm_cmplt_pd(x, magic)));
+		const auto shift = simde_mm_sub_epi64(simde_mm_srli_epi64(bits, 52), simde_mm_set1_epi64x(1075));
+		const auto mantissa = simde_mm_or_si128(
+			simde_mm_and_si128(bits, simde_mm_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+			simde_mm_set1_epi64x(0x0010000000000000ll)
+		);
+		return simde_mm_or_si128(
+			simde_mm_sllv_epi64(mantissa, shift),
+			simde_mm_srlv_epi64(mantissa, simde_mm_sub_epi64(simde_mm_setzero_si128(), shift))
+		);
+	}
+
+	inline simde__m256i double_to_int64_full(simde__m256d x) {
+		const auto magic = simde_mm256_set1_pd(0x0010000000000000);
+		const auto magnitude = simde_mm256_andnot_pd(simde_mm256_set1_pd(-0.0), x);
+		const auto rounded = simde_mm256_sub_pd(simde_mm256_add_pd(magnitude, magic), magic);
+		const auto bits = simde_mm256_castpd_si256(simde_mm256_blendv_pd(magnitude, rounded, simde_mm256_cmp_pd(magnitude, magic, _CMP_LT_OQ)));
+		const auto shift = simde_mm256_sub_epi64(simde_mm256_srli_epi64(bits, 52), simde_mm256_set1_epi64x(1075));
+		const auto mantissa = simde_mm256_or_si256(
+			simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+			simde_mm256_set1_epi64x(0x0010000000000000ll)
+		);
+		const auto whole = simde_mm256_or_si256(
+			simde_mm256_sllv_epi64(mantissa, shift),
+			simde_mm256_srlv_epi64(mantissa, simde_mm256_sub_epi64(simde_mm256_setzero_si256(), shift))
+		);
+		const auto sign = simde_mm256_castpd_si256(simde_mm256_cmp_pd(x, simde_mm256_setzero_pd(), _CMP_LT_OQ));
+		return simde_mm256_sub_epi64(simde_mm256_xor_si256(whole, sign), sign);
+	}
+
+	inline simde__m256i double_to_uint64_full(simde__m256d x) {
+		const auto magic = simde_mm256_set1_pd(0x0010000000000000);
+		const auto rounded = simde_mm256_sub_pd(simde_mm256_add_pd(x, magic), magic);
+		const auto bits = simde_mm256_castpd_si256(simde_mm256_blendv_pd(x, rounded, simde_mm256_cmp_pd(x, magic, _CMP_LT_OQ)));
+		const auto shift = simde_mm256_sub_epi64(simde_mm256_srli_epi64(bits, 52), simde_mm256_set1_epi64x(1075));
+		const auto mantissa = simde_mm256_or_si256(
+			simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+			simde_mm256_set1_epi64x(0x0010000000000000ll)
+		);
+		return simde_mm256_or_si256(
+			simde_mm256_sllv_epi64(mantissa, shift),
+			simde_mm256_srlv_epi64(mantissa, simde_mm256_sub_epi64(simde_mm256_setzero_si256(), shift))
+		);
+	}
+
 	/// Only works for inputs in the range: [-2^51, 2^51]								
 	inline simde__m128d int64_to_double(simde__m128i x) {
 		x = simde_mm_add_epi64(x, simde_mm_castpd_si128(simde_mm_set1_pd(0x0018000000000000)));
@@ -306,6 +628,217 @@ namespace Langulus::SIMD
 		);
 	}
 
+	inline simde__m256d int64_to_double(simde__m256i x) {
+		x = simde_mm256_add_epi64(x, simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0018000000000000)));
+		return simde_mm256_sub_pd(simde_mm256_castsi256_pd(x), simde_mm256_set1_pd(0x0018000000000000));
+	}
+
+	inline simde__m256d uint64_to_double(simde__m256i x) {
+		x = simde_mm256_or_si256(x, simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0010000000000000)));
+		return simde_mm256_sub_pd(simde_mm256_castsi256_pd(x), simde_mm256_set1_pd(0x0010000000000000));
+	}
+
+	inline simde__m256i double_to_int64(simde__m256d x) {
+		x = simde_mm256_add_pd(x, simde_mm256_set1_pd(0x0018000000000000));
+		return simde_mm256_sub_epi64(
+			simde_mm256_castpd_si256(x),
+			simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0018000000000000))
+		);
+	}
+
+	inline simde__m256i double_to_uint64(simde__m256d x) {
+		x = simde_mm256_add_pd(x, simde_mm256_set1_pd(0x0010000000000000));
+		return simde_mm256_xor_si256(
+			simde_mm256_castpd_si256(x),
+			simde_mm256_castpd_si256(simde_mm256_set1_pd(0x0010000000000000))
+		);
+	}
+
+	/// Works for all inputs in the range of uint32_t, as the upper half is		
+	/// converted with its top bit taken away, and put back afterwards			
+	inline simde__m128i float_to_uint32(simde__m128 x) {
+		const auto big = simde_mm_cmpge_ps(x, simde_mm_set1_ps(2147483648.f));
+		x = simde_mm_sub_ps(x, simde_mm_and_ps(big, simde_mm_set1_ps(2147483648.f)));
+		return simde_mm_xor_si128(
+			simde_mm_cvtps_epi32(x),
+			simde_mm_slli_epi32(simde_mm_castps_si128(big), 31)
+		);
+	}
+
+	inline simde__m256i float_to_uint32(simde__m256 x) {
+		const auto big = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(2147483648.f), _CMP_GE_OQ);
+		x = simde_mm256_sub_ps(x, simde_mm256_and_ps(big, simde_mm256_set1_ps(2147483648.f)));
+		return simde_mm256_xor_si256(
+			simde_mm256_cvtps_epi32(x),
+			simde_mm256_slli_epi32(simde_mm256_castps_si256(big), 31)
+		);
+	}
+
+	/// Works for all inputs in the range of uint32_t - doubles are precise		
+	/// enough to shift the whole range down, so no lanes need picking			
+	inline simde__m128i double_to_uint32(simde__m128d x) {
+		x = simde_mm_sub_pd(x, simde_mm_set1_pd(2147483648.0));
+		return simde_mm_xor_si128(
+			simde_mm_cvtpd_epi32(x),
+			simde_mm_set_epi32(0, 0, INT32_MIN, INT32_MIN)
+		);
+	}
+
+	inline simde__m128i double_to_uint32(simde__m256d x) {
+		x = simde_mm256_sub_pd(x, simde_mm256_set1_pd(2147483648.0));
+		return simde_mm_xor_si128(
+			simde_mm256_cvtpd_epi32(x),
+			simde_mm_set1_epi32(INT32_MIN)
+		);
+	}
+
+	/// How SIMD::Convert rounds real numbers to integers - either as MXCSR		
+	/// says, nearest even by default, or explicitly, regardless of it			
+	enum class ConvertRounding {
+		Current,
+		Nearest,
+		Truncate,
+		Floor,
+		Ceil
+	};
+
+	/// Options for SIMD::Convert																
+	struct ConvertPolicy {
+		/// Convert between 64-bit integers and doubles with the cheaper			
+		/// tricks above, that only work in [-2^51, 2^51] or [0, 2^52)				
+		/// The default conversion is exact over the whole 64-bit range			
+		bool mFastRange = false;
+
+		/// How reals are rounded when converted to integers							
+		/// Anything but Current gives the same results regardless of MXCSR		
+		ConvertRounding mRounding = ConvertRounding::Current;
+
+		/// Clamp reals to the range of the integer they're converted to			
+		/// By default, out of range numbers give whatever the hardware does		
+		bool mSaturate = false;
+
+		/// Convert NaN to zero, instead of whatever the hardware does				
+		bool mNaNToZero = false;
+	};
+
+	/// Convert 64-bit integers to doubles, as the policy says						
+	/// Uses AVX512DQ if available, because it is both exact and fastest			
+	///	@tparam POLICY - the conversion options										
+	///	@tparam FT - int64_t or uint64_t, the type contained in the input		
+	///	@param v - the integers to convert												
+	///	@return the doubles																	
+	template<ConvertPolicy POLICY, CT::Integer64 FT, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerConvertInt64(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+				if constexpr (CT::SignedInteger64<FT>)
+					return simde_mm_cvtepi64_pd(v);
+				else
+					return simde_mm_cvtepu64_pd(v);
+			#else
+				if constexpr (CT::SignedInteger64<FT>)
+					return POLICY.mFastRange ? int64_to_double(v) : int64_to_double_full(v);
+				else
+					return POLICY.mFastRange ? uint64_to_double(v) : uint64_to_double_full(v);
+			#endif
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+				if constexpr (CT::SignedInteger64<FT>)
+					return simde_mm256_cvtepi64_pd(v);
+				else
+					return simde_mm256_cvtepu64_pd(v);
+			#else
+				if constexpr (CT::SignedInteger64<FT>)
+					return POLICY.mFastRange ? int64_to_double(v) : int64_to_double_full(v);
+				else
+					return POLICY.mFastRange ? uint64_to_double(v) : uint64_to_double_full(v);
+			#endif
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			if constexpr (CT::SignedInteger64<FT>)
+				return simde_mm512_cvtepi64_pd(v);
+			else
+				return simde_mm512_cvtepu64_pd(v);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertInt64");
+	}
+
+	/// Convert doubles to 64-bit integers, rounding to nearest even				
+	/// Uses AVX512DQ if available, because it is both exact and fastest			
+	///	@tparam POLICY - the conversion options										
+	///	@tparam TT - int64_t or uint64_t, the type to convert to					
+	///	@param v - the doubles to convert												
+	///	@return the integers																	
+	template<ConvertPolicy POLICY, CT::Integer64 TT, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerConvertToInt64(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128d>) {
+			#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+				if constexpr (CT::SignedInteger64<TT>)
+					return simde_mm_cvtpd_epi64(v);
+				else
+					return simde_mm_cvtpd_epu64(v);
+			#else
+				if constexpr (CT::SignedInteger64<TT>)
+					return POLICY.mFastRange ? double_to_int64(v) : double_to_int64_full(v);
+				else
+					return POLICY.mFastRange ? double_to_uint64(v) : double_to_uint64_full(v);
+			#endif
+		}
+		else if constexpr (CT::Same<R, simde__m256d>) {
+			#if LANGULUS_SIMD(AVX512DQ) && LANGULUS_SIMD(AVX512VL)
+				if constexpr (CT::SignedInteger64<TT>)
+					return simde_mm256_cvtpd_epi64(v);
+				else
+					return simde_mm256_cvtpd_epu64(v);
+			#else
+				if constexpr (CT::SignedInteger64<TT>)
+					return POLICY.mFastRange ? double_to_int64(v) : double_to_int64_full(v);
+				else
+					return POLICY.mFastRange ? double_to_uint64(v) : double_to_uint64_full(v);
+			#endif
+		}
+		else if constexpr (CT::Same<R, simde__m512d>) {
+			if constexpr (CT::SignedInteger64<TT>)
+				return simde_mm512_cvtpd_epi64(v);
+			else
+				return simde_mm512_cvtpd_epu64(v);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertToInt64");
+	}
+
+	/// Convert 64-bit integers to floats, rounding only once, like a cast		
+	/// Going through doubles rounds twice, and can be one ulp off. So the		
+	/// integers a double can't hold exactly get their lowest eleven bits		
+	/// folded into a single sticky bit first - that makes them exact in a		
+	/// double, without changing which float they round to							
+	///	@tparam POLICY - the conversion options										
+	///	@tparam FT - int64_t or uint64_t, the type contained in the input		
+	///	@param v - the integers to convert												
+	///	@return the floats, in the lower half of a register if v is 256-bit	
+	template<ConvertPolicy POLICY, CT::Integer64 FT, CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerConvertInt64ToFloat(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			const auto low = simde_mm_set1_epi64x(0x7FF);
+			const auto folded = simde_mm_or_si128(simde_mm_andnot_si128(low, v), simde_mm_and_si128(
+				simde_mm_add_epi64(simde_mm_and_si128(v, low), low), simde_mm_set1_epi64x(0x800)));
+			const auto exact = InnerConvertInt64<POLICY, FT>(v);
+			const auto big = simde_mm_cmpge_pd(
+				simde_mm_andnot_pd(simde_mm_set1_pd(-0.0), exact), simde_mm_set1_pd(0x1p53));
+			return simde_mm_cvtpd_ps(simde_mm_blendv_pd(exact, InnerConvertInt64<POLICY, FT>(folded), big));
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			const auto low = simde_mm256_set1_epi64x(0x7FF);
+			const auto folded = simde_mm256_or_si256(simde_mm256_andnot_si256(low, v), simde_mm256_and_si256(
+				simde_mm256_add_epi64(simde_mm256_and_si256(v, low), low), simde_mm256_set1_epi64x(0x800)));
+			const auto exact = InnerConvertInt64<POLICY, FT>(v);
+			const auto big = simde_mm256_cmp_pd(
+				simde_mm256_andnot_pd(simde_mm256_set1_pd(-0.0), exact), simde_mm256_set1_pd(0x1p53), _CMP_GE_OQ);
+			return simde_mm256_cvtpd_ps(simde_mm256_blendv_pd(exact, InnerConvertInt64<POLICY, FT>(folded), big));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerConvertInt64ToFloat");
+	}
+
 	/// Shuffle eight indices																	
 	NOD() constexpr int Shuffle(int&& z1, int&& y1, int&& x1, int&& w1, int&& z0, int&& y0, int&& x0, int&& w0) noexcept {
 		// 8 indices, 4 bits each														
@@ -533,6 +1066,21 @@ namespace Langulus::SIMD
 		}
 	}
 
+	/// Extract the result of a fallback into an output array						
+	/// Numbers are converted one by one if types differ, for example when a	
+	/// float result is narrowed to Float16												
+	///	@param result - the result of the fallback									
+	///	@param output - [out] the array to extract to								
+	template<class T, Count S, class OUT>
+	LANGULUS(ALWAYSINLINE) void StoreFallback(const ::std::array<T, S>& result, OUT& output) noexcept {
+		if constexpr (CT::Same<T, OUT>)
+			::std::memcpy(output, result.data(), sizeof(output));
+		else {
+			for (Count i = 0; i < S && i < ExtentOf<OUT>; ++i)
+				DenseCast(output[i]) = static_cast<Decay<OUT>>(result[i]);
+		}
+	}
+
 } // namespace Langulus::SIMD
 
 #include "IgnoreWarningsPop.inl"
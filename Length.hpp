@@ -0,0 +1,36 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Dot.hpp"
+#include "Sqrt.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Get the length of a vector															
+	///	@param value - the vector															
+	///	@return the length																	
+	template<class T, Count S>
+	NOD() LANGULUS(ALWAYSINLINE) T Length(const T(&value)[S]) noexcept {
+		return ::std::sqrt(Dot(value, value));
+	}
+
+	/// Get the lengths of a batch of vectors, stored as structure of arrays	
+	///	@tparam C - number of components (deducible)									
+	///	@param input - the components, one span per component						
+	///	@param output - [out] the lengths												
+	template<Count C, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void LengthSpan(const IN(&input)[C], OUT&& output) noexcept {
+		DotSpan(input, input, output);
+		SqrtSpan(output);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
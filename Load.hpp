@@ -7,6 +7,7 @@
 ///																									
 #pragma once
 #include "SetGet.hpp"
+#include "ConvertHalf.hpp"
 #include "IgnoreWarningsPush.inl"
 
 namespace Langulus::SIMD
@@ -22,6 +23,30 @@ namespace Langulus::SIMD
 	LANGULUS(ALWAYSINLINE) auto Load(const T(&v)[S]) noexcept {
 		constexpr auto denseSize = sizeof(Decay<T>) * S;
 
+		if constexpr (CT::RealHalf<T>) {
+			// 16-bit reals are widened to a float register on load		
+			using WIDE = decltype(Load<DEF>(Uneval<float[S]>()));
+			if constexpr (CT::NotSupported<WIDE>)
+				return CT::Inner::NotSupported {};
+			else {
+				constexpr Count N = sizeof(WIDE) / sizeof(float);
+				if constexpr (N == S && CT::Dense<T>)
+					return InnerLoadHalf<Decay<T>, WIDE>(v);
+				else {
+					// Pad the rest with DEF											
+					Decay<T> padded[N];
+					for (Count i = 0; i < N; ++i)
+						padded[i] = i < S ? DenseCast(v[i]) : Decay<T>(static_cast<float>(DEF));
+					return InnerLoadHalf<Decay<T>, WIDE>(padded);
+				}
+			}
+		}
+		else if constexpr (CT::FixedPoint<T>) {
+			// Fixed point numbers are loaded as the integers that hold them
+			return Load<DEF>(reinterpret_cast<const typename T::Type(&)[S]>(v));
+		}
+		else
+
 		#if LANGULUS_SIMD(128BIT)
 			if constexpr (denseSize <= 16) {
 				// Load as a single 128bit register									
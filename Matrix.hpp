@@ -0,0 +1,403 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Add.hpp"
+#include "Multiply.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+///																									
+///	4x4 matrix kernels																		
+///																									
+/// Matrices are 16 consecutive real numbers in row-major order, and				
+/// vectors are treated as columns, so transforming is M * v. All outputs		
+/// can safely be the same arrays as any of the inputs								
+///																									
+namespace Langulus::SIMD
+{
+
+	/// Transpose a 4x4 matrix																	
+	///	@param value - the matrix to transpose											
+	///	@param output - [out] the transposed matrix									
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void Transpose4x4(const T(&value)[16], T(&output)[16]) noexcept {
+		static_assert(CT::Real<T>, "SIMD::Transpose4x4 is implemented only for real numbers");
+
+	#if LANGULUS_SIMD(512BIT)
+		if constexpr (CT::RealSP<T>) {
+			// The whole matrix fits in a single register						
+			const auto idx = simde_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+			simde_mm512_storeu_ps(output, simde_mm512_permutexvar_ps(idx, simde_mm512_loadu_ps(value)));
+		}
+		else {
+			const auto r01 = simde_mm512_loadu_pd(value);
+			const auto r23 = simde_mm512_loadu_pd(value + 8);
+			const auto c01 = simde_mm512_permutex2var_pd(r01, simde_mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13), r23);
+			const auto c23 = simde_mm512_permutex2var_pd(r01, simde_mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15), r23);
+			simde_mm512_storeu_pd(output, c01);
+			simde_mm512_storeu_pd(output + 8, c23);
+		}
+	#elif LANGULUS_SIMD(256BIT)
+		if constexpr (CT::RealSP<T>) {
+			// Two rows per register, so shuffle across lanes as well		
+			const auto r01 = simde_mm256_loadu_ps(value);
+			const auto r23 = simde_mm256_loadu_ps(value + 8);
+			const auto t0 = simde_mm256_unpacklo_ps(r01, r23);
+			const auto t1 = simde_mm256_unpackhi_ps(r01, r23);
+			const auto p0 = simde_mm256_permute2f128_ps(t0, t1, 0x20);
+			const auto p1 = simde_mm256_permute2f128_ps(t0, t1, 0x31);
+			const auto c02 = simde_mm256_unpacklo_ps(p0, p1);
+			const auto c13 = simde_mm256_unpackhi_ps(p0, p1);
+			simde_mm256_storeu_ps(output, simde_mm256_permute2f128_ps(c02, c13, 0x20));
+			simde_mm256_storeu_ps(output + 8, simde_mm256_permute2f128_ps(c02, c13, 0x31));
+		}
+		else {
+			const auto r0 = simde_mm256_loadu_pd(value);
+			const auto r1 = simde_mm256_loadu_pd(value + 4);
+			const auto r2 = simde_mm256_loadu_pd(value + 8);
+			const auto r3 = simde_mm256_loadu_pd(value + 12);
+			const auto t0 = simde_mm256_unpacklo_pd(r0, r1);
+			const auto t1 = simde_mm256_unpackhi_pd(r0, r1);
+			const auto t2 = simde_mm256_unpacklo_pd(r2, r3);
+			const auto t3 = simde_mm256_unpackhi_pd(r2, r3);
+			simde_mm256_storeu_pd(output, simde_mm256_permute2f128_pd(t0, t2, 0x20));
+			simde_mm256_storeu_pd(output + 4, simde_mm256_permute2f128_pd(t1, t3, 0x20));
+			simde_mm256_storeu_pd(output + 8, simde_mm256_permute2f128_pd(t0, t2, 0x31));
+			simde_mm256_storeu_pd(output + 12, simde_mm256_permute2f128_pd(t1, t3, 0x31));
+		}
+	#elif LANGULUS_SIMD(128BIT)
+		if constexpr (CT::RealSP<T>) {
+			// The _MM_TRANSPOSE4_PS pattern											
+			const auto r0 = simde_mm_loadu_ps(value);
+			const auto r1 = simde_mm_loadu_ps(value + 4);
+			const auto r2 = simde_mm_loadu_ps(value + 8);
+			const auto r3 = simde_mm_loadu_ps(value + 12);
+			const auto t0 = simde_mm_unpacklo_ps(r0, r1);
+			const auto t1 = simde_mm_unpacklo_ps(r2, r3);
+			const auto t2 = simde_mm_unpackhi_ps(r0, r1);
+			const auto t3 = simde_mm_unpackhi_ps(r2, r3);
+			simde_mm_storeu_ps(output, simde_mm_movelh_ps(t0, t1));
+			simde_mm_storeu_ps(output + 4, simde_mm_movehl_ps(t1, t0));
+			simde_mm_storeu_ps(output + 8, simde_mm_movelh_ps(t2, t3));
+			simde_mm_storeu_ps(output + 12, simde_mm_movehl_ps(t3, t2));
+		}
+		else {
+			// Transpose each of the four 2x2 blocks, and swap the			
+			// off-diagonal ones															
+			simde__m128d r[8];
+			for (Offset i = 0; i < 8; ++i)
+				r[i] = simde_mm_loadu_pd(value + i * 2);
+			for (Offset i = 0; i < 2; ++i) {
+				for (Offset j = 0; j < 2; ++j) {
+					const auto a = r[i * 4 + j];
+					const auto b = r[i * 4 + j + 2];
+					simde_mm_storeu_pd(output + j * 8 + i * 2, simde_mm_unpacklo_pd(a, b));
+					simde_mm_storeu_pd(output + j * 8 + i * 2 + 4, simde_mm_unpackhi_pd(a, b));
+				}
+			}
+		}
+	#else
+		T result[16];
+		for (Offset row = 0; row < 4; ++row)
+			for (Offset col = 0; col < 4; ++col)
+				result[col * 4 + row] = value[row * 4 + col];
+		::std::memcpy(output, result, sizeof(result));
+	#endif
+	}
+
+	/// Multiply two 4x4 matrices																
+	///	@param lhs - the left matrix														
+	///	@param rhs - the right matrix														
+	///	@param output - [out] the product lhs * rhs									
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void MatrixMultiply(const T(&lhs)[16], const T(&rhs)[16], T(&output)[16]) noexcept {
+		static_assert(CT::Real<T>, "SIMD::MatrixMultiply is implemented only for real numbers");
+
+		// Each output row is a linear combination of the rows of rhs,		
+		// weighted by the elements of the corresponding lhs row				
+	#if LANGULUS_SIMD(512BIT)
+		if constexpr (CT::RealSP<T>) {
+			const auto b0 = simde_mm512_broadcast_f32x4(simde_mm_loadu_ps(rhs));
+			const auto b1 = simde_mm512_broadcast_f32x4(simde_mm_loadu_ps(rhs + 4));
+			const auto b2 = simde_mm512_broadcast_f32x4(simde_mm_loadu_ps(rhs + 8));
+			const auto b3 = simde_mm512_broadcast_f32x4(simde_mm_loadu_ps(rhs + 12));
+			const auto a = simde_mm512_loadu_ps(lhs);
+			auto r = simde_mm512_mul_ps(simde_mm512_permute_ps(a, Shuffle(0, 0, 0, 0)), b0);
+			r = simde_mm512_add_ps(r, simde_mm512_mul_ps(simde_mm512_permute_ps(a, Shuffle(1, 1, 1, 1)), b1));
+			r = simde_mm512_add_ps(r, simde_mm512_mul_ps(simde_mm512_permute_ps(a, Shuffle(2, 2, 2, 2)), b2));
+			r = simde_mm512_add_ps(r, simde_mm512_mul_ps(simde_mm512_permute_ps(a, Shuffle(3, 3, 3, 3)), b3));
+			simde_mm512_storeu_ps(output, r);
+		}
+		else {
+			const auto b0 = simde_mm512_broadcast_f64x4(simde_mm256_loadu_pd(rhs));
+			const auto b1 = simde_mm512_broadcast_f64x4(simde_mm256_loadu_pd(rhs + 4));
+			const auto b2 = simde_mm512_broadcast_f64x4(simde_mm256_loadu_pd(rhs + 8));
+			const auto b3 = simde_mm512_broadcast_f64x4(simde_mm256_loadu_pd(rhs + 12));
+			for (Offset i = 0; i < 16; i += 8) {
+				const auto a = simde_mm512_loadu_pd(lhs + i);
+				auto r = simde_mm512_mul_pd(simde_mm512_permutex_pd(a, Shuffle(0, 0, 0, 0)), b0);
+				r = simde_mm512_add_pd(r, simde_mm512_mul_pd(simde_mm512_permutex_pd(a, Shuffle(1, 1, 1, 1)), b1));
+				r = simde_mm512_add_pd(r, simde_mm512_mul_pd(simde_mm512_permutex_pd(a, Shuffle(2, 2, 2, 2)), b2));
+				r = simde_mm512_add_pd(r, simde_mm512_mul_pd(simde_mm512_permutex_pd(a, Shuffle(3, 3, 3, 3)), b3));
+				simde_mm512_storeu_pd(output + i, r);
+			}
+		}
+	#elif LANGULUS_SIMD(256BIT)
+		if constexpr (CT::RealSP<T>) {
+			// Two rows per register, rhs rows duplicated in both lanes		
+			// Rows are loaded unaligned first, because broadcast_ps takes	
+			// a simde__m128 pointer, which must be aligned					
+			const auto duplicate = [](const float* row) noexcept {
+				const auto r = simde_mm_loadu_ps(row);
+				return simde_mm256_set_m128(r, r);
+			};
+			const auto b0 = duplicate(rhs);
+			const auto b1 = duplicate(rhs + 4);
+			const auto b2 = duplicate(rhs + 8);
+			const auto b3 = duplicate(rhs + 12);
+			for (Offset i = 0; i < 16; i += 8) {
+				const auto a = simde_mm256_loadu_ps(lhs + i);
+				auto r = simde_mm256_mul_ps(simde_mm256_permute_ps(a, Shuffle(0, 0, 0, 0)), b0);
+				r = simde_mm256_add_ps(r, simde_mm256_mul_ps(simde_mm256_permute_ps(a, Shuffle(1, 1, 1, 1)), b1));
+				r = simde_mm256_add_ps(r, simde_mm256_mul_ps(simde_mm256_permute_ps(a, Shuffle(2, 2, 2, 2)), b2));
+				r = simde_mm256_add_ps(r, simde_mm256_mul_ps(simde_mm256_permute_ps(a, Shuffle(3, 3, 3, 3)), b3));
+				simde_mm256_storeu_ps(output + i, r);
+			}
+		}
+		else {
+			const auto b0 = simde_mm256_loadu_pd(rhs);
+			const auto b1 = simde_mm256_loadu_pd(rhs + 4);
+			const auto b2 = simde_mm256_loadu_pd(rhs + 8);
+			const auto b3 = simde_mm256_loadu_pd(rhs + 12);
+			for (Offset i = 0; i < 16; i += 4) {
+				const auto a0 = simde_mm256_set1_pd(lhs[i]);
+				const auto a1 = simde_mm256_set1_pd(lhs[i + 1]);
+				const auto a2 = simde_mm256_set1_pd(lhs[i + 2]);
+				const auto a3 = simde_mm256_set1_pd(lhs[i + 3]);
+				auto r = simde_mm256_mul_pd(a0, b0);
+				r = simde_mm256_add_pd(r, simde_mm256_mul_pd(a1, b1));
+				r = simde_mm256_add_pd(r, simde_mm256_mul_pd(a2, b2));
+				r = simde_mm256_add_pd(r, simde_mm256_mul_pd(a3, b3));
+				simde_mm256_storeu_pd(output + i, r);
+			}
+		}
+	#elif LANGULUS_SIMD(128BIT)
+		if constexpr (CT::RealSP<T>) {
+			const auto b0 = simde_mm_loadu_ps(rhs);
+			const auto b1 = simde_mm_loadu_ps(rhs + 4);
+			const auto b2 = simde_mm_loadu_ps(rhs + 8);
+			const auto b3 = simde_mm_loadu_ps(rhs + 12);
+			for (Offset i = 0; i < 16; i += 4) {
+				const auto a = simde_mm_loadu_ps(lhs + i);
+				auto r = simde_mm_mul_ps(simde_mm_shuffle_ps(a, a, Shuffle(0, 0, 0, 0)), b0);
+				r = simde_mm_add_ps(r, simde_mm_mul_ps(simde_mm_shuffle_ps(a, a, Shuffle(1, 1, 1, 1)), b1));
+				r = simde_mm_add_ps(r, simde_mm_mul_ps(simde_mm_shuffle_ps(a, a, Shuffle(2, 2, 2, 2)), b2));
+				r = simde_mm_add_ps(r, simde_mm_mul_ps(simde_mm_shuffle_ps(a, a, Shuffle(3, 3, 3, 3)), b3));
+				simde_mm_storeu_ps(output + i, r);
+			}
+		}
+		else {
+			// Each row is split in two registers									
+			simde__m128d b[8];
+			for (Offset i = 0; i < 8; ++i)
+				b[i] = simde_mm_loadu_pd(rhs + i * 2);
+			for (Offset i = 0; i < 16; i += 4) {
+				auto lo = simde_mm_setzero_pd();
+				auto hi = simde_mm_setzero_pd();
+				for (Offset k = 0; k < 4; ++k) {
+					const auto a = simde_mm_set1_pd(lhs[i + k]);
+					lo = simde_mm_add_pd(lo, simde_mm_mul_pd(a, b[k * 2]));
+					hi = simde_mm_add_pd(hi, simde_mm_mul_pd(a, b[k * 2 + 1]));
+				}
+				simde_mm_storeu_pd(output + i, lo);
+				simde_mm_storeu_pd(output + i + 2, hi);
+			}
+		}
+	#else
+		T result[16];
+		for (Offset row = 0; row < 4; ++row) {
+			for (Offset col = 0; col < 4; ++col) {
+				result[row * 4 + col] = lhs[row * 4] * rhs[col];
+				for (Offset k = 1; k < 4; ++k)
+					result[row * 4 + col] += lhs[row * 4 + k] * rhs[k * 4 + col];
+			}
+		}
+		::std::memcpy(output, result, sizeof(result));
+	#endif
+	}
+
+	/// Transform a 4D vector by a 4x4 matrix												
+	///	@param matrix - the matrix															
+	///	@param vector - the vector															
+	///	@param output - [out] the product matrix * vector							
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void MatrixTransform(const T(&matrix)[16], const T(&vector)[4], T(&output)[4]) noexcept {
+		static_assert(CT::Real<T>, "SIMD::MatrixTransform is implemented only for real numbers");
+
+		// Multiply the rows by the vector, and sum them horizontally		
+	#if LANGULUS_SIMD(512BIT)
+		if constexpr (CT::RealSP<T>) {
+			const auto p = simde_mm512_mul_ps(
+				simde_mm512_loadu_ps(matrix),
+				simde_mm512_broadcast_f32x4(simde_mm_loadu_ps(vector))
+			);
+			auto s = simde_mm512_add_ps(p, simde_mm512_permute_ps(p, Shuffle(2, 3, 0, 1)));
+			s = simde_mm512_add_ps(s, simde_mm512_permute_ps(s, Shuffle(1, 0, 3, 2)));
+			const auto idx = simde_mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+			simde_mm_storeu_ps(output, simde_mm512_castps512_ps128(simde_mm512_permutexvar_ps(idx, s)));
+		}
+		else {
+			const auto v = simde_mm512_broadcast_f64x4(simde_mm256_loadu_pd(vector));
+			auto s01 = simde_mm512_mul_pd(simde_mm512_loadu_pd(matrix), v);
+			auto s23 = simde_mm512_mul_pd(simde_mm512_loadu_pd(matrix + 8), v);
+			s01 = simde_mm512_add_pd(s01, simde_mm512_permutex_pd(s01, Shuffle(2, 3, 0, 1)));
+			s23 = simde_mm512_add_pd(s23, simde_mm512_permutex_pd(s23, Shuffle(2, 3, 0, 1)));
+			s01 = simde_mm512_add_pd(s01, simde_mm512_permutex_pd(s01, Shuffle(1, 0, 3, 2)));
+			s23 = simde_mm512_add_pd(s23, simde_mm512_permutex_pd(s23, Shuffle(1, 0, 3, 2)));
+			const auto idx = simde_mm512_setr_epi64(0, 4, 8, 12, 0, 0, 0, 0);
+			simde_mm256_storeu_pd(output, simde_mm512_castpd512_pd256(simde_mm512_permutex2var_pd(s01, idx, s23)));
+		}
+	#elif LANGULUS_SIMD(256BIT)
+		if constexpr (CT::RealSP<T>) {
+			const auto v4 = simde_mm_loadu_ps(vector);
+			const auto v = simde_mm256_set_m128(v4, v4);
+			const auto p01 = simde_mm256_mul_ps(simde_mm256_loadu_ps(matrix), v);
+			const auto p23 = simde_mm256_mul_ps(simde_mm256_loadu_ps(matrix + 8), v);
+			auto h = simde_mm256_hadd_ps(p01, p23);
+			h = simde_mm256_hadd_ps(h, h);
+			simde_mm_storeu_ps(output, simde_mm_unpacklo_ps(
+				simde_mm256_castps256_ps128(h),
+				simde_mm256_extractf128_ps(h, 1)
+			));
+		}
+		else {
+			const auto v = simde_mm256_loadu_pd(vector);
+			const auto h01 = simde_mm256_hadd_pd(
+				simde_mm256_mul_pd(simde_mm256_loadu_pd(matrix), v),
+				simde_mm256_mul_pd(simde_mm256_loadu_pd(matrix + 4), v)
+			);
+			const auto h23 = simde_mm256_hadd_pd(
+				simde_mm256_mul_pd(simde_mm256_loadu_pd(matrix + 8), v),
+				simde_mm256_mul_pd(simde_mm256_loadu_pd(matrix + 12), v)
+			);
+			simde_mm256_storeu_pd(output, simde_mm256_add_pd(
+				simde_mm256_permute2f128_pd(h01, h23, 0x20),
+				simde_mm256_permute2f128_pd(h01, h23, 0x31)
+			));
+		}
+	#elif LANGULUS_SIMD(128BIT)
+		if constexpr (CT::RealSP<T>) {
+			const auto v = simde_mm_loadu_ps(vector);
+			const auto p0 = simde_mm_mul_ps(simde_mm_loadu_ps(matrix), v);
+			const auto p1 = simde_mm_mul_ps(simde_mm_loadu_ps(matrix + 4), v);
+			const auto p2 = simde_mm_mul_ps(simde_mm_loadu_ps(matrix + 8), v);
+			const auto p3 = simde_mm_mul_ps(simde_mm_loadu_ps(matrix + 12), v);
+			simde_mm_storeu_ps(output, simde_mm_hadd_ps(
+				simde_mm_hadd_ps(p0, p1),
+				simde_mm_hadd_ps(p2, p3)
+			));
+		}
+		else {
+			const auto vlo = simde_mm_loadu_pd(vector);
+			const auto vhi = simde_mm_loadu_pd(vector + 2);
+			simde__m128d q[4];
+			for (Offset i = 0; i < 4; ++i) {
+				q[i] = simde_mm_add_pd(
+					simde_mm_mul_pd(simde_mm_loadu_pd(matrix + i * 4), vlo),
+					simde_mm_mul_pd(simde_mm_loadu_pd(matrix + i * 4 + 2), vhi)
+				);
+			}
+			const auto r01 = simde_mm_hadd_pd(q[0], q[1]);
+			const auto r23 = simde_mm_hadd_pd(q[2], q[3]);
+			simde_mm_storeu_pd(output, r01);
+			simde_mm_storeu_pd(output + 2, r23);
+		}
+	#else
+		T result[4];
+		for (Offset row = 0; row < 4; ++row) {
+			result[row] = matrix[row * 4] * vector[0];
+			for (Offset k = 1; k < 4; ++k)
+				result[row] += matrix[row * 4 + k] * vector[k];
+		}
+		::std::memcpy(output, result, sizeof(result));
+	#endif
+	}
+
+	/// Transform a batch of points by a 4x4 matrix. Points are stored as		
+	/// structure of arrays - one span per component. Three components are		
+	/// treated as positions with an implicit w = 1, and only the first			
+	/// three rows of the matrix are used for them. Each register processes		
+	/// as many points as it has lanes, at any register width						
+	///	@tparam C - number of components, 3 or 4 (deducible)						
+	///	@param matrix - the matrix															
+	///	@param input - the point components												
+	///	@param output - [out] the transformed point components					
+	template<Count C, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void TransformSpan(const SpanType<IN>(&matrix)[16], const IN(&input)[C], OUT(&output)[C]) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Real<T>, "SIMD::TransformSpan is implemented only for real numbers");
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		static_assert(C == 3 || C == 4, "Points must have three or four components");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = OverlapCount(input[0], output[0]);
+		for (Count c = 1; c < C; ++c) {
+			count = OverlapCount(input[c], output[c]) < count
+				? OverlapCount(input[c], output[c]) : count;
+		}
+
+		const T* in[C];
+		T* out[C];
+		for (Count c = 0; c < C; ++c) {
+			in[c] = ::std::ranges::data(input[c]);
+			out[c] = ::std::ranges::data(output[c]);
+		}
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+
+			// Broadcast the matrix once												
+			REGISTER m[C][4];
+			for (Count row = 0; row < C; ++row)
+				for (Count col = 0; col < 4; ++col)
+					m[row][col] = Fill<REGISTER>(matrix[row * 4 + col]);
+
+			for (; i + L <= count; i += L) {
+				REGISTER v[C];
+				for (Count c = 0; c < C; ++c)
+					v[c] = Load<0>(reinterpret_cast<const CHUNK&>(in[c][i]));
+
+				for (Count row = 0; row < C; ++row) {
+					auto r = C == 3 ? m[row][3] : MultiplyInner<T, L>(m[row][3], v[C - 1]);
+					for (Count c = 0; c < 3; ++c)
+						r = AddInner<T, L>(r, MultiplyInner<T, L>(m[row][c], v[c]));
+					Store(r, reinterpret_cast<CHUNK&>(out[row][i]));
+				}
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			T v[4] {T {0}, T {0}, T {0}, T {1}};
+			for (Count c = 0; c < C; ++c)
+				v[c] = in[c][i];
+
+			for (Count row = 0; row < C; ++row) {
+				T r = matrix[row * 4 + 3] * v[3];
+				for (Count c = 0; c < 3; ++c)
+					r += matrix[row * 4 + c] * v[c];
+				out[row][i] = r;
+			}
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -151,7 +151,7 @@ namespace Langulus::SIMD
 		}
 		else {
 			// Extract from std::array													
-			std::memcpy(output, result.data(), sizeof(output));
+			StoreFallback(result, output);
 		}
 	}
 
@@ -0,0 +1,433 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Store.hpp"
+#include "Span.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto ModInner(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the remainders of dividing two registers of real numbers, one lane	
+	/// at a time with std::fmod - this is scalar code, for the lanes that		
+	/// ModInnerReal can't do exactly														
+	///	@tparam T - the type of the array element										
+	///	@param lhs - the dividends															
+	///	@param rhs - the divisors															
+	///	@return the remainders as a register											
+	template<class T, CT::TSIMD REGISTER>
+	NOD() LANGULUS(ALWAYSINLINE) REGISTER ModInnerRealScalar(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		constexpr Count L = sizeof(REGISTER) / sizeof(T);
+		T l[L], r[L];
+		::std::memcpy(l, &lhs, sizeof(REGISTER));
+		::std::memcpy(r, &rhs, sizeof(REGISTER));
+		for (Count i = 0; i < L; ++i)
+			l[i] = ::std::fmod(l[i], r[i]);
+
+		REGISTER result;
+		::std::memcpy(&result, l, sizeof(REGISTER));
+		return result;
+	}
+
+	/// Get the remainders of dividing two registers of real numbers exactly	
+	/// Works on magnitudes - q = trunc(|lhs|/|rhs|) can only be one too big,	
+	/// when the division rounds up to an integer, and |lhs| - q*|rhs| is		
+	/// exact either way, when done with a single FMA. A negative remainder	
+	/// then gets |rhs| added back, and the sign of lhs is put on the result	
+	/// Quotients that don't fit the mantissa (2^24 for floats, 2^53 for		
+	/// doubles) make q inexact, and infinite divisors make q*|rhs| NaN, so		
+	/// if any lane has them, the register goes through ModInnerRealScalar		
+	/// That is also the case for 128 and 256-bit registers without FMA		
+	///	@tparam T - the type of the array element										
+	///	@param lhs - the dividends															
+	///	@param rhs - the divisors															
+	///	@return the remainders as a register											
+	template<class T, CT::TSIMD REGISTER>
+	NOD() LANGULUS(ALWAYSINLINE) REGISTER ModInnerReal(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		#if LANGULUS_SIMD(FMA)
+			if constexpr (CT::Same<REGISTER, simde__m128>) {
+				const auto sign = simde_mm_set1_ps(-0.0f);
+				const auto a = simde_mm_andnot_ps(sign, lhs);
+				const auto b = simde_mm_andnot_ps(sign, rhs);
+				const auto quotient = simde_mm_div_ps(a, b);
+				if (simde_mm_movemask_ps(simde_mm_or_ps(
+					simde_mm_cmpge_ps(quotient, simde_mm_set1_ps(0x1p24f)),
+					simde_mm_cmpeq_ps(b, simde_mm_set1_ps(::std::numeric_limits<float>::infinity())))))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm_round_ps(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm_fnmadd_ps(q, b, a);
+				r = simde_mm_add_ps(r, simde_mm_and_ps(simde_mm_cmplt_ps(r, simde_mm_setzero_ps()), b));
+				r = simde_mm_sub_ps(r, simde_mm_and_ps(simde_mm_cmpge_ps(r, b), b));
+				return simde_mm_or_ps(r, simde_mm_and_ps(sign, lhs));
+			}
+			else if constexpr (CT::Same<REGISTER, simde__m128d>) {
+				const auto sign = simde_mm_set1_pd(-0.0);
+				const auto a = simde_mm_andnot_pd(sign, lhs);
+				const auto b = simde_mm_andnot_pd(sign, rhs);
+				const auto quotient = simde_mm_div_pd(a, b);
+				if (simde_mm_movemask_pd(simde_mm_or_pd(
+					simde_mm_cmpge_pd(quotient, simde_mm_set1_pd(0x1p53)),
+					simde_mm_cmpeq_pd(b, simde_mm_set1_pd(::std::numeric_limits<double>::infinity())))))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm_round_pd(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm_fnmadd_pd(q, b, a);
+				r = simde_mm_add_pd(r, simde_mm_and_pd(simde_mm_cmplt_pd(r, simde_mm_setzero_pd()), b));
+				r = simde_mm_sub_pd(r, simde_mm_and_pd(simde_mm_cmpge_pd(r, b), b));
+				return simde_mm_or_pd(r, simde_mm_and_pd(sign, lhs));
+			}
+			else if constexpr (CT::Same<REGISTER, simde__m256>) {
+				const auto sign = simde_mm256_set1_ps(-0.0f);
+				const auto a = simde_mm256_andnot_ps(sign, lhs);
+				const auto b = simde_mm256_andnot_ps(sign, rhs);
+				const auto quotient = simde_mm256_div_ps(a, b);
+				if (simde_mm256_movemask_ps(simde_mm256_or_ps(
+					simde_mm256_cmp_ps(quotient, simde_mm256_set1_ps(0x1p24f), _CMP_GE_OQ),
+					simde_mm256_cmp_ps(b, simde_mm256_set1_ps(::std::numeric_limits<float>::infinity()), _CMP_EQ_OQ))))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm256_round_ps(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm256_fnmadd_ps(q, b, a);
+				r = simde_mm256_add_ps(r, simde_mm256_and_ps(simde_mm256_cmp_ps(r, simde_mm256_setzero_ps(), _CMP_LT_OQ), b));
+				r = simde_mm256_sub_ps(r, simde_mm256_and_ps(simde_mm256_cmp_ps(r, b, _CMP_GE_OQ), b));
+				return simde_mm256_or_ps(r, simde_mm256_and_ps(sign, lhs));
+			}
+			else if constexpr (CT::Same<REGISTER, simde__m256d>) {
+				const auto sign = simde_mm256_set1_pd(-0.0);
+				const auto a = simde_mm256_andnot_pd(sign, lhs);
+				const auto b = simde_mm256_andnot_pd(sign, rhs);
+				const auto quotient = simde_mm256_div_pd(a, b);
+				if (simde_mm256_movemask_pd(simde_mm256_or_pd(
+					simde_mm256_cmp_pd(quotient, simde_mm256_set1_pd(0x1p53), _CMP_GE_OQ),
+					simde_mm256_cmp_pd(b, simde_mm256_set1_pd(::std::numeric_limits<double>::infinity()), _CMP_EQ_OQ))))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm256_round_pd(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm256_fnmadd_pd(q, b, a);
+				r = simde_mm256_add_pd(r, simde_mm256_and_pd(simde_mm256_cmp_pd(r, simde_mm256_setzero_pd(), _CMP_LT_OQ), b));
+				r = simde_mm256_sub_pd(r, simde_mm256_and_pd(simde_mm256_cmp_pd(r, b, _CMP_GE_OQ), b));
+				return simde_mm256_or_pd(r, simde_mm256_and_pd(sign, lhs));
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::Same<REGISTER, simde__m512>) {
+				const auto a = simde_mm512_abs_ps(lhs);
+				const auto b = simde_mm512_abs_ps(rhs);
+				const auto quotient = simde_mm512_div_ps(a, b);
+				if (simde_mm512_cmp_ps_mask(quotient, simde_mm512_set1_ps(0x1p24f), _CMP_GE_OQ)
+				  | simde_mm512_cmp_ps_mask(b, simde_mm512_set1_ps(::std::numeric_limits<float>::infinity()), _CMP_EQ_OQ))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm512_roundscale_ps(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm512_fnmadd_ps(q, b, a);
+				r = simde_mm512_mask_add_ps(r, simde_mm512_cmp_ps_mask(r, simde_mm512_setzero_ps(), _CMP_LT_OQ), r, b);
+				r = simde_mm512_mask_sub_ps(r, simde_mm512_cmp_ps_mask(r, b, _CMP_GE_OQ), r, b);
+				return simde_mm512_or_ps(r, simde_mm512_and_ps(simde_mm512_set1_ps(-0.0f), lhs));
+			}
+			else if constexpr (CT::Same<REGISTER, simde__m512d>) {
+				const auto a = simde_mm512_abs_pd(lhs);
+				const auto b = simde_mm512_abs_pd(rhs);
+				const auto quotient = simde_mm512_div_pd(a, b);
+				if (simde_mm512_cmp_pd_mask(quotient, simde_mm512_set1_pd(0x1p53), _CMP_GE_OQ)
+				  | simde_mm512_cmp_pd_mask(b, simde_mm512_set1_pd(::std::numeric_limits<double>::infinity()), _CMP_EQ_OQ))
+					return ModInnerRealScalar<T>(lhs, rhs);
+
+				const auto q = simde_mm512_roundscale_pd(quotient, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				auto r = simde_mm512_fnmadd_pd(q, b, a);
+				r = simde_mm512_mask_add_pd(r, simde_mm512_cmp_pd_mask(r, simde_mm512_setzero_pd(), _CMP_LT_OQ), r, b);
+				r = simde_mm512_mask_sub_pd(r, simde_mm512_cmp_pd_mask(r, b, _CMP_GE_OQ), r, b);
+				return simde_mm512_or_pd(r, simde_mm512_and_pd(simde_mm512_set1_pd(-0.0), lhs));
+			}
+			else
+		#endif
+
+		return ModInnerRealScalar<T>(lhs, rhs);
+	}
+
+	/// Get the remainders of dividing two arrays using SIMD							
+	/// Remainders of real numbers are exact, see ModInnerReal						
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - type of register we're operating with					
+	///	@param lhs - the dividends															
+	///	@param rhs - the divisors															
+	///	@return the remainders as a register											
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto ModInner(const REGISTER& lhs, const REGISTER& rhs) {
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::UnsignedInteger8<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi8(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epu8(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger8<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi8(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epi8(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger16<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi16(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epu16(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger16<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi16(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epi16(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger32<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi32(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epu32(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger32<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi32(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epi32(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger64<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi64(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epu64(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger64<T>) {
+					if (simde_mm_movemask_epi8(simde_mm_cmpeq_epi64(rhs, simde_mm_setzero_si128())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm_rem_epi64(lhs, rhs);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					if (simde_mm_movemask_ps(simde_mm_cmpeq_ps(rhs, simde_mm_setzero_ps())))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else if constexpr (CT::RealDP<T>) {
+					if (simde_mm_movemask_pd(simde_mm_cmpeq_pd(rhs, simde_mm_setzero_pd())))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::ModInner of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::UnsignedInteger8<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi8(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epu8(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger8<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi8(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epi8(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger16<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi16(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epu16(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger16<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi16(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epi16(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger32<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi32(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epu32(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger32<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi32(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epi32(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger64<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi64(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epu64(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger64<T>) {
+					if (simde_mm256_movemask_epi8(simde_mm256_cmpeq_epi64(rhs, simde_mm256_setzero_si256())))
+						Throw<Except::DivisionByZero>();
+					return simde_mm256_rem_epi64(lhs, rhs);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					if (simde_mm256_movemask_ps(simde_mm256_cmp_ps(rhs, simde_mm256_setzero_ps(), _CMP_EQ_OQ)))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else if constexpr (CT::RealDP<T>) {
+					if (simde_mm256_movemask_pd(simde_mm256_cmp_pd(rhs, simde_mm256_setzero_pd(), _CMP_EQ_OQ)))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::ModInner of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::UnsignedInteger8<T>) {
+					if (simde_mm512_cmpeq_epi8_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epu8(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger8<T>) {
+					if (simde_mm512_cmpeq_epi8_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epi8(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger16<T>) {
+					if (simde_mm512_cmpeq_epi16_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epu16(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger16<T>) {
+					if (simde_mm512_cmpeq_epi16_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epi16(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger32<T>) {
+					if (simde_mm512_cmpeq_epi32_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epu32(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger32<T>) {
+					if (simde_mm512_cmpeq_epi32_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epi32(lhs, rhs);
+				}
+				else if constexpr (CT::UnsignedInteger64<T>) {
+					if (simde_mm512_cmpeq_epi64_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epu64(lhs, rhs);
+				}
+				else if constexpr (CT::SignedInteger64<T>) {
+					if (simde_mm512_cmpeq_epi64_mask(rhs, simde_mm512_setzero_si512()))
+						Throw<Except::DivisionByZero>();
+					return simde_mm512_rem_epi64(lhs, rhs);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					if (simde_mm512_cmp_ps_mask(rhs, simde_mm512_setzero_ps(), _CMP_EQ_OQ))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else if constexpr (CT::RealDP<T>) {
+					if (simde_mm512_cmp_pd_mask(rhs, simde_mm512_setzero_pd(), _CMP_EQ_OQ))
+						Throw<Except::DivisionByZero>();
+					return ModInnerReal<T>(lhs, rhs);
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::ModInner of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::ModInner");
+	}
+
+	/// Get the remainder of a single division, the same way ModInner does		
+	///	@param lhs - the dividend															
+	///	@param rhs - the divisor															
+	///	@return the remainder																
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) T ModFallback(const T& lhs, const T& rhs) {
+		if (rhs == 0)
+			Throw<Except::DivisionByZero>();
+		if constexpr (CT::Real<T>)
+			return ::std::fmod(lhs, rhs);
+		else
+			return static_cast<T>(lhs % rhs);
+	}
+
+	///																								
+	template<class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) auto Mod(const LHS& lhsOrig, const RHS& rhsOrig) {
+		using REGISTER = CT::Register<LHS, RHS>;
+		using LOSSLESS = CT::Lossless<LHS, RHS>;
+		constexpr auto S = OverlapCount<LHS, RHS>();
+
+		return AttemptSIMD<1, REGISTER, LOSSLESS>(
+			lhsOrig, rhsOrig,
+			[](const REGISTER& lhs, const REGISTER& rhs) {
+				return ModInner<LOSSLESS, S>(lhs, rhs);
+			},
+			[](const LOSSLESS& lhs, const LOSSLESS& rhs) -> LOSSLESS {
+				return ModFallback(lhs, rhs);
+			}
+		);
+	}
+
+	///																								
+	template<class LHS, class RHS, class OUT>
+	LANGULUS(ALWAYSINLINE) void Mod(const LHS& lhs, const RHS& rhs, OUT& output) {
+		const auto result = Mod<LHS, RHS>(lhs, rhs);
+		if constexpr (CT::TSIMD<decltype(result)>) {
+			// Extract from register													
+			Store(result, output);
+		}
+		else if constexpr (!CT::Array<OUT>) {
+			// Extract from number														
+			output = result;
+		}
+		else {
+			// Extract from std::array													
+			StoreFallback(result, output);
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER ModWrap(const LHS& lhs, const RHS& rhs) {
+		WRAPPER result;
+		Mod<LHS, RHS>(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Get the remainders of dividing one span by another							
+	/// Tails are padded with ones, so they never trigger a false division by zero
+	///	@param lhs - the dividends															
+	///	@param rhs - the divisors															
+	///	@param output - [out] the remainders											
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void ModSpan(LHS&& lhs, RHS&& rhs, OUT&& output) {
+		using T = SpanType<LHS>;
+		static_assert(CT::Same<T, SpanType<RHS>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		const auto count = OverlapCount(lhs, rhs);
+		StreamBinary<1>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs), ::std::ranges::data(output),
+			count < ::std::ranges::size(output) ? count : ::std::ranges::size(output),
+			[](const REGISTER& l, const REGISTER& r) {
+				return ModInner<T, MaxLanes<T>>(l, r);
+			},
+			[](const T& l, const T& r) -> T {
+				return ModFallback(l, r);
+			}
+		);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -27,7 +27,12 @@ namespace Langulus::SIMD
 	///	@return the multiplied elements as a register								
 	template<class T, Count S, CT::TSIMD REGISTER>
 	LANGULUS(ALWAYSINLINE) auto MultiplyInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
-		if constexpr (CT::SIMD128<REGISTER>) {
+		if constexpr (CT::FixedPoint<T>) {
+			// Integer multiplication would overflow, so use the rounding	
+			// multiplication of fixed point numbers instead					
+			return InnerMultiplyFixed<T>(lhs, rhs);
+		}
+		else if constexpr (CT::SIMD128<REGISTER>) {
 			if constexpr (CT::Integer8<T>) {
 				auto loLHS = simde_mm_cvtepi8_epi16(lhs);
 				auto loRHS = simde_mm_cvtepi8_epi16(rhs);
@@ -157,7 +162,7 @@ namespace Langulus::SIMD
 		}
 		else {
 			// Extract from std::array													
-			std::memcpy(output, result.data(), sizeof(output));
+			StoreFallback(result, output);
 		}
 	}
 
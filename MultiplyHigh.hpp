@@ -0,0 +1,277 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Store.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Get the upper half of the full product of two integers, the old way		
+	/// 64-bit integers are multiplied in 32-bit halves, so that there's no		
+	/// need for a 128-bit type																
+	///	@param lhs - the left-hand-side integer										
+	///	@param rhs - the right-hand-side integer										
+	///	@return the upper half of the product											
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) constexpr T MultiplyHighFallback(const T& lhs, const T& rhs) noexcept {
+		static_assert(CT::Integer<T>, "SIMD::MultiplyHigh works only for integers");
+
+		if constexpr (sizeof(T) < 8) {
+			using WIDE = ::std::conditional_t<CT::Signed<T>, ::std::int64_t, ::std::uint64_t>;
+			return static_cast<T>((static_cast<WIDE>(lhs) * static_cast<WIDE>(rhs)) >> (sizeof(T) * 8));
+		}
+		else {
+			const auto a = static_cast<::std::uint64_t>(lhs);
+			const auto b = static_cast<::std::uint64_t>(rhs);
+			const ::std::uint64_t ll = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+			const ::std::uint64_t lh = (a & 0xFFFFFFFF) * (b >> 32);
+			const ::std::uint64_t hl = (a >> 32) * (b & 0xFFFFFFFF);
+			const ::std::uint64_t hh = (a >> 32) * (b >> 32);
+			const ::std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+			auto high = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+			// Negative numbers are 2^64 too big when seen as unsigned		
+			if constexpr (CT::Signed<T>) {
+				if (lhs < 0) high -= b;
+				if (rhs < 0) high -= a;
+			}
+			return static_cast<T>(high);
+		}
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto MultiplyHighInner(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the upper halves of the full products of two arrays using SIMD		
+	/// Words use mulhi_epi16/epu16. Bytes are multiplied as words, the even	
+	/// and the odd ones separately. 32-bit integers use mul_epi32/epu32 on		
+	/// the even and the odd lanes, and 64-bit ones are built from four			
+	/// 32-bit products, like in MultiplyHighFallback									
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left-hand-side array											
+	///	@param rhs - the right-hand-side array											
+	///	@return the upper halves of the products as a register					
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto MultiplyHighInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		static_assert(CT::Integer<T>, "SIMD::MultiplyHigh works only for integers");
+
+		if constexpr (CT::SIMD128<REGISTER>) {
+			if constexpr (CT::Integer8<T>) {
+				// Even bytes are extended in place, odd ones are shifted down
+				const auto even = CT::Signed<T>
+					? simde_mm_mullo_epi16(simde_mm_srai_epi16(simde_mm_slli_epi16(lhs, 8), 8), simde_mm_srai_epi16(simde_mm_slli_epi16(rhs, 8), 8))
+					: simde_mm_mullo_epi16(simde_mm_srli_epi16(simde_mm_slli_epi16(lhs, 8), 8), simde_mm_srli_epi16(simde_mm_slli_epi16(rhs, 8), 8));
+				const auto odd = CT::Signed<T>
+					? simde_mm_mullo_epi16(simde_mm_srai_epi16(lhs, 8), simde_mm_srai_epi16(rhs, 8))
+					: simde_mm_mullo_epi16(simde_mm_srli_epi16(lhs, 8), simde_mm_srli_epi16(rhs, 8));
+				return simde_mm_or_si128(simde_mm_srli_epi16(even, 8), simde_mm_and_si128(odd, simde_mm_set1_epi16(static_cast<short>(0xFF00))));
+			}
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm_mulhi_epi16(lhs, rhs);
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm_mulhi_epu16(lhs, rhs);
+			else if constexpr (CT::Integer32<T>) {
+				const auto even = CT::Signed<T>
+					? simde_mm_mul_epi32(lhs, rhs)
+					: simde_mm_mul_epu32(lhs, rhs);
+				const auto odd = CT::Signed<T>
+					? simde_mm_mul_epi32(simde_mm_srli_epi64(lhs, 32), simde_mm_srli_epi64(rhs, 32))
+					: simde_mm_mul_epu32(simde_mm_srli_epi64(lhs, 32), simde_mm_srli_epi64(rhs, 32));
+				return simde_mm_blend_epi16(simde_mm_srli_epi64(even, 32), odd, 0xCC);
+			}
+			else if constexpr (CT::Integer64<T>) {
+				const auto lo = simde_mm_set1_epi64x(0xFFFFFFFF);
+				const auto ah = simde_mm_srli_epi64(lhs, 32);
+				const auto bh = simde_mm_srli_epi64(rhs, 32);
+				const auto ll = simde_mm_mul_epu32(lhs, rhs);
+				const auto lh = simde_mm_mul_epu32(lhs, bh);
+				const auto hl = simde_mm_mul_epu32(ah, rhs);
+				const auto hh = simde_mm_mul_epu32(ah, bh);
+				const auto mid = simde_mm_add_epi64(simde_mm_srli_epi64(ll, 32),
+					simde_mm_add_epi64(simde_mm_and_si128(lh, lo), simde_mm_and_si128(hl, lo)));
+				auto high = simde_mm_add_epi64(simde_mm_add_epi64(hh, simde_mm_srli_epi64(mid, 32)),
+					simde_mm_add_epi64(simde_mm_srli_epi64(lh, 32), simde_mm_srli_epi64(hl, 32)));
+
+				if constexpr (CT::Signed<T>) {
+					const auto zero = simde_mm_setzero_si128();
+					high = simde_mm_sub_epi64(high, simde_mm_and_si128(simde_mm_cmpgt_epi64(zero, lhs), rhs));
+					high = simde_mm_sub_epi64(high, simde_mm_and_si128(simde_mm_cmpgt_epi64(zero, rhs), lhs));
+				}
+				return high;
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::MultiplyHighInner of 16-byte package");
+		}
+		else if constexpr (CT::SIMD256<REGISTER>) {
+			if constexpr (CT::Integer8<T>) {
+				const auto even = CT::Signed<T>
+					? simde_mm256_mullo_epi16(simde_mm256_srai_epi16(simde_mm256_slli_epi16(lhs, 8), 8), simde_mm256_srai_epi16(simde_mm256_slli_epi16(rhs, 8), 8))
+					: simde_mm256_mullo_epi16(simde_mm256_srli_epi16(simde_mm256_slli_epi16(lhs, 8), 8), simde_mm256_srli_epi16(simde_mm256_slli_epi16(rhs, 8), 8));
+				const auto odd = CT::Signed<T>
+					? simde_mm256_mullo_epi16(simde_mm256_srai_epi16(lhs, 8), simde_mm256_srai_epi16(rhs, 8))
+					: simde_mm256_mullo_epi16(simde_mm256_srli_epi16(lhs, 8), simde_mm256_srli_epi16(rhs, 8));
+				return simde_mm256_or_si256(simde_mm256_srli_epi16(even, 8), simde_mm256_and_si256(odd, simde_mm256_set1_epi16(static_cast<short>(0xFF00))));
+			}
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm256_mulhi_epi16(lhs, rhs);
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm256_mulhi_epu16(lhs, rhs);
+			else if constexpr (CT::Integer32<T>) {
+				const auto even = CT::Signed<T>
+					? simde_mm256_mul_epi32(lhs, rhs)
+					: simde_mm256_mul_epu32(lhs, rhs);
+				const auto odd = CT::Signed<T>
+					? simde_mm256_mul_epi32(simde_mm256_srli_epi64(lhs, 32), simde_mm256_srli_epi64(rhs, 32))
+					: simde_mm256_mul_epu32(simde_mm256_srli_epi64(lhs, 32), simde_mm256_srli_epi64(rhs, 32));
+				return simde_mm256_blend_epi16(simde_mm256_srli_epi64(even, 32), odd, 0xCC);
+			}
+			else if constexpr (CT::Integer64<T>) {
+				const auto lo = simde_mm256_set1_epi64x(0xFFFFFFFF);
+				const auto ah = simde_mm256_srli_epi64(lhs, 32);
+				const auto bh = simde_mm256_srli_epi64(rhs, 32);
+				const auto ll = simde_mm256_mul_epu32(lhs, rhs);
+				const auto lh = simde_mm256_mul_epu32(lhs, bh);
+				const auto hl = simde_mm256_mul_epu32(ah, rhs);
+				const auto hh = simde_mm256_mul_epu32(ah, bh);
+				const auto mid = simde_mm256_add_epi64(simde_mm256_srli_epi64(ll, 32),
+					simde_mm256_add_epi64(simde_mm256_and_si256(lh, lo), simde_mm256_and_si256(hl, lo)));
+				auto high = simde_mm256_add_epi64(simde_mm256_add_epi64(hh, simde_mm256_srli_epi64(mid, 32)),
+					simde_mm256_add_epi64(simde_mm256_srli_epi64(lh, 32), simde_mm256_srli_epi64(hl, 32)));
+
+				if constexpr (CT::Signed<T>) {
+					const auto zero = simde_mm256_setzero_si256();
+					high = simde_mm256_sub_epi64(high, simde_mm256_and_si256(simde_mm256_cmpgt_epi64(zero, lhs), rhs));
+					high = simde_mm256_sub_epi64(high, simde_mm256_and_si256(simde_mm256_cmpgt_epi64(zero, rhs), lhs));
+				}
+				return high;
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::MultiplyHighInner of 32-byte package");
+		}
+		else if constexpr (CT::SIMD512<REGISTER>) {
+			if constexpr (CT::Integer8<T>) {
+				const auto even = CT::Signed<T>
+					? simde_mm512_mullo_epi16(simde_mm512_srai_epi16(simde_mm512_slli_epi16(lhs, 8), 8), simde_mm512_srai_epi16(simde_mm512_slli_epi16(rhs, 8), 8))
+					: simde_mm512_mullo_epi16(simde_mm512_srli_epi16(simde_mm512_slli_epi16(lhs, 8), 8), simde_mm512_srli_epi16(simde_mm512_slli_epi16(rhs, 8), 8));
+				const auto odd = CT::Signed<T>
+					? simde_mm512_mullo_epi16(simde_mm512_srai_epi16(lhs, 8), simde_mm512_srai_epi16(rhs, 8))
+					: simde_mm512_mullo_epi16(simde_mm512_srli_epi16(lhs, 8), simde_mm512_srli_epi16(rhs, 8));
+				return simde_mm512_or_si512(simde_mm512_srli_epi16(even, 8), simde_mm512_and_si512(odd, simde_mm512_set1_epi16(static_cast<short>(0xFF00))));
+			}
+			else if constexpr (CT::SignedInteger16<T>)
+				return simde_mm512_mulhi_epi16(lhs, rhs);
+			else if constexpr (CT::UnsignedInteger16<T>)
+				return simde_mm512_mulhi_epu16(lhs, rhs);
+			else if constexpr (CT::Integer32<T>) {
+				const auto even = CT::Signed<T>
+					? simde_mm512_mul_epi32(lhs, rhs)
+					: simde_mm512_mul_epu32(lhs, rhs);
+				const auto odd = CT::Signed<T>
+					? simde_mm512_mul_epi32(simde_mm512_srli_epi64(lhs, 32), simde_mm512_srli_epi64(rhs, 32))
+					: simde_mm512_mul_epu32(simde_mm512_srli_epi64(lhs, 32), simde_mm512_srli_epi64(rhs, 32));
+				return simde_mm512_mask_blend_epi32(0xAAAA, simde_mm512_srli_epi64(even, 32), odd);
+			}
+			else if constexpr (CT::Integer64<T>) {
+				const auto lo = simde_mm512_set1_epi64(0xFFFFFFFF);
+				const auto ah = simde_mm512_srli_epi64(lhs, 32);
+				const auto bh = simde_mm512_srli_epi64(rhs, 32);
+				const auto ll = simde_mm512_mul_epu32(lhs, rhs);
+				const auto lh = simde_mm512_mul_epu32(lhs, bh);
+				const auto hl = simde_mm512_mul_epu32(ah, rhs);
+				const auto hh = simde_mm512_mul_epu32(ah, bh);
+				const auto mid = simde_mm512_add_epi64(simde_mm512_srli_epi64(ll, 32),
+					simde_mm512_add_epi64(simde_mm512_and_si512(lh, lo), simde_mm512_and_si512(hl, lo)));
+				auto high = simde_mm512_add_epi64(simde_mm512_add_epi64(hh, simde_mm512_srli_epi64(mid, 32)),
+					simde_mm512_add_epi64(simde_mm512_srli_epi64(lh, 32), simde_mm512_srli_epi64(hl, 32)));
+
+				if constexpr (CT::Signed<T>) {
+					high = simde_mm512_sub_epi64(high, simde_mm512_and_si512(simde_mm512_srai_epi64(lhs, 63), rhs));
+					high = simde_mm512_sub_epi64(high, simde_mm512_and_si512(simde_mm512_srai_epi64(rhs, 63), lhs));
+				}
+				return high;
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::MultiplyHighInner of 64-byte package");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::MultiplyHighInner");
+	}
+
+	///																								
+	template<class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) auto MultiplyHigh(const LHS& lhsOrig, const RHS& rhsOrig) noexcept {
+		using REGISTER = CT::Register<LHS, RHS>;
+		using LOSSLESS = CT::Lossless<LHS, RHS>;
+		constexpr auto S = OverlapCount<LHS, RHS>();
+		return AttemptSIMD<0, REGISTER, LOSSLESS>(
+			lhsOrig, rhsOrig,
+			[](const REGISTER& lhs, const REGISTER& rhs) noexcept {
+				return MultiplyHighInner<LOSSLESS, S>(lhs, rhs);
+			},
+			[](const LOSSLESS& lhs, const LOSSLESS& rhs) noexcept -> LOSSLESS {
+				return MultiplyHighFallback(lhs, rhs);
+			}
+		);
+	}
+
+	///																								
+	template<class LHS, class RHS, class OUT>
+	LANGULUS(ALWAYSINLINE) void MultiplyHigh(const LHS& lhs, const RHS& rhs, OUT& output) noexcept {
+		const auto result = MultiplyHigh<LHS, RHS>(lhs, rhs);
+		if constexpr (CT::TSIMD<decltype(result)>) {
+			// Extract from register													
+			Store(result, output);
+		}
+		else if constexpr (!CT::Array<OUT>) {
+			// Extract from number														
+			output = result;
+		}
+		else {
+			// Extract from std::array													
+			StoreFallback(result, output);
+		}
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class LHS, class RHS>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER MultiplyHighWrap(const LHS& lhs, const RHS& rhs) noexcept {
+		WRAPPER result;
+		MultiplyHigh<LHS, RHS>(lhs, rhs, result.mComponents);
+		return result;
+	}
+
+	/// Get the upper halves of the full products of two spans						
+	///	@param lhs - the left-hand-side integers										
+	///	@param rhs - the right-hand-side integers										
+	///	@param output - [out] the upper halves of the products					
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void MultiplyHighSpan(LHS&& lhs, RHS&& rhs, OUT&& output) noexcept {
+		using T = SpanType<LHS>;
+		static_assert(CT::Same<T, SpanType<RHS>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		const auto count = OverlapCount(lhs, rhs);
+		StreamBinary<0>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs), ::std::ranges::data(output),
+			count < ::std::ranges::size(output) ? count : ::std::ranges::size(output),
+			[](const REGISTER& l, const REGISTER& r) noexcept {
+				return MultiplyHighInner<T, MaxLanes<T>>(l, r);
+			},
+			[](const T& l, const T& r) noexcept -> T {
+				return MultiplyHighFallback(l, r);
+			}
+		);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,104 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Length.hpp"
+#include "Divide.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Normalize a vector																		
+	///	@param value - the vector to normalize											
+	///	@param output - [out] the normalized vector									
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Normalize(const T(&value)[S], T(&output)[S]) {
+		const T length = Length(value);
+		if (length == T {0})
+			Throw<Except::DivisionByZero>();
+
+		using REGISTER = decltype(Load<0>(value));
+		if constexpr (CT::NotSupported<REGISTER>) {
+			for (Count i = 0; i < S; ++i)
+				output[i] = value[i] / length;
+		}
+		else Store(DivideInner<T, S>(Load<0>(value), Fill<REGISTER>(length)), output);
+	}
+
+	///																								
+	template<CT::Vector WRAPPER, class T, Count S>
+	NOD() LANGULUS(ALWAYSINLINE) WRAPPER NormalizeWrap(const T(&value)[S]) {
+		WRAPPER result;
+		Normalize(value, result.mComponents);
+		return result;
+	}
+
+	/// Normalize a batch of vectors, stored as structure of arrays				
+	///	@tparam C - number of components (deducible)									
+	///	@param input - the components, one span per component						
+	///	@param output - [out] the normalized components (can be the input)	
+	template<Count C, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void NormalizeSpan(const IN(&input)[C], OUT(&output)[C]) {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = OverlapCount(input[0], output[0]);
+		for (Count c = 1; c < C; ++c) {
+			count = OverlapCount(input[c], output[c]) < count
+				? OverlapCount(input[c], output[c]) : count;
+		}
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			REGISTER components[C];
+			for (; i + L <= count; i += L) {
+				components[0] = Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(input[0])[i]));
+				auto accumulator = MultiplyInner<T, L>(components[0], components[0]);
+				for (Count c = 1; c < C; ++c) {
+					components[c] = Load<0>(reinterpret_cast<const CHUNK&>(::std::ranges::data(input[c])[i]));
+					accumulator = AddInner<T, L>(accumulator, MultiplyInner<T, L>(components[c], components[c]));
+				}
+
+				const auto length = InnerSqrt<T, L>(accumulator);
+				for (Count c = 0; c < C; ++c) {
+					Store(
+						DivideInner<T, L>(components[c], length),
+						reinterpret_cast<CHUNK&>(::std::ranges::data(output[c])[i])
+					);
+				}
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			T length {};
+			for (Count c = 0; c < C; ++c)
+				length += ::std::ranges::data(input[c])[i] * ::std::ranges::data(input[c])[i];
+			length = ::std::sqrt(length);
+			if (length == T {0})
+				Throw<Except::DivisionByZero>();
+
+			for (Count c = 0; c < C; ++c)
+				::std::ranges::data(output[c])[i] = ::std::ranges::data(input[c])[i] / length;
+		}
+	}
+
+	/// Normalize a batch of vectors in place												
+	///	@tparam C - number of components (deducible)									
+	///	@param data - [in/out] the components, one span per component			
+	template<Count C, CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void NormalizeSpan(DATA(&data)[C]) {
+		NormalizeSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,459 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "MoreSIMD.hpp"
+#include "Span.hpp"
+#include <cmath>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Pixels are 8-bit RGBA, packed in a 32-bit unsigned integer, with red	
+	/// in the first byte in memory, and alpha in the last one						
+	using Pixel = ::std::uint32_t;
+
+	/// Divide 16-bit unsigned integers by 255, rounding down						
+	/// Exact for anything up to 255 * 255, see _mm_div255_epu16					
+	///	@param x - the integers to divide												
+	///	@return the divided integers														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerDiv255(const R& x) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>)
+			return _mm_div255_epu16(x);
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			return simde_mm256_srli_epi16(simde_mm256_adds_epu16(
+				simde_mm256_adds_epu16(x, simde_mm256_set1_epi16(1)),
+				simde_mm256_srli_epi16(x, 8)
+			), 8);
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			return simde_mm512_srli_epi16(simde_mm512_adds_epu16(
+				simde_mm512_adds_epu16(x, simde_mm512_set1_epi16(1)),
+				simde_mm512_srli_epi16(x, 8)
+			), 8);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerDiv255");
+	}
+
+	/// Scale 8-bit unsigned integers by y / 255, see _mm_scale_epu8				
+	///	@param x - the integers to scale													
+	///	@param y - the scale, 255 keeps x as it is									
+	///	@return the scaled integers														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerScale8(const R& x, const R& y) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>)
+			return _mm_scale_epu8(x, y);
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			// Unpacking and packing are both per 128-bit lane, so the		
+			// bytes end up where they started										
+			const auto zero = simde_mm256_setzero_si256();
+			const auto lo = simde_mm256_mullo_epi16(simde_mm256_unpacklo_epi8(x, zero), simde_mm256_unpacklo_epi8(y, zero));
+			const auto hi = simde_mm256_mullo_epi16(simde_mm256_unpackhi_epi8(x, zero), simde_mm256_unpackhi_epi8(y, zero));
+			return simde_mm256_packus_epi16(InnerDiv255(lo), InnerDiv255(hi));
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			const auto zero = simde_mm512_setzero_si512();
+			const auto lo = simde_mm512_mullo_epi16(simde_mm512_unpacklo_epi8(x, zero), simde_mm512_unpacklo_epi8(y, zero));
+			const auto hi = simde_mm512_mullo_epi16(simde_mm512_unpackhi_epi8(x, zero), simde_mm512_unpackhi_epi8(y, zero));
+			return simde_mm512_packus_epi16(InnerDiv255(lo), InnerDiv255(hi));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerScale8");
+	}
+
+	/// Copy the alpha of each pixel to all of its channels							
+	///	@param px - the pixels																
+	///	@return the alpha of each pixel, four times									
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerSplatAlpha(const R& px) noexcept {
+		const auto mask = simde_mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+		if constexpr (CT::Same<R, simde__m128i>)
+			return simde_mm_shuffle_epi8(px, mask);
+		else if constexpr (CT::Same<R, simde__m256i>)
+			return simde_mm256_shuffle_epi8(px, simde_mm256_broadcastsi128_si256(mask));
+		else if constexpr (CT::Same<R, simde__m512i>)
+			return simde_mm512_shuffle_epi8(px, simde_mm512_broadcast_i32x4(mask));
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerSplatAlpha");
+	}
+
+	/// Take the color from one set of pixels, and the alpha from another		
+	///	@param color - the pixels to take red, green and blue from				
+	///	@param alpha - the pixels to take alpha from									
+	///	@return the combined pixels														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerKeepAlpha(const R& color, const R& alpha) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>)
+			return _mm_blendv_si128(color, alpha, simde_mm_set1_epi32(static_cast<int>(0xFF000000u)));
+		else if constexpr (CT::Same<R, simde__m256i>)
+			return simde_mm256_blendv_epi8(color, alpha, simde_mm256_set1_epi32(static_cast<int>(0xFF000000u)));
+		else if constexpr (CT::Same<R, simde__m512i>)
+			return simde_mm512_mask_mov_epi8(color, 0x8888888888888888ull, alpha);
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerKeepAlpha");
+	}
+
+	/// Interpolate 8-bit unsigned integers, rounding down							
+	/// x := (a * (255 - t) + b * t) / 255, so both ends are exact					
+	///	@param a - the integers at t = 0													
+	///	@param b - the integers at t = 255												
+	///	@param t - the interpolation factor												
+	///	@return the interpolated integers												
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerLerp8(const R& a, const R& b, ::std::uint8_t t) noexcept {
+		const auto wa = static_cast<short>(255 - t);
+		const auto wb = static_cast<short>(t);
+
+		if constexpr (CT::Same<R, simde__m128i>) {
+			const auto zero = simde_mm_setzero_si128();
+			const auto lo = simde_mm_add_epi16(
+				simde_mm_mullo_epi16(simde_mm_unpacklo_epi8(a, zero), simde_mm_set1_epi16(wa)),
+				simde_mm_mullo_epi16(simde_mm_unpacklo_epi8(b, zero), simde_mm_set1_epi16(wb)));
+			const auto hi = simde_mm_add_epi16(
+				simde_mm_mullo_epi16(simde_mm_unpackhi_epi8(a, zero), simde_mm_set1_epi16(wa)),
+				simde_mm_mullo_epi16(simde_mm_unpackhi_epi8(b, zero), simde_mm_set1_epi16(wb)));
+			return simde_mm_packus_epi16(InnerDiv255(lo), InnerDiv255(hi));
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			const auto zero = simde_mm256_setzero_si256();
+			const auto lo = simde_mm256_add_epi16(
+				simde_mm256_mullo_epi16(simde_mm256_unpacklo_epi8(a, zero), simde_mm256_set1_epi16(wa)),
+				simde_mm256_mullo_epi16(simde_mm256_unpacklo_epi8(b, zero), simde_mm256_set1_epi16(wb)));
+			const auto hi = simde_mm256_add_epi16(
+				simde_mm256_mullo_epi16(simde_mm256_unpackhi_epi8(a, zero), simde_mm256_set1_epi16(wa)),
+				simde_mm256_mullo_epi16(simde_mm256_unpackhi_epi8(b, zero), simde_mm256_set1_epi16(wb)));
+			return simde_mm256_packus_epi16(InnerDiv255(lo), InnerDiv255(hi));
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			const auto zero = simde_mm512_setzero_si512();
+			const auto lo = simde_mm512_add_epi16(
+				simde_mm512_mullo_epi16(simde_mm512_unpacklo_epi8(a, zero), simde_mm512_set1_epi16(wa)),
+				simde_mm512_mullo_epi16(simde_mm512_unpacklo_epi8(b, zero), simde_mm512_set1_epi16(wb)));
+			const auto hi = simde_mm512_add_epi16(
+				simde_mm512_mullo_epi16(simde_mm512_unpackhi_epi8(a, zero), simde_mm512_set1_epi16(wa)),
+				simde_mm512_mullo_epi16(simde_mm512_unpackhi_epi8(b, zero), simde_mm512_set1_epi16(wb)));
+			return simde_mm512_packus_epi16(InnerDiv255(lo), InnerDiv255(hi));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerLerp8");
+	}
+
+	/// Multiply the color of each pixel by its alpha									
+	///	@param px - the straight alpha pixels											
+	///	@return the premultiplied pixels													
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerPremultiply(const R& px) noexcept {
+		return InnerKeepAlpha(InnerScale8(px, InnerSplatAlpha(px)), px);
+	}
+
+	/// Place the premultiplied source pixels over the destination ones			
+	/// This is the Porter-Duff 'over' operator: src + dst * (1 - src.alpha)	
+	///	@param src - the premultiplied pixels on top									
+	///	@param dst - the premultiplied pixels below									
+	///	@return the composited pixels														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerOver(const R& src, const R& dst) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>)
+			return simde_mm_adds_epu8(src, InnerScale8(dst, _mm_not_si128(InnerSplatAlpha(src))));
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			const auto inv = simde_mm256_xor_si256(InnerSplatAlpha(src), simde_mm256_set1_epi8(-1));
+			return simde_mm256_adds_epu8(src, InnerScale8(dst, inv));
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			const auto inv = simde_mm512_xor_si512(InnerSplatAlpha(src), simde_mm512_set1_epi8(-1));
+			return simde_mm512_adds_epu8(src, InnerScale8(dst, inv));
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerOver");
+	}
+
+	/// Swap the red and blue channels, turning RGBA into BGRA and vice versa	
+	///	@param px - the pixels																
+	///	@return the swizzled pixels														
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerSwapRedBlue(const R& px) noexcept {
+		const auto mask = simde_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+		if constexpr (CT::Same<R, simde__m128i>)
+			return simde_mm_shuffle_epi8(px, mask);
+		else if constexpr (CT::Same<R, simde__m256i>)
+			return simde_mm256_shuffle_epi8(px, simde_mm256_broadcastsi128_si256(mask));
+		else if constexpr (CT::Same<R, simde__m512i>)
+			return simde_mm512_shuffle_epi8(px, simde_mm512_broadcast_i32x4(mask));
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerSwapRedBlue");
+	}
+
+	/// Divide the color of pixels, widened to one float per channel, by their	
+	/// alpha. Pixels with zero alpha become transparent black						
+	///	@param v - the channels of the premultiplied pixels						
+	///	@return the channels of the straight alpha pixels							
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerUnpremultiplyChannels(const R& v) noexcept {
+		if constexpr (CT::Same<R, simde__m128>) {
+			const auto alpha = simde_mm_shuffle_ps(v, v, 0xFF);
+			const auto factor = simde_mm_and_ps(
+				simde_mm_div_ps(simde_mm_set1_ps(255.0f), alpha),
+				simde_mm_cmpneq_ps(alpha, simde_mm_setzero_ps()));
+			const auto color = simde_mm_min_ps(simde_mm_mul_ps(v, factor), simde_mm_set1_ps(255.0f));
+			return simde_mm_blend_ps(color, v, 0x8);
+		}
+		else if constexpr (CT::Same<R, simde__m256>) {
+			const auto alpha = simde_mm256_permute_ps(v, 0xFF);
+			const auto factor = simde_mm256_and_ps(
+				simde_mm256_div_ps(simde_mm256_set1_ps(255.0f), alpha),
+				simde_mm256_cmp_ps(alpha, simde_mm256_setzero_ps(), _CMP_NEQ_UQ));
+			const auto color = simde_mm256_min_ps(simde_mm256_mul_ps(v, factor), simde_mm256_set1_ps(255.0f));
+			return simde_mm256_blend_ps(color, v, 0x88);
+		}
+		else if constexpr (CT::Same<R, simde__m512>) {
+			const auto alpha = simde_mm512_permute_ps(v, 0xFF);
+			const auto factor = simde_mm512_maskz_div_ps(
+				simde_mm512_cmp_ps_mask(alpha, simde_mm512_setzero_ps(), _CMP_NEQ_UQ),
+				simde_mm512_set1_ps(255.0f), alpha);
+			const auto color = simde_mm512_min_ps(simde_mm512_mul_ps(v, factor), simde_mm512_set1_ps(255.0f));
+			return simde_mm512_mask_blend_ps(0x8888, color, v);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerUnpremultiplyChannels");
+	}
+
+	/// Divide the color of each pixel by its alpha, rounding to nearest			
+	/// Division is done in single precision, one float per channel				
+	///	@param px - the premultiplied pixels											
+	///	@return the straight alpha pixels												
+	template<CT::TSIMD R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerUnpremultiply(const R& px) noexcept {
+		if constexpr (CT::Same<R, simde__m128i>) {
+			// One pixel per float register											
+			const auto p0 = simde_mm_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm_cvtepi32_ps(simde_mm_cvtepu8_epi32(px))));
+			const auto p1 = simde_mm_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm_cvtepi32_ps(simde_mm_cvtepu8_epi32(simde_mm_srli_si128(px, 4)))));
+			const auto p2 = simde_mm_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm_cvtepi32_ps(simde_mm_cvtepu8_epi32(simde_mm_srli_si128(px, 8)))));
+			const auto p3 = simde_mm_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm_cvtepi32_ps(simde_mm_cvtepu8_epi32(simde_mm_srli_si128(px, 12)))));
+			return simde_mm_packus_epi16(simde_mm_packus_epi32(p0, p1), simde_mm_packus_epi32(p2, p3));
+		}
+		else if constexpr (CT::Same<R, simde__m256i>) {
+			// Two pixels per float register, one in each 128-bit lane		
+			const auto lo = simde_mm256_castsi256_si128(px);
+			const auto hi = simde_mm256_extracti128_si256(px, 1);
+			const auto p01 = simde_mm256_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm256_cvtepi32_ps(simde_mm256_cvtepu8_epi32(lo))));
+			const auto p23 = simde_mm256_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm256_cvtepi32_ps(simde_mm256_cvtepu8_epi32(simde_mm_srli_si128(lo, 8)))));
+			const auto p45 = simde_mm256_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm256_cvtepi32_ps(simde_mm256_cvtepu8_epi32(hi))));
+			const auto p67 = simde_mm256_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm256_cvtepi32_ps(simde_mm256_cvtepu8_epi32(simde_mm_srli_si128(hi, 8)))));
+
+			// Packing is per lane, so pixels end up as 0 2 4 6 1 3 5 7		
+			const auto packed = simde_mm256_packus_epi16(
+				simde_mm256_packus_epi32(p01, p23), simde_mm256_packus_epi32(p45, p67));
+			return simde_mm256_permutevar8x32_epi32(packed, simde_mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+		}
+		else if constexpr (CT::Same<R, simde__m512i>) {
+			// Four pixels per float register, one in each 128-bit lane		
+			const auto p0 = simde_mm512_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm512_cvtepi32_ps(simde_mm512_cvtepu8_epi32(simde_mm512_extracti32x4_epi32(px, 0)))));
+			const auto p1 = simde_mm512_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm512_cvtepi32_ps(simde_mm512_cvtepu8_epi32(simde_mm512_extracti32x4_epi32(px, 1)))));
+			const auto p2 = simde_mm512_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm512_cvtepi32_ps(simde_mm512_cvtepu8_epi32(simde_mm512_extracti32x4_epi32(px, 2)))));
+			const auto p3 = simde_mm512_cvtps_epi32(InnerUnpremultiplyChannels(
+				simde_mm512_cvtepi32_ps(simde_mm512_cvtepu8_epi32(simde_mm512_extracti32x4_epi32(px, 3)))));
+
+			// Packing is per lane, so lane k ends up with k, 4+k, 8+k, 12+k
+			const auto packed = simde_mm512_packus_epi16(
+				simde_mm512_packus_epi32(p0, p1), simde_mm512_packus_epi32(p2, p3));
+			return simde_mm512_permutexvar_epi32(
+				simde_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15), packed);
+		}
+		else LANGULUS_ASSERT("Unsupported register for SIMD::InnerUnpremultiply");
+	}
+
+	/// Get a channel of a pixel																
+	///	@param px - the pixel																
+	///	@param c - the channel index, 0 for red, 3 for alpha						
+	///	@return the channel																	
+	NOD() LANGULUS(ALWAYSINLINE) constexpr ::std::uint32_t PixelChannel(Pixel px, int c) noexcept {
+		return (px >> (c * 8)) & 0xFF;
+	}
+
+	/// Divide by 255, rounding down, the old way										
+	NOD() LANGULUS(ALWAYSINLINE) constexpr ::std::uint32_t Div255Fallback(::std::uint32_t x) noexcept {
+		return ((x + 1) + (x >> 8)) >> 8;
+	}
+
+	/// Multiply the color of a pixel by its alpha, the old way						
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel PremultiplyFallback(Pixel px) noexcept {
+		const auto a = PixelChannel(px, 3);
+		Pixel result = a << 24;
+		for (int c = 0; c < 3; ++c)
+			result |= Div255Fallback(PixelChannel(px, c) * a) << (c * 8);
+		return result;
+	}
+
+	/// Divide the color of a pixel by its alpha, the old way						
+	NOD() LANGULUS(ALWAYSINLINE) Pixel UnpremultiplyFallback(Pixel px) noexcept {
+		const auto a = PixelChannel(px, 3);
+		const float factor = a ? 255.0f / static_cast<float>(a) : 0.0f;
+		Pixel result = a << 24;
+		for (int c = 0; c < 3; ++c) {
+			const float color = ::std::fmin(static_cast<float>(PixelChannel(px, c)) * factor, 255.0f);
+			result |= static_cast<Pixel>(::std::nearbyint(color)) << (c * 8);
+		}
+		return result;
+	}
+
+	/// Place a premultiplied pixel over another, the old way						
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel OverFallback(Pixel src, Pixel dst) noexcept {
+		const auto inv = 255 - PixelChannel(src, 3);
+		Pixel result = 0;
+		for (int c = 0; c < 4; ++c) {
+			const auto sum = PixelChannel(src, c) + Div255Fallback(PixelChannel(dst, c) * inv);
+			result |= (sum > 255 ? 255 : sum) << (c * 8);
+		}
+		return result;
+	}
+
+	/// Interpolate between two pixels, the old way										
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel LerpFallback(Pixel a, Pixel b, ::std::uint8_t t) noexcept {
+		Pixel result = 0;
+		for (int c = 0; c < 4; ++c)
+			result |= Div255Fallback(PixelChannel(a, c) * (255u - t) + PixelChannel(b, c) * t) << (c * 8);
+		return result;
+	}
+
+	/// Swap the red and blue channels of a pixel, the old way						
+	NOD() LANGULUS(ALWAYSINLINE) constexpr Pixel SwapRedBlueFallback(Pixel px) noexcept {
+		return (px & 0xFF00FF00u) | ((px >> 16) & 0xFF) | ((px & 0xFF) << 16);
+	}
+
+	/// Check that a span holds pixels														
+	template<class IN, class OUT>
+	constexpr bool IsPixelSpan = CT::Same<SpanType<IN>, Pixel> && CT::Same<SpanType<OUT>, Pixel>;
+
+	/// Multiply the color of each pixel by its alpha, turning straight alpha	
+	/// into premultiplied alpha. Alpha itself is kept as it is						
+	///	@param input - the straight alpha pixels										
+	///	@param output - [out] the premultiplied pixels								
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void PremultiplySpan(IN&& input, OUT&& output) noexcept {
+		static_assert(IsPixelSpan<IN, OUT>, "Pixels must be RGBA8, packed in std::uint32_t");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<Pixel>& v) noexcept {
+				return InnerPremultiply(v);
+			},
+			[](const Pixel& v) noexcept -> Pixel {
+				return PremultiplyFallback(v);
+			}
+		);
+	}
+
+	/// Premultiply a span of pixels in place												
+	///	@param data - [in/out] the pixels												
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void PremultiplySpan(DATA&& data) noexcept {
+		PremultiplySpan(data, data);
+	}
+
+	/// Divide the color of each pixel by its alpha, turning premultiplied		
+	/// alpha into straight alpha. Pixels with zero alpha become zero				
+	///	@param input - the premultiplied pixels										
+	///	@param output - [out] the straight alpha pixels								
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void UnpremultiplySpan(IN&& input, OUT&& output) noexcept {
+		static_assert(IsPixelSpan<IN, OUT>, "Pixels must be RGBA8, packed in std::uint32_t");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<Pixel>& v) noexcept {
+				return InnerUnpremultiply(v);
+			},
+			[](const Pixel& v) noexcept -> Pixel {
+				return UnpremultiplyFallback(v);
+			}
+		);
+	}
+
+	/// Unpremultiply a span of pixels in place											
+	///	@param data - [in/out] the pixels												
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void UnpremultiplySpan(DATA&& data) noexcept {
+		UnpremultiplySpan(data, data);
+	}
+
+	/// Composite premultiplied pixels with the Porter-Duff 'over' operator		
+	///	@param source - the pixels on top												
+	///	@param destination - the pixels below											
+	///	@param output - [out] the composited pixels (can be destination)		
+	template<CT::Span SRC, CT::Span DST, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void OverSpan(SRC&& source, DST&& destination, OUT&& output) noexcept {
+		static_assert(IsPixelSpan<SRC, DST> && IsPixelSpan<DST, OUT>,
+			"Pixels must be RGBA8, packed in std::uint32_t");
+		const Count count = OverlapCount(source, destination);
+		StreamBinary<0>(
+			::std::ranges::data(source), ::std::ranges::data(destination),
+			::std::ranges::data(output), ::std::ranges::size(output) < count ? ::std::ranges::size(output) : count,
+			[](const MaxRegister<Pixel>& src, const MaxRegister<Pixel>& dst) noexcept {
+				return InnerOver(src, dst);
+			},
+			[](const Pixel& src, const Pixel& dst) noexcept -> Pixel {
+				return OverFallback(src, dst);
+			}
+		);
+	}
+
+	/// Interpolate between two spans of pixels, channel by channel				
+	///	@param lhs - the pixels at t = 0													
+	///	@param rhs - the pixels at t = 255												
+	///	@param t - the interpolation factor												
+	///	@param output - [out] the interpolated pixels (can be lhs or rhs)		
+	template<CT::Span LHS, CT::Span RHS, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void LerpSpan(LHS&& lhs, RHS&& rhs, ::std::uint8_t t, OUT&& output) noexcept {
+		static_assert(IsPixelSpan<LHS, RHS> && IsPixelSpan<RHS, OUT>,
+			"Pixels must be RGBA8, packed in std::uint32_t");
+		const Count count = OverlapCount(lhs, rhs);
+		StreamBinary<0>(
+			::std::ranges::data(lhs), ::std::ranges::data(rhs),
+			::std::ranges::data(output), ::std::ranges::size(output) < count ? ::std::ranges::size(output) : count,
+			[t](const MaxRegister<Pixel>& a, const MaxRegister<Pixel>& b) noexcept {
+				return InnerLerp8(a, b, t);
+			},
+			[t](const Pixel& a, const Pixel& b) noexcept -> Pixel {
+				return LerpFallback(a, b, t);
+			}
+		);
+	}
+
+	/// Swap the red and blue channels, turning RGBA into BGRA and vice versa	
+	///	@param input - the pixels															
+	///	@param output - [out] the swizzled pixels										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void SwapRedBlueSpan(IN&& input, OUT&& output) noexcept {
+		static_assert(IsPixelSpan<IN, OUT>, "Pixels must be RGBA8, packed in std::uint32_t");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<Pixel>& v) noexcept {
+				return InnerSwapRedBlue(v);
+			},
+			[](const Pixel& v) noexcept -> Pixel {
+				return SwapRedBlueFallback(v);
+			}
+		);
+	}
+
+	/// Swap the red and blue channels of a span of pixels in place				
+	///	@param data - [in/out] the pixels												
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void SwapRedBlueSpan(DATA&& data) noexcept {
+		SwapRedBlueSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
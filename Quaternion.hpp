@@ -0,0 +1,388 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Abs.hpp"
+#include "Cross.hpp"
+#include "CopySign.hpp"
+#include "Divide.hpp"
+#include "Dot.hpp"
+#include "Max.hpp"
+#include "Min.hpp"
+#include "Subtract.hpp"
+#include "Trigonometry.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerQuaternionMultiply(const CT::Inner::NotSupported&, const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the Hamilton product of two quaternions via SIMD							
+	/// Quaternions are always in [x, y, z, w] order, w being the scalar part	
+	/// The product is a sum of four broadcast lhs components, each multiplied	
+	/// by a shuffled and partially negated rhs											
+	///	@tparam T - the type of the quaternion components							
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param lhs - the left quaternion													
+	///	@param rhs - the right quaternion												
+	///	@return the product lhs * rhs														
+	template<class T, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerQuaternionMultiply(const REGISTER& lhs, const REGISTER& rhs) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerQuaternionMultiply is implemented only for real numbers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>) {
+					auto r = simde_mm_mul_ps(simde_mm_shuffle_ps(lhs, lhs, Shuffle(3, 3, 3, 3)), rhs);
+					r = simde_mm_add_ps(r, simde_mm_xor_ps(
+						simde_mm_mul_ps(simde_mm_shuffle_ps(lhs, lhs, Shuffle(0, 0, 0, 0)), simde_mm_shuffle_ps(rhs, rhs, Shuffle(0, 1, 2, 3))),
+						simde_mm_setr_ps(0.0F, -0.0F, 0.0F, -0.0F)
+					));
+					r = simde_mm_add_ps(r, simde_mm_xor_ps(
+						simde_mm_mul_ps(simde_mm_shuffle_ps(lhs, lhs, Shuffle(1, 1, 1, 1)), simde_mm_shuffle_ps(rhs, rhs, Shuffle(1, 0, 3, 2))),
+						simde_mm_setr_ps(0.0F, 0.0F, -0.0F, -0.0F)
+					));
+					return simde_mm_add_ps(r, simde_mm_xor_ps(
+						simde_mm_mul_ps(simde_mm_shuffle_ps(lhs, lhs, Shuffle(2, 2, 2, 2)), simde_mm_shuffle_ps(rhs, rhs, Shuffle(2, 3, 0, 1))),
+						simde_mm_setr_ps(-0.0F, 0.0F, 0.0F, -0.0F)
+					));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerQuaternionMultiply of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealDP<T>) {
+					auto r = simde_mm256_mul_pd(simde_mm256_permute4x64_pd(lhs, Shuffle(3, 3, 3, 3)), rhs);
+					r = simde_mm256_add_pd(r, simde_mm256_xor_pd(
+						simde_mm256_mul_pd(simde_mm256_permute4x64_pd(lhs, Shuffle(0, 0, 0, 0)), simde_mm256_permute4x64_pd(rhs, Shuffle(0, 1, 2, 3))),
+						simde_mm256_setr_pd(0.0, -0.0, 0.0, -0.0)
+					));
+					r = simde_mm256_add_pd(r, simde_mm256_xor_pd(
+						simde_mm256_mul_pd(simde_mm256_permute4x64_pd(lhs, Shuffle(1, 1, 1, 1)), simde_mm256_permute4x64_pd(rhs, Shuffle(1, 0, 3, 2))),
+						simde_mm256_setr_pd(0.0, 0.0, -0.0, -0.0)
+					));
+					return simde_mm256_add_pd(r, simde_mm256_xor_pd(
+						simde_mm256_mul_pd(simde_mm256_permute4x64_pd(lhs, Shuffle(2, 2, 2, 2)), simde_mm256_permute4x64_pd(rhs, Shuffle(2, 3, 0, 1))),
+						simde_mm256_setr_pd(-0.0, 0.0, 0.0, -0.0)
+					));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerQuaternionMultiply of 32-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerQuaternionMultiply");
+	}
+
+	/// Get the Hamilton product of two quaternions										
+	///	@param lhs - the left quaternion													
+	///	@param rhs - the right quaternion												
+	///	@param output - [out] the product lhs * rhs									
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void QuaternionMultiply(const T(&lhs)[4], const T(&rhs)[4], T(&output)[4]) noexcept {
+		using REGISTER = decltype(Load<0>(lhs));
+		if constexpr (CT::Real<T> && !CT::NotSupported<REGISTER>)
+			Store(InnerQuaternionMultiply<T>(Load<0>(lhs), Load<0>(rhs)), output);
+		else {
+			const T x = lhs[3] * rhs[0] + lhs[0] * rhs[3] + lhs[1] * rhs[2] - lhs[2] * rhs[1];
+			const T y = lhs[3] * rhs[1] - lhs[0] * rhs[2] + lhs[1] * rhs[3] + lhs[2] * rhs[0];
+			const T z = lhs[3] * rhs[2] + lhs[0] * rhs[1] - lhs[1] * rhs[0] + lhs[2] * rhs[3];
+			const T w = lhs[3] * rhs[3] - lhs[0] * rhs[0] - lhs[1] * rhs[1] - lhs[2] * rhs[2];
+			output[0] = x;
+			output[1] = y;
+			output[2] = z;
+			output[3] = w;
+		}
+	}
+
+	/// Rotate a 3D vector by a unit quaternion, using the							
+	/// v + w * t + cross(q, t), where t = 2 * cross(q, v) identity				
+	///	@param quaternion - the rotation													
+	///	@param vector - the vector to rotate											
+	///	@param output - [out] the rotated vector										
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void QuaternionRotate(const T(&quaternion)[4], const T(&vector)[3], T(&output)[3]) noexcept {
+		using REGISTER = decltype(Load<0>(quaternion));
+		if constexpr (CT::Real<T> && !CT::NotSupported<REGISTER>) {
+			// The w lane of the cross products is always zero, and			
+			// the vector is zero-padded, so the fourth lane stays clean	
+			const REGISTER q = Load<0>(quaternion);
+			const REGISTER v = Load<0>(vector);
+			const auto two = Fill<REGISTER>(T {2});
+			const auto t = MultiplyInner<T, 4>(two, InnerCross<T>(q, v));
+			const auto wt = MultiplyInner<T, 4>(Fill<REGISTER>(quaternion[3]), t);
+			Store(AddInner<T, 4>(AddInner<T, 4>(v, wt), InnerCross<T>(q, t)), output);
+		}
+		else {
+			const T t[3] {
+				T {2} * (quaternion[1] * vector[2] - quaternion[2] * vector[1]),
+				T {2} * (quaternion[2] * vector[0] - quaternion[0] * vector[2]),
+				T {2} * (quaternion[0] * vector[1] - quaternion[1] * vector[0])
+			};
+			const T x = vector[0] + quaternion[3] * t[0] + (quaternion[1] * t[2] - quaternion[2] * t[1]);
+			const T y = vector[1] + quaternion[3] * t[1] + (quaternion[2] * t[0] - quaternion[0] * t[2]);
+			const T z = vector[2] + quaternion[3] * t[2] + (quaternion[0] * t[1] - quaternion[1] * t[0]);
+			output[0] = x;
+			output[1] = y;
+			output[2] = z;
+		}
+	}
+
+	/// Smallest angle slerp works with, below it sin(x) == x to full				
+	/// precision, so the weights smoothly degenerate to a lerp						
+	template<class T>
+	constexpr T SlerpMinimumAngle = CT::RealSP<T> ? T(1e-4) : T(1e-8);
+
+	/// Spherically interpolate between two unit quaternions, always along		
+	/// the shortest arc																			
+	///	@param lhs - the quaternion at factor 0										
+	///	@param rhs - the quaternion at factor 1										
+	///	@param factor - the interpolation factor										
+	///	@param output - [out] the interpolated quaternion							
+	template<class T>
+	LANGULUS(ALWAYSINLINE) void QuaternionSlerp(const T(&lhs)[4], const T(&rhs)[4], const T& factor, T(&output)[4]) noexcept {
+		static_assert(CT::Real<T>, "SIMD::QuaternionSlerp is implemented only for real numbers");
+		const T cosine = Dot(lhs, rhs);
+		const T sign = ::std::copysign(T {1}, cosine);
+		const T theta = ::std::max(::std::acos(::std::min(::std::abs(cosine), T {1})), SlerpMinimumAngle<T>);
+		const T invSin = T {1} / ::std::sin(theta);
+		const T wl = ::std::sin((T {1} - factor) * theta) * invSin;
+		const T wr = ::std::sin(factor * theta) * invSin * sign;
+
+		using REGISTER = decltype(Load<0>(lhs));
+		if constexpr (!CT::NotSupported<REGISTER>) {
+			Store(AddInner<T, 4>(
+				MultiplyInner<T, 4>(Fill<REGISTER>(wl), Load<0>(lhs)),
+				MultiplyInner<T, 4>(Fill<REGISTER>(wr), Load<0>(rhs))
+			), output);
+		}
+		else {
+			for (Offset i = 0; i < 4; ++i)
+				output[i] = wl * lhs[i] + wr * rhs[i];
+		}
+	}
+
+	/// Get the Hamilton products of a batch of quaternion pairs					
+	///	@param lhs - the left quaternion components									
+	///	@param rhs - the right quaternion components									
+	///	@param output - [out] the product components									
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void QuaternionMultiplySpan(const IN(&lhs)[4], const IN(&rhs)[4], OUT(&output)[4]) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = ::std::ranges::size(output[0]);
+		const T* l[4];
+		const T* r[4];
+		T* o[4];
+		for (Count c = 0; c < 4; ++c) {
+			count = ::std::ranges::size(output[c]) < count ? ::std::ranges::size(output[c]) : count;
+			count = OverlapCount(lhs[c], rhs[c]) < count ? OverlapCount(lhs[c], rhs[c]) : count;
+			l[c] = ::std::ranges::data(lhs[c]);
+			r[c] = ::std::ranges::data(rhs[c]);
+			o[c] = ::std::ranges::data(output[c]);
+		}
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			const auto mul = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return MultiplyInner<T, L>(a, b);
+			};
+			const auto add = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return AddInner<T, L>(a, b);
+			};
+			const auto sub = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return SubtractInner<T, L>(a, b);
+			};
+
+			for (; i + L <= count; i += L) {
+				REGISTER a[4], b[4];
+				for (Count c = 0; c < 4; ++c) {
+					a[c] = Load<0>(reinterpret_cast<const CHUNK&>(l[c][i]));
+					b[c] = Load<0>(reinterpret_cast<const CHUNK&>(r[c][i]));
+				}
+
+				Store(sub(add(add(mul(a[3], b[0]), mul(a[0], b[3])), mul(a[1], b[2])), mul(a[2], b[1])), reinterpret_cast<CHUNK&>(o[0][i]));
+				Store(add(add(sub(mul(a[3], b[1]), mul(a[0], b[2])), mul(a[1], b[3])), mul(a[2], b[0])), reinterpret_cast<CHUNK&>(o[1][i]));
+				Store(add(sub(add(mul(a[3], b[2]), mul(a[0], b[1])), mul(a[1], b[0])), mul(a[2], b[3])), reinterpret_cast<CHUNK&>(o[2][i]));
+				Store(sub(sub(sub(mul(a[3], b[3]), mul(a[0], b[0])), mul(a[1], b[1])), mul(a[2], b[2])), reinterpret_cast<CHUNK&>(o[3][i]));
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const T a[4] {l[0][i], l[1][i], l[2][i], l[3][i]};
+			const T b[4] {r[0][i], r[1][i], r[2][i], r[3][i]};
+			o[0][i] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+			o[1][i] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+			o[2][i] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+			o[3][i] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+		}
+	}
+
+	/// Rotate a batch of 3D vectors by a batch of unit quaternions				
+	///	@param quaternions - the rotation components									
+	///	@param vectors - the vector components											
+	///	@param output - [out] the rotated vector components						
+	template<CT::Span QUAT, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void QuaternionRotateSpan(const QUAT(&quaternions)[4], const IN(&vectors)[3], OUT(&output)[3]) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<QUAT>> && CT::Same<T, SpanType<OUT>>,
+			"Span types must match");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = ::std::ranges::size(quaternions[3]);
+		const T* q[4];
+		const T* v[3];
+		T* o[3];
+		q[3] = ::std::ranges::data(quaternions[3]);
+		for (Count c = 0; c < 3; ++c) {
+			count = ::std::ranges::size(output[c]) < count ? ::std::ranges::size(output[c]) : count;
+			count = OverlapCount(quaternions[c], vectors[c]) < count ? OverlapCount(quaternions[c], vectors[c]) : count;
+			q[c] = ::std::ranges::data(quaternions[c]);
+			v[c] = ::std::ranges::data(vectors[c]);
+			o[c] = ::std::ranges::data(output[c]);
+		}
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			const auto mul = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return MultiplyInner<T, L>(a, b);
+			};
+			const auto add = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return AddInner<T, L>(a, b);
+			};
+			const auto sub = [](const REGISTER& a, const REGISTER& b) noexcept {
+				return SubtractInner<T, L>(a, b);
+			};
+			const auto two = Fill<REGISTER>(T {2});
+
+			for (; i + L <= count; i += L) {
+				REGISTER a[4], b[3];
+				a[3] = Load<0>(reinterpret_cast<const CHUNK&>(q[3][i]));
+				for (Count c = 0; c < 3; ++c) {
+					a[c] = Load<0>(reinterpret_cast<const CHUNK&>(q[c][i]));
+					b[c] = Load<0>(reinterpret_cast<const CHUNK&>(v[c][i]));
+				}
+
+				const REGISTER t[3] {
+					mul(two, sub(mul(a[1], b[2]), mul(a[2], b[1]))),
+					mul(two, sub(mul(a[2], b[0]), mul(a[0], b[2]))),
+					mul(two, sub(mul(a[0], b[1]), mul(a[1], b[0])))
+				};
+
+				Store(add(add(b[0], mul(a[3], t[0])), sub(mul(a[1], t[2]), mul(a[2], t[1]))), reinterpret_cast<CHUNK&>(o[0][i]));
+				Store(add(add(b[1], mul(a[3], t[1])), sub(mul(a[2], t[0]), mul(a[0], t[2]))), reinterpret_cast<CHUNK&>(o[1][i]));
+				Store(add(add(b[2], mul(a[3], t[2])), sub(mul(a[0], t[1]), mul(a[1], t[0]))), reinterpret_cast<CHUNK&>(o[2][i]));
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const T a[4] {q[0][i], q[1][i], q[2][i], q[3][i]};
+			const T b[3] {v[0][i], v[1][i], v[2][i]};
+			const T t[3] {
+				T {2} * (a[1] * b[2] - a[2] * b[1]),
+				T {2} * (a[2] * b[0] - a[0] * b[2]),
+				T {2} * (a[0] * b[1] - a[1] * b[0])
+			};
+			o[0][i] = b[0] + a[3] * t[0] + (a[1] * t[2] - a[2] * t[1]);
+			o[1][i] = b[1] + a[3] * t[1] + (a[2] * t[0] - a[0] * t[2]);
+			o[2][i] = b[2] + a[3] * t[2] + (a[0] * t[1] - a[1] * t[0]);
+		}
+	}
+
+	/// Spherically interpolate between two batches of unit quaternions,			
+	/// using the same factor for all of them												
+	///	@param lhs - the quaternion components at factor 0							
+	///	@param rhs - the quaternion components at factor 1							
+	///	@param factor - the interpolation factor										
+	///	@param output - [out] the interpolated quaternion components			
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void QuaternionSlerpSpan(const IN(&lhs)[4], const IN(&rhs)[4], const SpanType<IN>& factor, OUT(&output)[4]) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Real<T>, "SIMD::QuaternionSlerpSpan is implemented only for real numbers");
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		Count count = ::std::ranges::size(output[0]);
+		const T* l[4];
+		const T* r[4];
+		T* o[4];
+		for (Count c = 0; c < 4; ++c) {
+			count = ::std::ranges::size(output[c]) < count ? ::std::ranges::size(output[c]) : count;
+			count = OverlapCount(lhs[c], rhs[c]) < count ? OverlapCount(lhs[c], rhs[c]) : count;
+			l[c] = ::std::ranges::data(lhs[c]);
+			r[c] = ::std::ranges::data(rhs[c]);
+			o[c] = ::std::ranges::data(output[c]);
+		}
+
+		Count i = 0;
+		if constexpr (L > 1 && !CT::NotSupported<REGISTER>) {
+			using CHUNK = T[L];
+			const auto one = Fill<REGISTER>(T {1});
+			const auto minimumAngle = Fill<REGISTER>(SlerpMinimumAngle<T>);
+			const auto factorL = Fill<REGISTER>(T {1} - factor);
+			const auto factorR = Fill<REGISTER>(factor);
+
+			for (; i + L <= count; i += L) {
+				REGISTER a[4], b[4];
+				for (Count c = 0; c < 4; ++c) {
+					a[c] = Load<0>(reinterpret_cast<const CHUNK&>(l[c][i]));
+					b[c] = Load<0>(reinterpret_cast<const CHUNK&>(r[c][i]));
+				}
+
+				auto cosine = MultiplyInner<T, L>(a[0], b[0]);
+				for (Count c = 1; c < 4; ++c)
+					cosine = AddInner<T, L>(cosine, MultiplyInner<T, L>(a[c], b[c]));
+
+				// Flip rhs to the shortest arc, and clamp rounding errors	
+				const auto sign = CopySignInner<T, L>(one, cosine);
+				cosine = MinInner<T, L>(InnerAbs<T, L>(cosine), one);
+
+				const auto theta = MaxInner<T, L>(InnerTrig<TrigStyle::ACos, T, L>(cosine), minimumAngle);
+				const auto invSin = DivideInner<T, L>(one, InnerTrig<TrigStyle::Sin, T, L>(theta));
+				const auto wl = MultiplyInner<T, L>(InnerTrig<TrigStyle::Sin, T, L>(MultiplyInner<T, L>(factorL, theta)), invSin);
+				const auto wr = MultiplyInner<T, L>(MultiplyInner<T, L>(InnerTrig<TrigStyle::Sin, T, L>(MultiplyInner<T, L>(factorR, theta)), invSin), sign);
+
+				for (Count c = 0; c < 4; ++c) {
+					Store(
+						AddInner<T, L>(MultiplyInner<T, L>(wl, a[c]), MultiplyInner<T, L>(wr, b[c])),
+						reinterpret_cast<CHUNK&>(o[c][i])
+					);
+				}
+			}
+		}
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const T a[4] {l[0][i], l[1][i], l[2][i], l[3][i]};
+			const T b[4] {r[0][i], r[1][i], r[2][i], r[3][i]};
+			T result[4];
+			QuaternionSlerp(a, b, factor, result);
+			for (Count c = 0; c < 4; ++c)
+				o[c][i] = result[c];
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,278 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Hash.hpp"
+#include "Add.hpp"
+#include "Subtract.hpp"
+#include "Multiply.hpp"
+#include "Sqrt.hpp"
+#include "Log.hpp"
+#include "Trigonometry.hpp"
+#include <bit>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Advance a SplitMix64 state and get the next number from it					
+	/// Used only to expand seeds into full xoshiro256++ states						
+	///	@param state - [in/out] the state												
+	///	@return the next number																
+	NOD() LANGULUS(ALWAYSINLINE) constexpr ::std::uint64_t SplitMix64(::std::uint64_t& state) noexcept {
+		state += 0x9E3779B97F4A7C15ull;
+		auto z = state;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	/// Eight independent xoshiro256++ streams, stepped together in registers	
+	/// The number of streams doesn't depend on the register width, so the		
+	/// same seed produces the same numbers with SSE, AVX, AVX-512 or no SIMD	
+	/// at all. Each step of the engine produces a block of 64 random bytes		
+	struct RandomEngine {
+		static constexpr Count Lanes = 8;
+		alignas(64) ::std::uint64_t mState[4][Lanes];
+
+		/// Seed all streams																		
+		///	@param seed - the seed															
+		///	@param stream - tells apart engines with the same seed, for example
+		///		the index of the thread that owns the engine							
+		RandomEngine(::std::uint64_t seed, ::std::uint64_t stream = 0) noexcept {
+			auto state = seed ^ SplitMix64(stream);
+			for (Count lane = 0; lane < Lanes; ++lane) {
+				for (auto& word : mState)
+					word[lane] = SplitMix64(state);
+			}
+		}
+	};
+
+	/// Step xoshiro256++ in all 64-bit lanes												
+	///	@param s - [in/out] the four state words										
+	///	@return the random bits																
+	template<class R>
+	NOD() LANGULUS(ALWAYSINLINE) R InnerRandomStep(R(&s)[4]) noexcept {
+		const auto result = InnerHashAdd(InnerHashRotate<23>(InnerHashAdd(s[0], s[3])), s[0]);
+		const auto t = InnerHashShiftLeft<17>(s[1]);
+		s[2] = InnerHashXOr(s[2], s[0]);
+		s[3] = InnerHashXOr(s[3], s[1]);
+		s[1] = InnerHashXOr(s[1], s[2]);
+		s[0] = InnerHashXOr(s[0], s[3]);
+		s[2] = InnerHashXOr(s[2], t);
+		s[3] = InnerHashRotate<45>(s[3]);
+		return result;
+	}
+
+	/// Run the engine for a number of blocks, keeping its state in registers	
+	///	@param engine - [in/out] the engine												
+	///	@param blocks - the number of blocks											
+	///	@param call - invoked with the block index, the index of the chunk of
+	///		lanes, and the state of these lanes, which it should step			
+	template<class F>
+	LANGULUS(ALWAYSINLINE) void InnerRandomBlocks(RandomEngine& engine, Count blocks, F&& call) noexcept {
+		using REGISTER = MaxRegister<::std::uint64_t>;
+		using R = Conditional<(MaxLanes<::std::uint64_t> >= 2 && !CT::NotSupported<REGISTER>), REGISTER, ::std::uint64_t>;
+		constexpr Count L = sizeof(R) / sizeof(::std::uint64_t);
+		constexpr Count C = RandomEngine::Lanes / L;
+
+		R state[C][4];
+		for (Count c = 0; c < C; ++c) {
+			for (Count w = 0; w < 4; ++w) {
+				if constexpr (CT::Same<R, ::std::uint64_t>)
+					state[c][w] = engine.mState[w][c];
+				else
+					state[c][w] = InnerHashLoadKeys<R>(engine.mState[w] + c * L);
+			}
+		}
+
+		for (Count block = 0; block < blocks; ++block) {
+			for (Count c = 0; c < C; ++c)
+				call(block, c, state[c]);
+		}
+
+		for (Count c = 0; c < C; ++c) {
+			for (Count w = 0; w < 4; ++w) {
+				if constexpr (CT::Same<R, ::std::uint64_t>)
+					engine.mState[w][c] = state[c][w];
+				else
+					Store(state[c][w], reinterpret_cast<::std::uint64_t(&)[L]>(engine.mState[w][c * L]));
+			}
+		}
+	}
+
+	/// Turn random bits into a uniform real number in [0, 1), the old way		
+	/// The bits become the mantissa of a number in [1, 2), and one is			
+	/// subtracted from it																		
+	///	@param bits - the random bits, as many as the real number has			
+	///	@return the real number																
+	template<CT::Real T>
+	NOD() LANGULUS(ALWAYSINLINE) T RandomUniformFallback(const Conditional<CT::RealSP<T>, ::std::uint32_t, ::std::uint64_t>& bits) noexcept {
+		if constexpr (CT::RealSP<T>)
+			return ::std::bit_cast<float>((bits >> 9) | 0x3F800000u) - 1.0f;
+		else
+			return ::std::bit_cast<double>((bits >> 12) | 0x3FF0000000000000ull) - 1.0;
+	}
+
+	/// Turn random bits into uniform real numbers in [0, 1) via SIMD				
+	///	@tparam T - the type of real numbers											
+	///	@param bits - the random bits														
+	///	@return the real numbers															
+	template<CT::Real T, CT::TSIMD REGISTER>
+	NOD() LANGULUS(ALWAYSINLINE) auto InnerRandomUniform(const REGISTER& bits) noexcept {
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_sub_ps(simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_srli_epi32(bits, 9), simde_mm_set1_epi32(0x3F800000))), simde_mm_set1_ps(1.0f));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(bits, 12), simde_mm_set1_epi64x(0x3FF0000000000000ll))), simde_mm_set1_pd(1.0));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerRandomUniform of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm256_sub_ps(simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_srli_epi32(bits, 9), simde_mm256_set1_epi32(0x3F800000))), simde_mm256_set1_ps(1.0f));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(bits, 12), simde_mm256_set1_epi64x(0x3FF0000000000000ll))), simde_mm256_set1_pd(1.0));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerRandomUniform of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm512_sub_ps(simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_srli_epi32(bits, 9), simde_mm512_set1_epi32(0x3F800000))), simde_mm512_set1_ps(1.0f));
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(bits, 12), simde_mm512_set1_epi64(0x3FF0000000000000ll))), simde_mm512_set1_pd(1.0));
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerRandomUniform of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerRandomUniform");
+	}
+
+	/// Write the random bits of a chunk of lanes as numbers							
+	/// Integers get the raw bits, real numbers are uniform in [0, 1)				
+	///	@param bits - the random bits														
+	///	@param output - [out] where to write the numbers							
+	template<class T, class R>
+	LANGULUS(ALWAYSINLINE) void InnerRandomStore(const R& bits, T* output) noexcept {
+		constexpr Count N = sizeof(R) / sizeof(T);
+		if constexpr (CT::Same<R, ::std::uint64_t>) {
+			if constexpr (CT::Real<T>) {
+				Conditional<CT::RealSP<T>, ::std::uint32_t, ::std::uint64_t> words[N];
+				::std::memcpy(words, &bits, sizeof(R));
+				for (Count i = 0; i < N; ++i)
+					output[i] = RandomUniformFallback<T>(words[i]);
+			}
+			else ::std::memcpy(output, &bits, sizeof(R));
+		}
+		else if constexpr (CT::Real<T>)
+			Store(InnerRandomUniform<T>(bits), reinterpret_cast<T(&)[N]>(*output));
+		else
+			Store(bits, reinterpret_cast<T(&)[N]>(*output));
+	}
+
+	/// Fill a span with random numbers														
+	/// Integers get uniformly distributed bits, real numbers are uniform in	
+	/// [0, 1). Every call consumes whole blocks of the engine, so a span whose
+	/// size isn't a multiple of a block discards the rest of its last block	
+	///	@param engine - [in/out] the engine												
+	///	@param output - [out] the numbers												
+	template<CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void RandomSpan(RandomEngine& engine, OUT&& output) noexcept {
+		using T = SpanType<OUT>;
+		static_assert(CT::Number<T>, "SIMD::RandomSpan works only with numbers");
+		constexpr Count perBlock = RandomEngine::Lanes * sizeof(::std::uint64_t) / sizeof(T);
+		const Count count = ::std::ranges::size(output);
+		T* out = ::std::ranges::data(output);
+
+		const auto generate = [](T* to) noexcept {
+			return [to](Count block, Count chunk, auto& state) noexcept {
+				constexpr Count perChunk = sizeof(state[0]) / sizeof(T);
+				InnerRandomStore(InnerRandomStep(state), to + block * perBlock + chunk * perChunk);
+			};
+		};
+		InnerRandomBlocks(engine, count / perBlock, generate(out));
+
+		if (count % perBlock) {
+			// Generate the last block aside, and use only part of it		
+			T rest[perBlock];
+			InnerRandomBlocks(engine, 1, generate(rest));
+			::std::memcpy(out + count / perBlock * perBlock, rest, count % perBlock * sizeof(T));
+		}
+	}
+
+	/// Fill a span with normally distributed real numbers, using Box-Muller	
+	/// Every two blocks of the engine give two blocks of numbers - one from	
+	/// the cosine, the other from the sine of the same angles						
+	///	@param engine - [in/out] the engine												
+	///	@param output - [out] the numbers												
+	///	@param mean - the mean of the distribution									
+	///	@param deviation - the standard deviation of the distribution			
+	template<CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void RandomNormalSpan(RandomEngine& engine, OUT&& output, SpanType<OUT> mean = 0, SpanType<OUT> deviation = 1) noexcept {
+		using T = SpanType<OUT>;
+		static_assert(CT::Real<T>, "SIMD::RandomNormalSpan works only with real numbers");
+		constexpr Count perBlock = RandomEngine::Lanes * sizeof(::std::uint64_t) / sizeof(T);
+		const Count count = ::std::ranges::size(output);
+		T* out = ::std::ranges::data(output);
+
+		const auto generate = [mean, deviation](T* to) noexcept {
+			return [to, mean, deviation](Count pair, Count chunk, auto& state) noexcept {
+				using R = Decay<decltype(state[0])>;
+				constexpr Count S = sizeof(R) / sizeof(T);
+				constexpr T tau = static_cast<T>(6.283185307179586476925286766559);
+				const auto u1 = InnerRandomStep(state);
+				const auto u2 = InnerRandomStep(state);
+				T* cosines = to + pair * 2 * perBlock + chunk * S;
+				T* sines = cosines + perBlock;
+
+				if constexpr (CT::Same<R, ::std::uint64_t>) {
+					T uniform1[S], uniform2[S];
+					InnerRandomStore(u1, uniform1);
+					InnerRandomStore(u2, uniform2);
+					for (Count i = 0; i < S; ++i) {
+						const T radius = ::std::sqrt(T {-2} * ::std::log(T {1} - uniform1[i])) * deviation;
+						const T angle = uniform2[i] * tau;
+						cosines[i] = mean + radius * ::std::cos(angle);
+						sines[i] = mean + radius * ::std::sin(angle);
+					}
+				}
+				else {
+					using V = decltype(InnerRandomUniform<T>(u1));
+					const auto radius = MultiplyInner<T, S>(
+						InnerSqrt<T, S>(MultiplyInner<T, S>(Fill<V>(T {-2}),
+							InnerLog<LogStyle::Natural, T, S>(SubtractInner<T, S>(Fill<V>(T {1}), InnerRandomUniform<T>(u1))))),
+						Fill<V>(deviation));
+					const auto angle = MultiplyInner<T, S>(InnerRandomUniform<T>(u2), Fill<V>(tau));
+					const auto center = Fill<V>(mean);
+					Store(AddInner<T, S>(center, MultiplyInner<T, S>(radius, InnerTrig<TrigStyle::Cos, T, S>(angle))),
+						reinterpret_cast<T(&)[S]>(*cosines));
+					Store(AddInner<T, S>(center, MultiplyInner<T, S>(radius, InnerTrig<TrigStyle::Sin, T, S>(angle))),
+						reinterpret_cast<T(&)[S]>(*sines));
+				}
+			};
+		};
+		InnerRandomBlocks(engine, count / (2 * perBlock), generate(out));
+
+		if (count % (2 * perBlock)) {
+			// Generate the last pair of blocks aside, and use only part of it
+			T rest[2 * perBlock];
+			InnerRandomBlocks(engine, 1, generate(rest));
+			::std::memcpy(out + count / (2 * perBlock) * 2 * perBlock, rest, count % (2 * perBlock) * sizeof(T));
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
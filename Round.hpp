@@ -8,10 +8,16 @@
 #pragma once
 #include "Fill.hpp"
 #include "Convert.hpp"
+#include "Span.hpp"
 
 namespace Langulus::SIMD
 {
 
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerRound(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
 	/// Get floored values via SIMD															
 	///	@tparam T - the type of the array element										
 	///	@tparam S - the size of the array												
@@ -52,4 +58,38 @@ namespace Langulus::SIMD
 		return InnerRound<T, S>(Load<0>(value));
 	}
 
+	/// Round a span of real numbers, writing the results to another span		
+	///	@param input - the numbers to round												
+	///	@param output - [out] the rounded numbers										
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void RoundSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerRound<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ::std::nearbyint(v);
+			}
+		);
+	}
+
+	/// Round a span of real numbers in place												
+	///	@param data - [in/out] the numbers to round									
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void RoundSpan(DATA&& data) noexcept {
+		RoundSpan(data, data);
+	}
+
+	/// Round an array, writing the results to another array							
+	///	@param value - the numbers to round												
+	///	@param output - [out] the rounded numbers										
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) void Round(const T(&value)[S], T(&output)[S]) noexcept {
+		RoundSpan(value, output);
+	}
+
 } // namespace Langulus::SIMD
\ No newline at end of file
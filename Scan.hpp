@@ -0,0 +1,225 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include <array>
+#include <thread>
+#include <vector>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Add two 16-byte registers, element-wise, wrapping on overflow				
+	/// Unlike AddInner, unsigned integers never saturate here, so that			
+	/// running sums behave exactly like their scalar counterparts					
+	///	@tparam T - the type of the elements											
+	///	@param lhs - the left register													
+	///	@param rhs - the right register													
+	///	@return the sums																		
+	template<class T>
+	LANGULUS(ALWAYSINLINE) simde__m128i InnerScanAdd(const simde__m128i& lhs, const simde__m128i& rhs) noexcept {
+		if constexpr (CT::RealSP<T>)
+			return simde_mm_castps_si128(simde_mm_add_ps(simde_mm_castsi128_ps(lhs), simde_mm_castsi128_ps(rhs)));
+		else if constexpr (CT::RealDP<T>)
+			return simde_mm_castpd_si128(simde_mm_add_pd(simde_mm_castsi128_pd(lhs), simde_mm_castsi128_pd(rhs)));
+		else if constexpr (sizeof(T) == 1)
+			return simde_mm_add_epi8(lhs, rhs);
+		else if constexpr (sizeof(T) == 2)
+			return simde_mm_add_epi16(lhs, rhs);
+		else if constexpr (sizeof(T) == 4)
+			return simde_mm_add_epi32(lhs, rhs);
+		else if constexpr (sizeof(T) == 8)
+			return simde_mm_add_epi64(lhs, rhs);
+		else LANGULUS_ASSERT("Unsupported type for SIMD::InnerScanAdd");
+	}
+
+	/// Byte shuffle mask that broadcasts the last T inside a 16-byte register	
+	template<class T>
+	constexpr auto ScanBroadcastMask = []() {
+		::std::array<::std::int8_t, 16> mask {};
+		for (Count b = 0; b < 16; ++b)
+			mask[b] = static_cast<::std::int8_t>(16 - sizeof(T) + b % sizeof(T));
+		return mask;
+	}();
+
+	/// Broadcast the last element of a 16-byte register to all elements			
+	///	@tparam T - the type of the elements											
+	///	@param value - the register														
+	///	@return the broadcasted last element											
+	template<class T>
+	LANGULUS(ALWAYSINLINE) simde__m128i InnerScanLast(const simde__m128i& value) noexcept {
+		return simde_mm_shuffle_epi8(value, simde_mm_loadu_si128(
+			reinterpret_cast<const simde__m128i*>(ScanBroadcastMask<T>.data())));
+	}
+
+	/// Get the inclusive prefix sum inside a 16-byte register, using log2		
+	/// steps of shifting by one, two, four... elements and adding					
+	///	@tparam T - the type of the elements											
+	///	@param value - the register														
+	///	@return the running sums															
+	template<class T>
+	LANGULUS(ALWAYSINLINE) simde__m128i InnerScan(simde__m128i value) noexcept {
+		if constexpr (sizeof(T) <= 1)
+			value = InnerScanAdd<T>(value, simde_mm_slli_si128(value, 1));
+		if constexpr (sizeof(T) <= 2)
+			value = InnerScanAdd<T>(value, simde_mm_slli_si128(value, 2));
+		if constexpr (sizeof(T) <= 4)
+			value = InnerScanAdd<T>(value, simde_mm_slli_si128(value, 4));
+		return InnerScanAdd<T>(value, simde_mm_slli_si128(value, 8));
+	}
+
+	/// Get the running sums of a span, where output[i] is the sum of				
+	/// initial and all inputs up to and including input[i]							
+	/// Registers are scanned independently, and the last sum of each one is	
+	/// carried over to the next register													
+	///	@param input - the numbers to sum												
+	///	@param output - [out] the running sums (can be the same as input)		
+	///	@param initial - the value to start summing from							
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void InclusiveScan(IN&& input, OUT&& output, SpanType<IN> initial = {}) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		const Count count = OverlapCount(input, output);
+		const T* in = ::std::ranges::data(input);
+		T* out = ::std::ranges::data(output);
+		Count i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (sizeof(T) <= 8 && 16 % sizeof(T) == 0) {
+				constexpr Count L = 16 / sizeof(T);
+				T init[L];
+				for (auto& e : init)
+					e = initial;
+
+				auto carry = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(init));
+				for (; i + L <= count; i += L) {
+					const auto sums = InnerScanAdd<T>(carry, InnerScan<T>(
+						simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i))));
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i), sums);
+					carry = InnerScanLast<T>(sums);
+				}
+
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(init), carry);
+				initial = init[0];
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			initial = static_cast<T>(initial + in[i]);
+			out[i] = initial;
+		}
+	}
+
+	/// Get the running sums of a span, where output[i] is the sum of				
+	/// initial and all inputs before input[i]											
+	///	@param input - the numbers to sum												
+	///	@param output - [out] the running sums (can be the same as input)		
+	///	@param initial - the value to start summing from							
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void ExclusiveScan(IN&& input, OUT&& output, SpanType<IN> initial = {}) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		const Count count = OverlapCount(input, output);
+		const T* in = ::std::ranges::data(input);
+		T* out = ::std::ranges::data(output);
+		Count i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (sizeof(T) <= 8 && 16 % sizeof(T) == 0) {
+				constexpr Count L = 16 / sizeof(T);
+				T init[L];
+				for (auto& e : init)
+					e = initial;
+
+				auto carry = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(init));
+				for (; i + L <= count; i += L) {
+					// Shifting the inclusive sums by one element makes them	
+					// exclusive, without having to subtract the inputs back	
+					const auto sums = InnerScan<T>(
+						simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i)));
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + i),
+						InnerScanAdd<T>(carry, simde_mm_slli_si128(sums, sizeof(T))));
+					carry = InnerScanAdd<T>(carry, InnerScanLast<T>(sums));
+				}
+
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(init), carry);
+				initial = init[0];
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			const T next = static_cast<T>(initial + in[i]);
+			out[i] = initial;
+			initial = next;
+		}
+	}
+
+	/// Get the running sums of a very large span using multiple threads			
+	/// The span is split into one chunk per thread. The first pass sums each	
+	/// chunk in parallel, the chunk totals are then scanned to get each			
+	/// chunk's offset, and the second pass scans all chunks in parallel			
+	/// Worth it only for spans far bigger than the per-thread cache				
+	///	@param input - the numbers to sum												
+	///	@param output - [out] the running sums (can be the same as input)		
+	///	@param initial - the value to start summing from							
+	///	@param threads - number of threads to use, zero to use all cores		
+	template<CT::Span IN, CT::Span OUT>
+	void InclusiveScanParallel(IN&& input, OUT&& output, SpanType<IN> initial = {}, Count threads = 0) {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		const Count count = OverlapCount(input, output);
+		if (threads == 0)
+			threads = ::std::thread::hardware_concurrency();
+		if (threads > count / 2)
+			threads = count / 2;
+		if (threads < 2)
+			return InclusiveScan(input, output, initial);
+
+		const ::std::span<const T> in {::std::ranges::data(input), count};
+		const ::std::span<T> out {::std::ranges::data(output), count};
+		const Count chunk = count / threads;
+		const auto chunkOf = [&](const auto& span, Count t) {
+			return span.subspan(t * chunk, t + 1 == threads ? count - t * chunk : chunk);
+		};
+
+		// First pass - sum each chunk, but the last one, which is			
+		// never needed to offset anything											
+		::std::vector<T> offsets(threads, T {});
+		::std::vector<::std::thread> workers;
+		workers.reserve(threads - 1);
+		for (Count t = 0; t + 1 < threads; ++t) {
+			workers.emplace_back([&, t] {
+				T sum {};
+				for (const auto& e : chunkOf(in, t))
+					sum = static_cast<T>(sum + e);
+				offsets[t + 1] = sum;
+			});
+		}
+		for (auto& worker : workers)
+			worker.join();
+
+		offsets[0] = initial;
+		InclusiveScan(offsets, offsets);
+
+		// Second pass - scan each chunk from its own offset					
+		workers.clear();
+		for (Count t = 0; t < threads; ++t) {
+			workers.emplace_back([&, t] {
+				InclusiveScan(chunkOf(in, t), chunkOf(out, t), offsets[t]);
+			});
+		}
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,205 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerSign(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get the signs (-1, 0 or 1) of the values via SIMD								
+	/// Zeroes of real numbers always become +0, and NaNs become +-1				
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the array															
+	///	@return the signs																		
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerSign(const REGISTER& value) noexcept {
+		static_assert(CT::Signed<T>,
+			"SIMD::InnerSign is suboptimal and pointless for unsigned values, avoid calling it on such");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::SignedInteger8<T>)
+					return simde_mm_sign_epi8(simde_mm_set1_epi8(1), value);
+				else if constexpr (CT::SignedInteger16<T>)
+					return simde_mm_sign_epi16(simde_mm_set1_epi16(1), value);
+				else if constexpr (CT::SignedInteger32<T>)
+					return simde_mm_sign_epi32(simde_mm_set1_epi32(1), value);
+				else if constexpr (CT::SignedInteger64<T>) {
+					// (x < 0 ? -1 : 0) - (x > 0 ? -1 : 0)							
+					const auto zero = simde_mm_setzero_si128();
+					return simde_mm_sub_epi64(
+						simde_mm_cmpgt_epi64(zero, value),
+						simde_mm_cmpgt_epi64(value, zero)
+					);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm_or_ps(
+						simde_mm_and_ps(value, simde_mm_set1_ps(-0.0F)),
+						simde_mm_set1_ps(1.0F)
+					);
+					return simde_mm_and_ps(one, simde_mm_cmpneq_ps(value, simde_mm_setzero_ps()));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm_or_pd(
+						simde_mm_and_pd(value, simde_mm_set1_pd(-0.0)),
+						simde_mm_set1_pd(1.0)
+					);
+					return simde_mm_and_pd(one, simde_mm_cmpneq_pd(value, simde_mm_setzero_pd()));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSign of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::SignedInteger8<T>)
+					return simde_mm256_sign_epi8(simde_mm256_set1_epi8(1), value);
+				else if constexpr (CT::SignedInteger16<T>)
+					return simde_mm256_sign_epi16(simde_mm256_set1_epi16(1), value);
+				else if constexpr (CT::SignedInteger32<T>)
+					return simde_mm256_sign_epi32(simde_mm256_set1_epi32(1), value);
+				else if constexpr (CT::SignedInteger64<T>) {
+					// (x < 0 ? -1 : 0) - (x > 0 ? -1 : 0)							
+					const auto zero = simde_mm256_setzero_si256();
+					return simde_mm256_sub_epi64(
+						simde_mm256_cmpgt_epi64(zero, value),
+						simde_mm256_cmpgt_epi64(value, zero)
+					);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm256_or_ps(
+						simde_mm256_and_ps(value, simde_mm256_set1_ps(-0.0F)),
+						simde_mm256_set1_ps(1.0F)
+					);
+					return simde_mm256_and_ps(one, simde_mm256_cmp_ps(value, simde_mm256_setzero_ps(), _CMP_NEQ_UQ));
+				}
+				else if constexpr (CT::RealDP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm256_or_pd(
+						simde_mm256_and_pd(value, simde_mm256_set1_pd(-0.0)),
+						simde_mm256_set1_pd(1.0)
+					);
+					return simde_mm256_and_pd(one, simde_mm256_cmp_pd(value, simde_mm256_setzero_pd(), _CMP_NEQ_UQ));
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSign of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				const auto zero = simde_mm512_setzero_si512();
+				if constexpr (CT::SignedInteger8<T>) {
+					return simde_mm512_sub_epi8(
+						simde_mm512_movm_epi8(simde_mm512_cmplt_epi8_mask(value, zero)),
+						simde_mm512_movm_epi8(simde_mm512_cmpgt_epi8_mask(value, zero))
+					);
+				}
+				else if constexpr (CT::SignedInteger16<T>) {
+					return simde_mm512_sub_epi16(
+						simde_mm512_movm_epi16(simde_mm512_cmplt_epi16_mask(value, zero)),
+						simde_mm512_movm_epi16(simde_mm512_cmpgt_epi16_mask(value, zero))
+					);
+				}
+				else if constexpr (CT::SignedInteger32<T>) {
+					return simde_mm512_sub_epi32(
+						simde_mm512_movm_epi32(simde_mm512_cmplt_epi32_mask(value, zero)),
+						simde_mm512_movm_epi32(simde_mm512_cmpgt_epi32_mask(value, zero))
+					);
+				}
+				else if constexpr (CT::SignedInteger64<T>) {
+					return simde_mm512_sub_epi64(
+						simde_mm512_movm_epi64(simde_mm512_cmplt_epi64_mask(value, zero)),
+						simde_mm512_movm_epi64(simde_mm512_cmpgt_epi64_mask(value, zero))
+					);
+				}
+				else if constexpr (CT::RealSP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm512_or_ps(
+						simde_mm512_and_ps(value, simde_mm512_set1_ps(-0.0F)),
+						simde_mm512_set1_ps(1.0F)
+					);
+					return simde_mm512_maskz_mov_ps(
+						simde_mm512_cmp_ps_mask(value, simde_mm512_setzero_ps(), _CMP_NEQ_UQ), one);
+				}
+				else if constexpr (CT::RealDP<T>) {
+					// Copy sign bit to 1.0, and mask out the zeroes			
+					const auto one = simde_mm512_or_pd(
+						simde_mm512_and_pd(value, simde_mm512_set1_pd(-0.0)),
+						simde_mm512_set1_pd(1.0)
+					);
+					return simde_mm512_maskz_mov_pd(
+						simde_mm512_cmp_pd_mask(value, simde_mm512_setzero_pd(), _CMP_NEQ_UQ), one);
+				}
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSign of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerSign");
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) auto Sign(const T(&value)[S]) noexcept {
+		return InnerSign<T, S>(Load<0>(value));
+	}
+
+	/// Get the sign of a single number, the same way InnerSign does				
+	///	@param value - the number															
+	///	@return -1, 0 or 1																	
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) T SignFallback(const T& value) noexcept {
+		if constexpr (CT::Real<T>)
+			return value != T {0} ? ::std::copysign(T {1}, value) : T {0};
+		else
+			return static_cast<T>((T {0} < value) - (value < T {0}));
+	}
+
+	/// Get the signs of a span of signed numbers										
+	///	@param input - the numbers to get the signs of								
+	///	@param output - [out] the signs													
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void SignSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerSign<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return SignFallback(v);
+			}
+		);
+	}
+
+	/// Get the signs of a span of signed numbers in place							
+	///	@param data - [in/out] the numbers to get the signs of					
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void SignSpan(DATA&& data) noexcept {
+		SignSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,164 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Convert.hpp"
+#include "Store.hpp"
+#include <cstring>
+#include <ranges>
+#include <span>
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::CT
+{
+
+	/// Concept for contiguous sequences of dense numbers, such as std::span,	
+	/// std::vector, std::array, or plain bounded arrays								
+	template<class T>
+	concept Span = ::std::ranges::contiguous_range<T> && ::std::ranges::sized_range<T>;
+
+} // namespace Langulus::CT
+
+namespace Langulus::SIMD
+{
+
+	/// Size of the widest available register, in bytes (zero if no SIMD)		
+	constexpr Size MaxRegisterSize =
+		LANGULUS_SIMD(512BIT) ? 64 :
+		LANGULUS_SIMD(256BIT) ? 32 :
+		LANGULUS_SIMD(128BIT) ? 16 : 0;
+
+	/// Number of T elements that fit in the widest available register			
+	template<class T>
+	constexpr Count MaxLanes = MaxRegisterSize / sizeof(Decay<T>);
+
+	/// The widest register that can hold T elements, or NotSupported				
+	template<class T>
+	using MaxRegister = decltype(Load<0>(Uneval<Decay<T>[(MaxLanes<T> > 1 ? MaxLanes<T> : 2)]>()));
+
+	/// Type of the elements inside a span													
+	template<CT::Span T>
+	using SpanType = ::std::ranges::range_value_t<T>;
+
+	/// Get the number of elements two spans have in common							
+	///	@param lhs - the left span															
+	///	@param rhs - the right span														
+	///	@return the overlapping count of lhs and rhs									
+	template<CT::Span LHS, CT::Span RHS>
+	NOD() LANGULUS(ALWAYSINLINE) Count OverlapCount(const LHS& lhs, const RHS& rhs) noexcept {
+		const Count l = ::std::ranges::size(lhs);
+		const Count r = ::std::ranges::size(rhs);
+		return l < r ? l : r;
+	}
+
+	/// Stream elements through a unary SIMD operation, register by register	
+	/// The tail that doesn't fill a whole register is padded with DEF inside	
+	/// a temporary array, so that it gets the exact same treatment				
+	///	@tparam DEF - default value to pad the tail with							
+	///	@tparam T - the type of the elements (deducible)							
+	///	@tparam FSIMD - the SIMD operation to invoke (deducible)					
+	///	@tparam FFALL - the fallback operation to invoke (deducible)			
+	///	@param in - the first input element												
+	///	@param out - the first output element (can be the same as in)			
+	///	@param count - number of elements to stream									
+	///	@param opSIMD - the function to invoke on each register					
+	///	@param opFALL - the function to invoke if SIMD is not available		
+	template<int DEF, class T, class FSIMD, class FFALL>
+	LANGULUS(ALWAYSINLINE) void StreamUnary(const T* in, T* out, Count count, FSIMD&& opSIMD, FFALL&& opFALL) {
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		if constexpr (L < 2 || CT::NotSupported<REGISTER>) {
+			// No register can hold more than one T, so do it the old way	
+			for (Count i = 0; i < count; ++i)
+				out[i] = opFALL(in[i]);
+		}
+		else if constexpr (CT::NotSupported<::std::invoke_result_t<FSIMD, REGISTER>>) {
+			// The operation isn't implemented for this register				
+			for (Count i = 0; i < count; ++i)
+				out[i] = opFALL(in[i]);
+		}
+		else {
+			using CHUNK = T[L];
+			Count i = 0;
+			for (; i + L <= count; i += L) {
+				Store(
+					opSIMD(Load<0>(reinterpret_cast<const CHUNK&>(in[i]))),
+					reinterpret_cast<CHUNK&>(out[i])
+				);
+			}
+
+			if (i < count) {
+				// Pad the tail inside a register-sized temporary				
+				CHUNK temp;
+				for (auto& e : temp)
+					e = static_cast<T>(DEF);
+				::std::memcpy(temp, in + i, (count - i) * sizeof(T));
+				Store(opSIMD(Load<0>(temp)), temp);
+				::std::memcpy(out + i, temp, (count - i) * sizeof(T));
+			}
+		}
+	}
+
+	/// Stream elements through a binary SIMD operation, register by register	
+	/// The tail that doesn't fill a whole register is padded with DEF inside	
+	/// temporary arrays, so that it gets the exact same treatment					
+	///	@tparam DEF - default value to pad the tail with							
+	///					  useful against division-by-zero cases						
+	///	@tparam T - the type of the elements (deducible)							
+	///	@tparam FSIMD - the SIMD operation to invoke (deducible)					
+	///	@tparam FFALL - the fallback operation to invoke (deducible)			
+	///	@param lhs - the first left element												
+	///	@param rhs - the first right element											
+	///	@param out - the first output element (can be the same as lhs/rhs)	
+	///	@param count - number of elements to stream									
+	///	@param opSIMD - the function to invoke on each pair of registers		
+	///	@param opFALL - the function to invoke if SIMD is not available		
+	template<int DEF, class T, class FSIMD, class FFALL>
+	LANGULUS(ALWAYSINLINE) void StreamBinary(const T* lhs, const T* rhs, T* out, Count count, FSIMD&& opSIMD, FFALL&& opFALL) {
+		using REGISTER = MaxRegister<T>;
+		constexpr Count L = MaxLanes<T>;
+
+		if constexpr (L < 2 || CT::NotSupported<REGISTER>) {
+			// No register can hold more than one T, so do it the old way	
+			for (Count i = 0; i < count; ++i)
+				out[i] = opFALL(lhs[i], rhs[i]);
+		}
+		else if constexpr (CT::NotSupported<::std::invoke_result_t<FSIMD, REGISTER, REGISTER>>) {
+			// The operation isn't implemented for this register				
+			for (Count i = 0; i < count; ++i)
+				out[i] = opFALL(lhs[i], rhs[i]);
+		}
+		else {
+			using CHUNK = T[L];
+			Count i = 0;
+			for (; i + L <= count; i += L) {
+				Store(
+					opSIMD(
+						Load<0>(reinterpret_cast<const CHUNK&>(lhs[i])),
+						Load<0>(reinterpret_cast<const CHUNK&>(rhs[i]))
+					),
+					reinterpret_cast<CHUNK&>(out[i])
+				);
+			}
+
+			if (i < count) {
+				// Pad the tails inside register-sized temporaries				
+				CHUNK tempLHS, tempRHS;
+				for (Count j = 0; j < L; ++j)
+					tempLHS[j] = tempRHS[j] = static_cast<T>(DEF);
+				::std::memcpy(tempLHS, lhs + i, (count - i) * sizeof(T));
+				::std::memcpy(tempRHS, rhs + i, (count - i) * sizeof(T));
+				Store(opSIMD(Load<0>(tempLHS), Load<0>(tempRHS)), tempLHS);
+				::std::memcpy(out + i, tempLHS, (count - i) * sizeof(T));
+			}
+		}
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,102 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerSqrt(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get square roots via SIMD																
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the array															
+	///	@return the square roots															
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerSqrt(const REGISTER& value) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerSqrt doesn't work for whole numbers");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_sqrt_ps(value);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_sqrt_pd(value);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSqrt of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm256_sqrt_ps(value);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm256_sqrt_pd(value);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSqrt of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm512_sqrt_ps(value);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm512_sqrt_pd(value);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerSqrt of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerSqrt");
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) auto Sqrt(const T(&value)[S]) noexcept {
+		return InnerSqrt<T, S>(Load<0>(value));
+	}
+
+	/// Get the square roots of a span of real numbers									
+	///	@param input - the numbers to get the square roots of						
+	///	@param output - [out] the square roots											
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void SqrtSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerSqrt<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ::std::sqrt(v);
+			}
+		);
+	}
+
+	/// Get the square roots of a span of real numbers in place						
+	///	@param data - [in/out] the numbers to get the square roots of			
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void SqrtSpan(DATA&& data) noexcept {
+		SqrtSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -6,7 +6,7 @@
 /// See LICENSE file, or https://www.gnu.org/licenses									
 ///																									
 #pragma once
-#include "Intrinsics.hpp"
+#include "ConvertHalf.hpp"
 #include "IgnoreWarningsPush.inl"
 
 namespace Langulus::SIMD
@@ -25,6 +25,22 @@ namespace Langulus::SIMD
 			"- avoid SIMD operations on such arrays as a whole");
 		constexpr Size toSize = sizeof(Decay<T>) * S;
 
+		if constexpr (CT::RealHalf<T>) {
+			// 16-bit reals are narrowed from a float register on store	
+			static_assert(CT::SameAsOneOf<FROM, simde__m128, simde__m256, simde__m512>,
+				"16-bit reals can be stored only from float registers");
+			constexpr Count N = sizeof(FROM) / sizeof(float);
+			if constexpr (N == S && CT::Dense<T>)
+				InnerStoreHalf(from, to);
+			else {
+				Decay<T> narrowed[N];
+				InnerStoreHalf(from, narrowed);
+				for (Count i = 0; i < S && i < N; ++i)
+					DenseCast(to[i]) = narrowed[i];
+			}
+		}
+		else
+
 		//																						
 		// __m128*																			
 		//																						
@@ -27,7 +27,9 @@ namespace Langulus::SIMD
 	///	@return the subtracted elements as a register								
 	template<class T, Count S, CT::TSIMD REGISTER>
 	LANGULUS(ALWAYSINLINE) auto SubtractInner(const REGISTER& lhs, const REGISTER& rhs) noexcept {
-		if constexpr (CT::SIMD128<REGISTER>) {
+		if constexpr (CT::FixedPoint<T>)
+			return InnerSubtractFixed<T>(lhs, rhs);
+		else if constexpr (CT::SIMD128<REGISTER>) {
 			if constexpr (CT::SignedInteger8<T>)
 				return simde_mm_sub_epi8(lhs, rhs);
 			else if constexpr (CT::UnsignedInteger8<T>)
@@ -118,7 +120,7 @@ namespace Langulus::SIMD
 		}
 		else {
 			// Extract from std::array													
-			std::memcpy(output, result.data(), sizeof(output));
+			StoreFallback(result, output);
 		}
 	}
 
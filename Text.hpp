@@ -0,0 +1,202 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Find.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	/// Find the index of the first occurence of a character							
+	///	@param text - the characters to search											
+	///	@param character - the character to search for								
+	///	@return the index of the character, or the size of text if missing	
+	template<CT::Span TEXT>
+	NOD() LANGULUS(ALWAYSINLINE) Offset FindChar(TEXT&& text, const SpanType<TEXT>& character) noexcept {
+		static_assert(sizeof(SpanType<TEXT>) <= 4, "Not a character type");
+		return FindFirst(text, character);
+	}
+
+	/// Count the occurences of a character												
+	///	@param text - the characters to search											
+	///	@param character - the character to count										
+	///	@return the number of occurences													
+	template<CT::Span TEXT>
+	NOD() LANGULUS(ALWAYSINLINE) Count CountChar(TEXT&& text, const SpanType<TEXT>& character) noexcept {
+		using T = SpanType<TEXT>;
+		static_assert(sizeof(T) <= 4, "Not a character type");
+		const Count count = ::std::ranges::size(text);
+		const T* in = ::std::ranges::data(text);
+		Count i = 0, result = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count L = SearchRegisterSize / sizeof(T);
+			const auto needle = InnerSearchFill(character);
+			for (; i + L <= count; i += L)
+				result += ::std::popcount(InnerFindMask<T>(InnerSearchLoad(in + i), needle)) / sizeof(T);
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i)
+			result += in[i] == character;
+		return result;
+	}
+
+	/// Get the number of characters before the null-terminator						
+	/// Registers are only ever loaded from aligned addresses, so reading past	
+	/// the terminator never crosses into another (possibly unmapped) page		
+	/// Named StringLength, because Length is the length of a vector				
+	///	@param text - the null-terminated string										
+	///	@return the number of characters before the terminator					
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) Count StringLength(const T* text) noexcept {
+		static_assert(sizeof(T) <= 4, "Not a character type");
+
+		#if LANGULUS_SIMD(128BIT)
+			const auto address = reinterpret_cast<::std::uintptr_t>(text);
+			if (address % sizeof(T) == 0) {
+				// Start from the aligned block of the first character,		
+				// ignoring any matches before it									
+				const auto offset = static_cast<unsigned>(address % SearchRegisterSize);
+				auto block = reinterpret_cast<const ::std::byte*>(address - offset);
+				const auto zero = InnerSearchFill(T {0});
+				auto found = InnerFindMask<T>(InnerSearchLoadAligned(block), zero) >> offset << offset;
+				while (!found) {
+					block += SearchRegisterSize;
+					found = InnerFindMask<T>(InnerSearchLoadAligned(block), zero);
+				}
+
+				const auto terminator = block + ::std::countr_zero(found);
+				return static_cast<Count>(terminator - reinterpret_cast<const ::std::byte*>(text)) / sizeof(T);
+			}
+		#endif
+
+		// Do it the old way																
+		Count result = 0;
+		while (text[result] != T {0})
+			++result;
+		return result;
+	}
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Nibble lookup tables, that classify up to eight different high		
+		/// nibbles of bytes. A byte is in the set, if the bits of its low and	
+		/// high nibble entries intersect													
+		struct NibbleTables {
+			simde__m128i mLow;
+			simde__m128i mHigh;
+		};
+
+		/// Check which bytes in a register are in a set, using pshufb lookups	
+		///	@param value - the bytes to check											
+		///	@param tables - the nibble tables of the set								
+		///	@return a bitmask with a bit set for each byte in the set			
+		NOD() LANGULUS(ALWAYSINLINE) ::std::uint32_t InnerFindAnyOfMask(const SearchRegister& value, const NibbleTables& tables) noexcept {
+			#if LANGULUS_SIMD(256BIT)
+				const auto nibble = simde_mm256_set1_epi8(0x0F);
+				const auto low = simde_mm256_shuffle_epi8(
+					simde_mm256_broadcastsi128_si256(tables.mLow),
+					simde_mm256_and_si256(value, nibble));
+				const auto high = simde_mm256_shuffle_epi8(
+					simde_mm256_broadcastsi128_si256(tables.mHigh),
+					simde_mm256_and_si256(simde_mm256_srli_epi16(value, 4), nibble));
+				const auto miss = simde_mm256_cmpeq_epi8(simde_mm256_and_si256(low, high), simde_mm256_setzero_si256());
+				return ~static_cast<::std::uint32_t>(simde_mm256_movemask_epi8(miss));
+			#else
+				const auto nibble = simde_mm_set1_epi8(0x0F);
+				const auto low = simde_mm_shuffle_epi8(tables.mLow, simde_mm_and_si128(value, nibble));
+				const auto high = simde_mm_shuffle_epi8(tables.mHigh, simde_mm_and_si128(simde_mm_srli_epi16(value, 4), nibble));
+				const auto miss = simde_mm_cmpeq_epi8(simde_mm_and_si128(low, high), simde_mm_setzero_si128());
+				return ~static_cast<::std::uint32_t>(simde_mm_movemask_epi8(miss)) & 0xFFFFu;
+			#endif
+		}
+	#endif
+
+	/// Find the index of the first character that is in a set						
+	/// Byte sets are classified via pshufb nibble tables, eight distinct high	
+	/// nibbles at a time. Wider characters are compared with each character	
+	/// in the set, so keep their sets small												
+	///	@param text - the characters to search											
+	///	@param set - the characters to search for										
+	///	@return the index of the first match, or the size of text if none		
+	template<CT::Span TEXT, CT::Span SET>
+	NOD() LANGULUS(ALWAYSINLINE) Offset FindAnyOf(TEXT&& text, SET&& set) noexcept {
+		using T = SpanType<TEXT>;
+		static_assert(sizeof(T) <= 4, "Not a character type");
+		static_assert(CT::Same<T, SpanType<SET>>, "Set type must match text type");
+		const Count count = ::std::ranges::size(text);
+		const T* in = ::std::ranges::data(text);
+		const T* chars = ::std::ranges::data(set);
+		const Count setSize = ::std::ranges::size(set);
+		Offset i = 0;
+
+		#if LANGULUS_SIMD(128BIT)
+			constexpr Count L = SearchRegisterSize / sizeof(T);
+			if constexpr (sizeof(T) == 1) {
+				// Each group of tables handles up to eight high nibbles		
+				NibbleTables groups[2] {};
+				Count groupCount = 0;
+				::std::uint8_t low[2][16] {}, high[2][16] {};
+				::std::int8_t highBit[16];
+				for (auto& bit : highBit)
+					bit = -1;
+
+				Count distinct = 0;
+				for (Count c = 0; c < setSize; ++c) {
+					const auto byte = static_cast<::std::uint8_t>(chars[c]);
+					const auto h = byte >> 4;
+					if (highBit[h] < 0)
+						highBit[h] = static_cast<::std::int8_t>(distinct++);
+					const auto group = highBit[h] / 8;
+					const auto bit = static_cast<::std::uint8_t>(1u << (highBit[h] % 8));
+					low[group][byte & 0x0F] |= bit;
+					high[group][h] |= bit;
+				}
+
+				groupCount = (distinct + 7) / 8;
+				for (Count g = 0; g < groupCount; ++g) {
+					groups[g].mLow = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(low[g]));
+					groups[g].mHigh = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(high[g]));
+				}
+
+				if (groupCount) {
+					for (; i + L <= count; i += L) {
+						const auto value = InnerSearchLoad(in + i);
+						auto found = InnerFindAnyOfMask(value, groups[0]);
+						if (groupCount > 1)
+							found |= InnerFindAnyOfMask(value, groups[1]);
+						if (found)
+							return i + ::std::countr_zero(found);
+					}
+				}
+			}
+			else if (setSize) {
+				for (; i + L <= count; i += L) {
+					const auto value = InnerSearchLoad(in + i);
+					::std::uint32_t found = 0;
+					for (Count c = 0; c < setSize; ++c)
+						found |= InnerFindMask<T>(value, InnerSearchFill(chars[c]));
+					if (found)
+						return i + ::std::countr_zero(found) / sizeof(T);
+				}
+			}
+		#endif
+
+		// Do the rest the old way														
+		for (; i < count; ++i) {
+			for (Count c = 0; c < setSize; ++c) {
+				if (in[i] == chars[c])
+					return i;
+			}
+		}
+		return count;
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
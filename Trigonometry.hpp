@@ -0,0 +1,205 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	enum class TrigStyle {
+		Sin,
+		Cos,
+		Tan,
+		ASin,
+		ACos,
+		ATan
+	};
+
+	template<TrigStyle STYLE, class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerTrig(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get sine/cosine/tangent or their inverse values via SIMD					
+	/// All angles are in radians																
+	///	@tparam STYLE - the trigonometric function									
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the array															
+	///	@return the trigonometric values													
+	template<TrigStyle STYLE, class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) REGISTER InnerTrig(const REGISTER& value) noexcept {
+		static_assert(CT::Real<T>, "SIMD::InnerTrig doesn't work for whole numbers");
+
+		if constexpr (CT::SIMD128<REGISTER>) {
+			if constexpr (CT::RealSP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm_sin_ps(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm_cos_ps(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm_tan_ps(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm_asin_ps(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm_acos_ps(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm_atan_ps(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of float[4] package");
+			}
+			else if constexpr (CT::RealDP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm_sin_pd(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm_cos_pd(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm_tan_pd(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm_asin_pd(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm_acos_pd(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm_atan_pd(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of double[2] package");
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTrig of 16-byte package");
+		}
+		else if constexpr (CT::SIMD256<REGISTER>) {
+			if constexpr (CT::RealSP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm256_sin_ps(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm256_cos_ps(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm256_tan_ps(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm256_asin_ps(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm256_acos_ps(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm256_atan_ps(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of float[8] package");
+			}
+			else if constexpr (CT::RealDP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm256_sin_pd(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm256_cos_pd(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm256_tan_pd(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm256_asin_pd(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm256_acos_pd(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm256_atan_pd(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of double[4] package");
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTrig of 32-byte package");
+		}
+		else if constexpr (CT::SIMD512<REGISTER>) {
+			if constexpr (CT::RealSP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm512_sin_ps(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm512_cos_ps(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm512_tan_ps(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm512_asin_ps(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm512_acos_ps(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm512_atan_ps(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of float[16] package");
+			}
+			else if constexpr (CT::RealDP<T>) {
+				if constexpr (STYLE == TrigStyle::Sin)
+					return simde_mm512_sin_pd(value);
+				else if constexpr (STYLE == TrigStyle::Cos)
+					return simde_mm512_cos_pd(value);
+				else if constexpr (STYLE == TrigStyle::Tan)
+					return simde_mm512_tan_pd(value);
+				else if constexpr (STYLE == TrigStyle::ASin)
+					return simde_mm512_asin_pd(value);
+				else if constexpr (STYLE == TrigStyle::ACos)
+					return simde_mm512_acos_pd(value);
+				else if constexpr (STYLE == TrigStyle::ATan)
+					return simde_mm512_atan_pd(value);
+				else LANGULUS_ASSERT("Unsupported style for SIMD::InnerTrig of double[8] package");
+			}
+			else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTrig of 64-byte package");
+		}
+		else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTrig");
+	}
+
+	/// Get a trigonometric function of an array											
+	///	@tparam STYLE - the trigonometric function									
+	///	@param value - the array															
+	///	@return the trigonometric values as a register								
+	template<TrigStyle STYLE, class T, Count S>
+	LANGULUS(ALWAYSINLINE) auto Trig(const T(&value)[S]) noexcept {
+		return InnerTrig<STYLE, T, S>(Load<0>(value));
+	}
+
+	/// Get a trigonometric function of a single number, as InnerTrig does		
+	///	@tparam STYLE - the trigonometric function									
+	///	@param value - the number															
+	///	@return the trigonometric value													
+	template<TrigStyle STYLE, class T>
+	NOD() LANGULUS(ALWAYSINLINE) T TrigFallback(const T& value) noexcept {
+		if constexpr (STYLE == TrigStyle::Sin)
+			return ::std::sin(value);
+		else if constexpr (STYLE == TrigStyle::Cos)
+			return ::std::cos(value);
+		else if constexpr (STYLE == TrigStyle::Tan)
+			return ::std::tan(value);
+		else if constexpr (STYLE == TrigStyle::ASin)
+			return ::std::asin(value);
+		else if constexpr (STYLE == TrigStyle::ACos)
+			return ::std::acos(value);
+		else if constexpr (STYLE == TrigStyle::ATan)
+			return ::std::atan(value);
+		else LANGULUS_ASSERT("Unsupported style for SIMD::TrigFallback");
+	}
+
+	/// Get a trigonometric function of a span of real numbers						
+	///	@tparam STYLE - the trigonometric function									
+	///	@param input - the numbers															
+	///	@param output - [out] the trigonometric values								
+	template<TrigStyle STYLE, CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void TrigSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerTrig<STYLE, T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return TrigFallback<STYLE>(v);
+			}
+		);
+	}
+
+	/// Get a trigonometric function of a span of real numbers in place			
+	///	@tparam STYLE - the trigonometric function									
+	///	@param data - [in/out] the numbers												
+	template<TrigStyle STYLE, CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void TrigSpan(DATA&& data) noexcept {
+		TrigSpan<STYLE>(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,102 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Fill.hpp"
+#include "Convert.hpp"
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) constexpr auto InnerTruncate(const CT::Inner::NotSupported&) noexcept {
+		return CT::Inner::NotSupported{};
+	}
+
+	/// Get truncated (rounded towards zero) values via SIMD							
+	///	@tparam T - the type of the array element										
+	///	@tparam S - the size of the array												
+	///	@tparam REGISTER - the register type (deducible)							
+	///	@param value - the array															
+	///	@return the truncated values														
+	template<class T, Count S, CT::TSIMD REGISTER>
+	LANGULUS(ALWAYSINLINE) auto InnerTruncate(const REGISTER& value) noexcept {
+		static_assert(CT::Real<T>,
+			"SIMD::InnerTruncate is suboptimal and pointless for whole numbers, avoid calling it on such");
+
+		#if LANGULUS_SIMD(128BIT)
+			if constexpr (CT::SIMD128<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTruncate of 16-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(256BIT)
+			if constexpr (CT::SIMD256<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm256_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTruncate of 32-byte package");
+			}
+			else
+		#endif
+
+		#if LANGULUS_SIMD(512BIT)
+			if constexpr (CT::SIMD512<REGISTER>) {
+				if constexpr (CT::RealSP<T>)
+					return simde_mm512_roundscale_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else if constexpr (CT::RealDP<T>)
+					return simde_mm512_roundscale_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+				else LANGULUS_ASSERT("Unsupported type for SIMD::InnerTruncate of 64-byte package");
+			}
+			else
+		#endif
+
+		LANGULUS_ASSERT("Unsupported type for SIMD::InnerTruncate");
+	}
+
+	template<class T, Count S>
+	LANGULUS(ALWAYSINLINE) auto Truncate(const T(&value)[S]) noexcept {
+		return InnerTruncate<T, S>(Load<0>(value));
+	}
+
+	/// Truncate a span of real numbers, writing the results to another span	
+	///	@param input - the numbers to truncate											
+	///	@param output - [out] the truncated numbers									
+	template<CT::Span IN, CT::Span OUT>
+	LANGULUS(ALWAYSINLINE) void TruncateSpan(IN&& input, OUT&& output) noexcept {
+		using T = SpanType<IN>;
+		static_assert(CT::Same<T, SpanType<OUT>>, "Output type must match input type");
+		StreamUnary<0>(
+			::std::ranges::data(input), ::std::ranges::data(output),
+			OverlapCount(input, output),
+			[](const MaxRegister<T>& v) noexcept {
+				return InnerTruncate<T, MaxLanes<T>>(v);
+			},
+			[](const T& v) noexcept -> T {
+				return ::std::trunc(v);
+			}
+		);
+	}
+
+	/// Truncate a span of real numbers in place											
+	///	@param data - [in/out] the numbers to truncate								
+	template<CT::Span DATA>
+	LANGULUS(ALWAYSINLINE) void TruncateSpan(DATA&& data) noexcept {
+		TruncateSpan(data, data);
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -0,0 +1,422 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#pragma once
+#include "Span.hpp"
+#include "IgnoreWarningsPush.inl"
+
+namespace Langulus::SIMD
+{
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Look up a byte in a 16-entry table, by the low nibble of each byte	
+		///	@param table - the table														
+		///	@param index - the indices, must be in the [0; 15] range				
+		///	@return the looked up bytes													
+		NOD() LANGULUS(ALWAYSINLINE) simde__m128i InnerUtf8Lookup(const ::std::uint8_t(&table)[16], const simde__m128i& index) noexcept {
+			return simde_mm_shuffle_epi8(simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(table)), index);
+		}
+
+		/// Find errors in a block of UTF-8, using the lookup table approach		
+		/// Each pair of consecutive bytes is classified by three nibble			
+		/// lookups, that intersect only for invalid pairs. Then third and		
+		/// fourth bytes of longer sequences are checked to be continuations		
+		///	@param input - the sixteen bytes to check									
+		///	@param previous - the sixteen bytes before input						
+		///	@return non-zero bytes where there are errors							
+		NOD() LANGULUS(ALWAYSINLINE) simde__m128i InnerUtf8Errors(const simde__m128i& input, const simde__m128i& previous) noexcept {
+			constexpr ::std::uint8_t TOO_SHORT = 1 << 0;
+			constexpr ::std::uint8_t TOO_LONG = 1 << 1;
+			constexpr ::std::uint8_t OVERLONG_3 = 1 << 2;
+			constexpr ::std::uint8_t TOO_LARGE = 1 << 3;
+			constexpr ::std::uint8_t SURROGATE = 1 << 4;
+			constexpr ::std::uint8_t OVERLONG_2 = 1 << 5;
+			constexpr ::std::uint8_t TOO_LARGE_1000 = 1 << 6;
+			constexpr ::std::uint8_t OVERLONG_4 = 1 << 6;
+			constexpr ::std::uint8_t TWO_CONTS = 1 << 7;
+			constexpr ::std::uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+			static constexpr ::std::uint8_t byte1High[16] {
+				// 0xxxxxxx - ASCII														
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+				// 10xxxxxx - continuation												
+				TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+				// 1100xxxx, 1101xxxx - two byte lead								
+				TOO_SHORT | OVERLONG_2,
+				TOO_SHORT,
+				// 1110xxxx - three byte lead											
+				TOO_SHORT | OVERLONG_3 | SURROGATE,
+				// 1111xxxx - four byte lead											
+				TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+			};
+
+			static constexpr ::std::uint8_t byte1Low[16] {
+				CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+				CARRY | OVERLONG_2,
+				CARRY,
+				CARRY,
+				CARRY | TOO_LARGE,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+				CARRY | TOO_LARGE | TOO_LARGE_1000,
+				CARRY | TOO_LARGE | TOO_LARGE_1000
+			};
+
+			static constexpr ::std::uint8_t byte2High[16] {
+				// xxxxxxxx 0xxxxxxx - ASCII											
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+				// xxxxxxxx 1000xxxx														
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+				// xxxxxxxx 1001xxxx														
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+				// xxxxxxxx 101xxxxx														
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+				// xxxxxxxx 11xxxxxx														
+				TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+			};
+
+			const auto nibble = simde_mm_set1_epi8(0x0F);
+			const auto prev1 = simde_mm_alignr_epi8(input, previous, 15);
+			const auto special = simde_mm_and_si128(simde_mm_and_si128(
+				InnerUtf8Lookup(byte1High, simde_mm_and_si128(simde_mm_srli_epi16(prev1, 4), nibble)),
+				InnerUtf8Lookup(byte1Low, simde_mm_and_si128(prev1, nibble))),
+				InnerUtf8Lookup(byte2High, simde_mm_and_si128(simde_mm_srli_epi16(input, 4), nibble))
+			);
+
+			// Only bytes after 111xxxxx and 1111xxxx leads get the high bit
+			const auto prev2 = simde_mm_alignr_epi8(input, previous, 14);
+			const auto prev3 = simde_mm_alignr_epi8(input, previous, 13);
+			const auto mustBeContinuation = simde_mm_and_si128(simde_mm_or_si128(
+				simde_mm_subs_epu8(prev2, simde_mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+				simde_mm_subs_epu8(prev3, simde_mm_set1_epi8(static_cast<char>(0xF0 - 0x80)))),
+				simde_mm_set1_epi8(static_cast<char>(0x80))
+			);
+			return simde_mm_xor_si128(mustBeContinuation, special);
+		}
+	#endif
+
+	/// Decode a single code point, validating it										
+	/// The encoding depends on the size of T - UTF-8, UTF-16 or UTF-32			
+	///	@param in - the first code unit													
+	///	@param available - number of code units available							
+	///	@param codePoint - [out] the decoded code point								
+	///	@return the number of code units consumed, or zero on error				
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) Count InnerUtfDecode(const T* in, Count available, char32_t& codePoint) noexcept {
+		if constexpr (sizeof(T) == 1) {
+			const auto continuation = [&](Count at) noexcept {
+				return at < available && (static_cast<::std::uint8_t>(in[at]) & 0xC0) == 0x80;
+			};
+			const auto bits = [&](Count at) noexcept {
+				return static_cast<char32_t>(static_cast<::std::uint8_t>(in[at]) & 0x3F);
+			};
+
+			const auto lead = static_cast<::std::uint8_t>(in[0]);
+			if (lead < 0x80) {
+				codePoint = lead;
+				return 1;
+			}
+			else if (lead >= 0xC2 && lead <= 0xDF) {
+				if (!continuation(1))
+					return 0;
+				codePoint = (static_cast<char32_t>(lead & 0x1F) << 6) | bits(1);
+				return 2;
+			}
+			else if (lead >= 0xE0 && lead <= 0xEF) {
+				if (!continuation(1) || !continuation(2))
+					return 0;
+				codePoint = (static_cast<char32_t>(lead & 0x0F) << 12) | (bits(1) << 6) | bits(2);
+				if (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+					return 0;
+				return 3;
+			}
+			else if (lead >= 0xF0 && lead <= 0xF4) {
+				if (!continuation(1) || !continuation(2) || !continuation(3))
+					return 0;
+				codePoint = (static_cast<char32_t>(lead & 0x07) << 18) | (bits(1) << 12) | (bits(2) << 6) | bits(3);
+				if (codePoint < 0x10000 || codePoint > 0x10FFFF)
+					return 0;
+				return 4;
+			}
+			return 0;
+		}
+		else if constexpr (sizeof(T) == 2) {
+			const auto unit = static_cast<char32_t>(static_cast<::std::uint16_t>(in[0]));
+			if (unit < 0xD800 || unit > 0xDFFF) {
+				codePoint = unit;
+				return 1;
+			}
+			if (unit > 0xDBFF || available < 2)
+				return 0;
+
+			const auto low = static_cast<char32_t>(static_cast<::std::uint16_t>(in[1]));
+			if (low < 0xDC00 || low > 0xDFFF)
+				return 0;
+			codePoint = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+			return 2;
+		}
+		else if constexpr (sizeof(T) == 4) {
+			codePoint = static_cast<char32_t>(in[0]);
+			if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+				return 0;
+			return 1;
+		}
+		else LANGULUS_ASSERT("Unsupported code unit for SIMD::InnerUtfDecode");
+	}
+
+	/// Encode a single valid code point													
+	/// The encoding depends on the size of T - UTF-8, UTF-16 or UTF-32			
+	///	@param codePoint - the code point to encode									
+	///	@param out - [out] the first code unit											
+	///	@param capacity - number of code units available							
+	///	@return the number of code units written, or zero if there's no room	
+	template<class T>
+	NOD() LANGULUS(ALWAYSINLINE) Count InnerUtfEncode(char32_t codePoint, T* out, Count capacity) noexcept {
+		if constexpr (sizeof(T) == 1) {
+			if (codePoint < 0x80) {
+				if (capacity < 1)
+					return 0;
+				out[0] = static_cast<T>(codePoint);
+				return 1;
+			}
+			else if (codePoint < 0x800) {
+				if (capacity < 2)
+					return 0;
+				out[0] = static_cast<T>(0xC0 | (codePoint >> 6));
+				out[1] = static_cast<T>(0x80 | (codePoint & 0x3F));
+				return 2;
+			}
+			else if (codePoint < 0x10000) {
+				if (capacity < 3)
+					return 0;
+				out[0] = static_cast<T>(0xE0 | (codePoint >> 12));
+				out[1] = static_cast<T>(0x80 | ((codePoint >> 6) & 0x3F));
+				out[2] = static_cast<T>(0x80 | (codePoint & 0x3F));
+				return 3;
+			}
+			else {
+				if (capacity < 4)
+					return 0;
+				out[0] = static_cast<T>(0xF0 | (codePoint >> 18));
+				out[1] = static_cast<T>(0x80 | ((codePoint >> 12) & 0x3F));
+				out[2] = static_cast<T>(0x80 | ((codePoint >> 6) & 0x3F));
+				out[3] = static_cast<T>(0x80 | (codePoint & 0x3F));
+				return 4;
+			}
+		}
+		else if constexpr (sizeof(T) == 2) {
+			if (codePoint < 0x10000) {
+				if (capacity < 1)
+					return 0;
+				out[0] = static_cast<T>(codePoint);
+				return 1;
+			}
+			if (capacity < 2)
+				return 0;
+			codePoint -= 0x10000;
+			out[0] = static_cast<T>(0xD800 + (codePoint >> 10));
+			out[1] = static_cast<T>(0xDC00 + (codePoint & 0x3FF));
+			return 2;
+		}
+		else if constexpr (sizeof(T) == 4) {
+			if (capacity < 1)
+				return 0;
+			out[0] = static_cast<T>(codePoint);
+			return 1;
+		}
+		else LANGULUS_ASSERT("Unsupported code unit for SIMD::InnerUtfEncode");
+	}
+
+	/// Check if a span of bytes is valid UTF-8											
+	/// Rejects overlong encodings, surrogates, code points above U+10FFFF,		
+	/// and sequences that are truncated at the end of the span						
+	///	@param text - the bytes to check													
+	///	@return true if text is valid UTF-8												
+	template<CT::Span TEXT>
+	NOD() LANGULUS(ALWAYSINLINE) bool ValidateUtf8(TEXT&& text) noexcept {
+		using T = SpanType<TEXT>;
+		static_assert(sizeof(T) == 1, "UTF-8 must be made of bytes");
+		const Count count = ::std::ranges::size(text);
+		const auto in = reinterpret_cast<const ::std::uint8_t*>(::std::ranges::data(text));
+
+		#if LANGULUS_SIMD(128BIT)
+			auto previous = simde_mm_setzero_si128();
+			auto errors = simde_mm_setzero_si128();
+			Count i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const auto input = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + i));
+				errors = simde_mm_or_si128(errors, InnerUtf8Errors(input, previous));
+				previous = input;
+			}
+
+			// The zero padding after the tail catches any sequence that is
+			// cut short at the end, even when there's no tail at all		
+			::std::uint8_t tail[16] {};
+			::std::memcpy(tail, in + i, count - i);
+			const auto input = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(tail));
+			errors = simde_mm_or_si128(errors, InnerUtf8Errors(input, previous));
+			if (count - i > 13) {
+				// The tail's own end can still be cut short						
+				errors = simde_mm_or_si128(errors, InnerUtf8Errors(simde_mm_setzero_si128(), input));
+			}
+			return simde_mm_movemask_epi8(simde_mm_cmpeq_epi8(errors, simde_mm_setzero_si128())) == 0xFFFF;
+		#else
+			for (Count i = 0; i < count;) {
+				char32_t codePoint;
+				const auto length = InnerUtfDecode(in + i, count - i, codePoint);
+				if (!length)
+					return false;
+				i += length;
+			}
+			return true;
+		#endif
+	}
+
+	#if LANGULUS_SIMD(128BIT)
+		/// Load sixteen code units, zero-extended to four 32-bit registers		
+		///	@param in - the first code unit												
+		///	@param units - [out] the loaded code units								
+		template<class T>
+		LANGULUS(ALWAYSINLINE) void InnerUtfLoad(const T* in, simde__m128i(&units)[4]) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				const auto bytes = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in));
+				units[0] = simde_mm_cvtepu8_epi32(bytes);
+				units[1] = simde_mm_cvtepu8_epi32(simde_mm_srli_si128(bytes, 4));
+				units[2] = simde_mm_cvtepu8_epi32(simde_mm_srli_si128(bytes, 8));
+				units[3] = simde_mm_cvtepu8_epi32(simde_mm_srli_si128(bytes, 12));
+			}
+			else if constexpr (sizeof(T) == 2) {
+				const auto lo = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in));
+				const auto hi = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + 8));
+				units[0] = simde_mm_cvtepu16_epi32(lo);
+				units[1] = simde_mm_cvtepu16_epi32(simde_mm_srli_si128(lo, 8));
+				units[2] = simde_mm_cvtepu16_epi32(hi);
+				units[3] = simde_mm_cvtepu16_epi32(simde_mm_srli_si128(hi, 8));
+			}
+			else {
+				for (Count r = 0; r < 4; ++r)
+					units[r] = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i*>(in + r * 4));
+			}
+		}
+
+		/// Store sixteen code units from four 32-bit registers, narrowing		
+		/// them if needed. All units must fit in T										
+		///	@param units - the code units													
+		///	@param out - [out] the first code unit										
+		template<class T>
+		LANGULUS(ALWAYSINLINE) void InnerUtfStore(const simde__m128i(&units)[4], T* out) noexcept {
+			if constexpr (sizeof(T) == 1) {
+				const auto bytes = simde_mm_packus_epi16(
+					simde_mm_packus_epi32(units[0], units[1]),
+					simde_mm_packus_epi32(units[2], units[3])
+				);
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out), bytes);
+			}
+			else if constexpr (sizeof(T) == 2) {
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out), simde_mm_packus_epi32(units[0], units[1]));
+				simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + 8), simde_mm_packus_epi32(units[2], units[3]));
+			}
+			else {
+				for (Count r = 0; r < 4; ++r)
+					simde_mm_storeu_si128(reinterpret_cast<simde__m128i*>(out + r * 4), units[r]);
+			}
+		}
+	#endif
+
+	/// Convert text between UTF-8, UTF-16 and UTF-32									
+	/// The encodings are picked by the sizes of the code units, so char and	
+	/// char8_t are UTF-8, char16_t is UTF-16, char32_t is UTF-32, and			
+	/// wchar_t is whatever its size on the platform is								
+	/// Runs of sixteen code units, that map one-to-one between the two			
+	/// encodings (ASCII, or anything but surrogates between UTF-16 and UTF-32)
+	/// are converted in registers, everything else is done one code point at	
+	/// a time. Conversion stops at the last whole code point that fits output	
+	///	@param input - the text to convert												
+	///	@param output - [out] the converted text										
+	///	@return the number of code units written to output							
+	template<CT::Span IN, CT::Span OUT>
+	NOD() LANGULUS(ALWAYSINLINE) Count Transcode(IN&& input, OUT&& output) {
+		using FROM = SpanType<IN>;
+		using TO = SpanType<OUT>;
+		static_assert(sizeof(FROM) == 1 || sizeof(FROM) == 2 || sizeof(FROM) == 4, "Unsupported input code unit");
+		static_assert(sizeof(TO) == 1 || sizeof(TO) == 2 || sizeof(TO) == 4, "Unsupported output code unit");
+
+		const Count count = ::std::ranges::size(input);
+		const Count capacity = ::std::ranges::size(output);
+		const FROM* in = ::std::ranges::data(input);
+		TO* out = ::std::ranges::data(output);
+		Count i = 0, written = 0;
+
+		while (i < count) {
+			Count blockEnd = count;
+
+			#if LANGULUS_SIMD(128BIT)
+				if (i + 16 <= count && written + 16 <= capacity) {
+					simde__m128i units[4];
+					InnerUtfLoad(in + i, units);
+
+					// Check if all units map one-to-one in both encodings	
+					auto ok = simde_mm_set1_epi32(-1);
+					if constexpr (sizeof(FROM) == 1 || sizeof(TO) == 1) {
+						const auto limit = simde_mm_set1_epi32(0x7F);
+						for (auto& u : units)
+							ok = simde_mm_and_si128(ok, simde_mm_cmpeq_epi32(simde_mm_max_epu32(u, limit), limit));
+					}
+					else {
+						const auto limit = simde_mm_set1_epi32(0xFFFF);
+						const auto surrogateMask = simde_mm_set1_epi32(0xF800);
+						const auto surrogate = simde_mm_set1_epi32(0xD800);
+						for (auto& u : units) {
+							ok = simde_mm_and_si128(ok, simde_mm_cmpeq_epi32(simde_mm_max_epu32(u, limit), limit));
+							ok = simde_mm_andnot_si128(simde_mm_cmpeq_epi32(simde_mm_and_si128(u, surrogateMask), surrogate), ok);
+						}
+					}
+
+					if (simde_mm_movemask_epi8(ok) == 0xFFFF) {
+						InnerUtfStore(units, out + written);
+						i += 16;
+						written += 16;
+						continue;
+					}
+
+					// Do the rest of the block the old way, then try again	
+					blockEnd = i + 16;
+				}
+			#endif
+
+			// Do the rest the old way													
+			while (i < blockEnd) {
+				char32_t codePoint;
+				const auto consumed = InnerUtfDecode(in + i, count - i, codePoint);
+				if (!consumed)
+					Throw<Except::Encoding>();
+
+				const auto produced = InnerUtfEncode(codePoint, out + written, capacity - written);
+				if (!produced)
+					return written;
+
+				i += consumed;
+				written += produced;
+			}
+		}
+
+		return written;
+	}
+
+} // namespace Langulus::SIMD
+
+#include "IgnoreWarningsPop.inl"
@@ -7,30 +7,64 @@
 ///																									
 #pragma once
 #include "../Abs.hpp"
+#include "../AbsDiff.hpp"
 #include "../Add.hpp"
+#include "../Average.hpp"
+#include "../Base64.hpp"
+#include "../ByteSwap.hpp"
 #include "../Ceil.hpp"
 #include "../Ceil.hpp"
+#include "../Checksum.hpp"
+#include "../Color.hpp"
+#include "../Compress.hpp"
 #include "../Convert.hpp"
+#include "../ConvertHalf.hpp"
+#include "../ConvertSpan.hpp"
+#include "../CopySign.hpp"
+#include "../Cross.hpp"
 #include "../Divide.hpp"
+#include "../Dot.hpp"
 #include "../Equals.hpp"
 #include "../EqualsOrGreater.hpp"
 #include "../EqualsOrLower.hpp"
 #include "../Fill.hpp"
+#include "../Find.hpp"
+#include "../Fixed.hpp"
 #include "../Floor.hpp"
+#include "../Fract.hpp"
 #include "../Greater.hpp"
+#include "../Hash.hpp"
+#include "../Hex.hpp"
+#include "../Interleave.hpp"
 #include "../Intrinsics.hpp"
+#include "../Length.hpp"
 #include "../Lesser.hpp"
 #include "../Load.hpp"
 #include "../Log.hpp"
+#include "../Matrix.hpp"
 #include "../Max.hpp"
 #include "../Min.hpp"
+#include "../Mod.hpp"
 #include "../MoreSIMD.hpp"
 #include "../Multiply.hpp"
+#include "../MultiplyHigh.hpp"
+#include "../Normalize.hpp"
+#include "../Pixel.hpp"
 #include "../Pow.hpp"
+#include "../Quaternion.hpp"
+#include "../Random.hpp"
 #include "../Round.hpp"
+#include "../Scan.hpp"
 #include "../SetGet.hpp"
 #include "../ShiftLeft.hpp"
 #include "../ShiftRight.hpp"
+#include "../Sign.hpp"
+#include "../Span.hpp"
+#include "../Sqrt.hpp"
 #include "../Store.hpp"
 #include "../Subtract.hpp"
+#include "../Text.hpp"
+#include "../Trigonometry.hpp"
+#include "../Truncate.hpp"
+#include "../Utf.hpp"
 #include "../XOr.hpp"
@@ -26,6 +26,12 @@ using uint = unsigned int;
 template<class T>
 using some = std::vector<T>;
 
+/// The least a type needs to be a CT::Vector, for testing the Wrap functions
+template<class T, Count C>
+struct Components {
+	T mComponents[C];
+};
+
 template<class T, class A>
 void InitOne(T& a, A&& b) noexcept {
 	if constexpr (CT::Sparse<T>) {
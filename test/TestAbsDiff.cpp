@@ -0,0 +1,169 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <limits>
+#include <random>
+
+/// Make random numbers across the whole range of a type, with the extremes	
+/// at the start, where overflow is most likely											
+template<class T>
+some<T> RandomRange(Count count, unsigned seed) {
+	std::mt19937_64 generator {seed};
+	some<T> numbers(count);
+	for (auto& n : numbers) {
+		if constexpr (CT::Real<T>)
+			n = static_cast<T>(std::uniform_real_distribution<double> {-1000.0, 1000.0}(generator));
+		else
+			n = static_cast<T>(generator());
+	}
+
+	using L = std::numeric_limits<T>;
+	const T edges[] {L::lowest(), L::max(), T {0}, L::max(), L::lowest()};
+	for (Count i = 0; i < count && i < 5; ++i)
+		numbers[i] = edges[(i + seed) % 5];
+	return numbers;
+}
+
+/// The absolute difference, computed with wrap around, like SIMD does			
+template<class T>
+T ExpectedAbsDiff(T a, T b) {
+	if constexpr (CT::Real<T>)
+		return a > b ? a - b : b - a;
+	else {
+		using U = std::make_unsigned_t<T>;
+		return static_cast<T>(a > b
+			? static_cast<U>(static_cast<U>(a) - static_cast<U>(b))
+			: static_cast<U>(static_cast<U>(b) - static_cast<U>(a)));
+	}
+}
+
+TEMPLATE_TEST_CASE("AbsDiff", "[SIMD]",
+	::std::int8_t, ::std::int16_t, ::std::int32_t, ::std::int64_t,
+	::std::uint8_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t, float, double
+) {
+	using T = TestType;
+
+	for (Count count : {Count {5}, Count {64}, Count {77}}) {
+		GIVEN("Two spans of " << count << " random numbers") {
+			const auto lhs = RandomRange<T>(count, 1);
+			const auto rhs = RandomRange<T>(count, 2);
+			some<T> output(count);
+
+			WHEN("Their absolute differences are taken") {
+				SIMD::AbsDiffSpan(lhs, rhs, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == ExpectedAbsDiff(lhs[i], rhs[i]));
+				}
+			}
+		}
+	}
+
+	GIVEN("Two arrays and a scalar") {
+		const auto numbers = RandomRange<T>(8, 3);
+		T x[4], y[4], r[4];
+		for (Count i = 0; i < 4; ++i) {
+			x[i] = numbers[i];
+			y[i] = numbers[i + 4];
+		}
+
+		WHEN("Their absolute differences are taken") {
+			SIMD::AbsDiff(x, y, r);
+
+			THEN("The results should be correct") {
+				for (Count i = 0; i < 4; ++i)
+					REQUIRE(r[i] == ExpectedAbsDiff(x[i], y[i]));
+			}
+		}
+
+		WHEN("The absolute difference to a scalar is taken") {
+			SIMD::AbsDiff(x, y[0], r);
+
+			THEN("The results should be correct") {
+				for (Count i = 0; i < 4; ++i)
+					REQUIRE(r[i] == ExpectedAbsDiff(x[i], y[0]));
+			}
+		}
+
+		WHEN("The absolute differences are wrapped in a vector") {
+			const auto v = SIMD::AbsDiffWrap<Components<T, 4>>(x, y);
+
+			THEN("The results should be correct") {
+				for (Count i = 0; i < 4; ++i)
+					REQUIRE(v.mComponents[i] == ExpectedAbsDiff(x[i], y[i]));
+			}
+		}
+	}
+}
+
+TEST_CASE("SumAbsDiff", "[SIMD]") {
+	for (Count count : {Count {0}, Count {15}, Count {64}, Count {1000}}) {
+		GIVEN("Two spans of " << count << " random bytes") {
+			const auto lhs = RandomRange<std::uint8_t>(count, 4);
+			const auto rhs = RandomRange<std::uint8_t>(count, 5);
+
+			THEN("The sum should match the scalar one") {
+				std::uint64_t expected = 0;
+				for (Count i = 0; i < count; ++i)
+					expected += lhs[i] > rhs[i] ? lhs[i] - rhs[i] : rhs[i] - lhs[i];
+				REQUIRE(SIMD::SumAbsDiff(lhs, rhs) == expected);
+			}
+		}
+	}
+
+	GIVEN("Two images, and a block inside each") {
+		constexpr Count lhsStride = 67, rhsStride = 101;
+		constexpr Count width = 37, height = 9;
+		const auto lhs = RandomRange<std::uint8_t>(lhsStride * 20, 6);
+		const auto rhs = RandomRange<std::uint8_t>(rhsStride * 20, 7);
+
+		THEN("The sum should only cover the blocks") {
+			std::uint64_t expected = 0;
+			for (Count y = 0; y < height; ++y) {
+				for (Count x = 0; x < width; ++x) {
+					const int a = lhs[y * lhsStride + x];
+					const int b = rhs[y * rhsStride + x];
+					expected += static_cast<std::uint64_t>(std::abs(a - b));
+				}
+			}
+			REQUIRE(SIMD::SumAbsDiff(lhs, rhs, width, height, lhsStride, rhsStride) == expected);
+		}
+
+		THEN("Rows that don't fit should be skipped") {
+			std::uint64_t expected = 0;
+			for (Count y = 0; y < 20; ++y) {
+				for (Count x = 0; x < width; ++x) {
+					const int a = lhs[y * lhsStride + x];
+					const int b = rhs[y * rhsStride + x];
+					expected += static_cast<std::uint64_t>(std::abs(a - b));
+				}
+			}
+			REQUIRE(SIMD::SumAbsDiff(lhs, rhs, width, 100, lhsStride, rhsStride) == expected);
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("Two 1920x1080 luma planes") {
+			const auto lhs = RandomRange<std::uint8_t>(1920 * 1080, 4);
+			const auto rhs = RandomRange<std::uint8_t>(1920 * 1080, 5);
+
+			BENCHMARK("SumAbsDiff (control)") {
+				std::uint64_t sum = 0;
+				for (Count i = 0; i < lhs.size(); ++i)
+					sum += lhs[i] > rhs[i] ? lhs[i] - rhs[i] : rhs[i] - lhs[i];
+				return sum;
+			};
+
+			BENCHMARK("SumAbsDiff (SIMD)") {
+				return SIMD::SumAbsDiff(lhs, rhs);
+			};
+		}
+	#endif
+}
@@ -0,0 +1,127 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <random>
+#include <string>
+
+/// Reference base64 encoder, one bit at a time											
+std::string ReferenceBase64(const some<std::uint8_t>& bytes) {
+	static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::string result;
+	unsigned bits = 0, buffer = 0;
+	for (auto byte : bytes) {
+		buffer = (buffer << 8) | byte;
+		bits += 8;
+		while (bits >= 6) {
+			bits -= 6;
+			result += alphabet[(buffer >> bits) & 0x3F];
+		}
+	}
+
+	if (bits)
+		result += alphabet[(buffer << (6 - bits)) & 0x3F];
+	while (result.size() % 4)
+		result += '=';
+	return result;
+}
+
+TEST_CASE("Base64 encoding and decoding", "[SIMD]") {
+	std::mt19937 rng(777);
+	std::uniform_int_distribution<unsigned> byte(0, 255);
+
+	// Sizes around every register width, so that tails always get tested
+	for (Count count : {Count {0}, Count {1}, Count {2}, Count {3}, Count {11}, Count {12}, Count {13}, Count {47}, Count {48}, Count {100}, Count {1001}}) {
+		GIVEN(count << " random bytes") {
+			some<std::uint8_t> bytes(count);
+			for (auto& b : bytes)
+				b = static_cast<std::uint8_t>(byte(rng));
+			const auto expected = ReferenceBase64(bytes);
+
+			WHEN("Encoded") {
+				std::string text(SIMD::Base64EncodedSize(count), '\0');
+				const auto written = SIMD::Base64Encode(bytes, text);
+
+				THEN("The text should match the reference") {
+					REQUIRE(written == text.size());
+					REQUIRE(text == expected);
+				}
+			}
+
+			WHEN("Decoded back") {
+				some<std::uint8_t> decoded(SIMD::Base64DecodedSize(expected));
+				const auto written = SIMD::Base64Decode(expected, decoded);
+
+				THEN("The bytes should match the original") {
+					REQUIRE(written == count);
+					REQUIRE(decoded == bytes);
+				}
+			}
+
+			WHEN("Encoded into a smaller output") {
+				std::string text(expected.size() / 2 + 1, '\0');
+				const auto written = SIMD::Base64Encode(bytes, text);
+
+				THEN("Only whole groups of four characters should be written") {
+					REQUIRE(written % 4 == 0);
+					REQUIRE(written + 4 > text.size());
+					REQUIRE(text.substr(0, written) == expected.substr(0, written));
+				}
+			}
+
+			WHEN("A character outside of the alphabet is placed anywhere") {
+				THEN("Decoding should throw") {
+					for (unsigned c = 0; c < 256 && count; ++c) {
+						if (SIMD::Base64Values[c] >= 0)
+							continue;
+
+						auto corrupted = expected;
+						std::uniform_int_distribution<Count> at(0, corrupted.size() - 4);
+						corrupted[at(rng)] = static_cast<char>(c);
+						some<std::uint8_t> decoded(count + 64);
+						REQUIRE_THROWS_AS(SIMD::Base64Decode(corrupted, decoded), Except::Encoding);
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("Malformed texts") {
+		some<std::uint8_t> decoded(64);
+
+		THEN("Decoding should throw") {
+			REQUIRE_THROWS_AS(SIMD::Base64Decode(std::string("QUJDRA"), decoded), Except::Encoding);
+			REQUIRE_THROWS_AS(SIMD::Base64Decode(std::string("QQ==QUJD"), decoded), Except::Encoding);
+			REQUIRE_THROWS_AS(SIMD::Base64Decode(std::string("Q==="), decoded), Except::Encoding);
+			REQUIRE_THROWS_AS(SIMD::Base64Decode(std::string("QU=D"), decoded), Except::Encoding);
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("64 KiB of bytes") {
+			some<std::uint8_t> bytes(1 << 16);
+			for (Count i = 0; i < bytes.size(); ++i)
+				bytes[i] = static_cast<std::uint8_t>(i * 7);
+			std::string text(SIMD::Base64EncodedSize(bytes.size()), '\0');
+			some<std::uint8_t> decoded(bytes.size());
+			REQUIRE(SIMD::Base64Encode(bytes, text) == text.size());
+
+			BENCHMARK("Base64Encode (control)") {
+				return ReferenceBase64(bytes);
+			};
+
+			BENCHMARK("Base64Encode (SIMD)") {
+				return SIMD::Base64Encode(bytes, text);
+			};
+
+			BENCHMARK("Base64Decode (SIMD)") {
+				return SIMD::Base64Decode(text, decoded);
+			};
+		}
+	#endif
+}
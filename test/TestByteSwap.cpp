@@ -0,0 +1,89 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+/// Reverse the bytes of a number through its object representation				
+template<class T>
+T ReferenceByteSwap(T value) {
+	unsigned char bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+	std::reverse(bytes, bytes + sizeof(T));
+	std::memcpy(&value, bytes, sizeof(T));
+	return value;
+}
+
+TEMPLATE_TEST_CASE("ByteSwap", "[SIMD]", ::std::int16_t, ::std::int32_t, ::std::int64_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {9}, Count {64}, Count {131}}) {
+		GIVEN("A span of " << count << " numbers with distinct bytes") {
+			some<T> input(count);
+			for (Count i = 0; i < count; ++i) {
+				unsigned char bytes[sizeof(T)];
+				for (Count b = 0; b < sizeof(T); ++b)
+					bytes[b] = static_cast<unsigned char>(i * 17 + b * 41 + 3);
+				std::memcpy(&input[i], bytes, sizeof(T));
+			}
+
+			WHEN("The byte order is reversed") {
+				some<T> output(count);
+				SIMD::ByteSwapSpan(input, output);
+
+				THEN("Each number should have its bytes reversed") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == ReferenceByteSwap(input[i]));
+				}
+			}
+
+			WHEN("The byte order is reversed twice in place") {
+				auto data = input;
+				SIMD::ByteSwapSpan(data);
+				SIMD::ByteSwapSpan(data);
+
+				THEN("The numbers should be restored") {
+					REQUIRE(data == input);
+				}
+			}
+		}
+	}
+
+	GIVEN("An array of numbers") {
+		const T input[4] {T(0x0102), T(0x7F00), T(0x00FF), T(0x1234)};
+		T output[4];
+
+		WHEN("The byte order is reversed") {
+			SIMD::ByteSwap(input, output);
+
+			THEN("Each number should have its bytes reversed") {
+				for (Count i = 0; i < 4; ++i)
+					REQUIRE(output[i] == ReferenceByteSwap(input[i]));
+			}
+		}
+	}
+
+	GIVEN("An array bigger than any register") {
+		constexpr Count S = 128 / sizeof(T);
+		T input[S];
+		for (Count i = 0; i < S; ++i)
+			input[i] = static_cast<T>(i * 0x0123456789ABCDEFull);
+
+		WHEN("The byte order is reversed") {
+			const ::std::array<T, S> output = SIMD::ByteSwap(input);
+
+			THEN("It should be done the old way, and each number should have its bytes reversed") {
+				for (Count i = 0; i < S; ++i)
+					REQUIRE(output[i] == ReferenceByteSwap(input[i]));
+			}
+		}
+	}
+}
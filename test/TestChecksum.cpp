@@ -0,0 +1,110 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <string_view>
+
+/// Reference CRC32C, one bit at a time													
+std::uint32_t ReferenceCrc32c(const std::uint8_t* bytes, Count count) {
+	std::uint32_t crc = ~0u;
+	for (Count i = 0; i < count; ++i) {
+		crc ^= bytes[i];
+		for (int bit = 0; bit < 8; ++bit)
+			crc = crc & 1 ? (crc >> 1) ^ 0x82F63B78u : crc >> 1;
+	}
+	return ~crc;
+}
+
+/// Reference Adler-32 and Fletcher-16, with modulo after every byte				
+std::uint32_t ReferenceAdler32(const std::uint8_t* bytes, Count count) {
+	std::uint32_t s1 = 1, s2 = 0;
+	for (Count i = 0; i < count; ++i) {
+		s1 = (s1 + bytes[i]) % 65521;
+		s2 = (s2 + s1) % 65521;
+	}
+	return (s2 << 16) | s1;
+}
+
+std::uint16_t ReferenceFletcher16(const std::uint8_t* bytes, Count count) {
+	std::uint32_t s1 = 0, s2 = 0;
+	for (Count i = 0; i < count; ++i) {
+		s1 = (s1 + bytes[i]) % 255;
+		s2 = (s2 + s1) % 255;
+	}
+	return static_cast<std::uint16_t>((s2 << 8) | s1);
+}
+
+TEST_CASE("Checksums", "[SIMD]") {
+	GIVEN("Well known check strings") {
+		THEN("The checksums should match the published values") {
+			REQUIRE(SIMD::Crc32c(std::string_view {"123456789"}) == 0xE3069283u);
+			REQUIRE(SIMD::Adler32(std::string_view {"Wikipedia"}) == 0x11E60398u);
+			REQUIRE(SIMD::Fletcher16(std::string_view {"abcde"}) == 0xC8F0u);
+			REQUIRE(SIMD::Fletcher16(std::string_view {"abcdef"}) == 0x2057u);
+			REQUIRE(SIMD::Crc32c(std::string_view {}) == 0u);
+			REQUIRE(SIMD::Adler32(std::string_view {}) == 1u);
+		}
+	}
+
+	// Sizes that cover the short and long interleaved CRC blocks, as well as
+	// the Adler chunks. Saturated bytes stress the overflow bounds		
+	for (Count count : {Count {1}, Count {15}, Count {33}, Count {767}, Count {768}, Count {5000}, Count {6000}, Count {30000}}) {
+		for (bool saturated : {false, true}) {
+			GIVEN(count << (saturated ? " saturated bytes" : " patterned bytes")) {
+				some<std::uint8_t> buffer(count + 8);
+				for (Count i = 0; i < buffer.size(); ++i)
+					buffer[i] = saturated ? 0xFF : static_cast<std::uint8_t>(i * 31 + (i >> 7));
+
+				WHEN("Checksums are computed at every misalignment") {
+					for (Count start = 0; start < 8; ++start) {
+						const std::span<const std::uint8_t> bytes {buffer.data() + start, count};
+						REQUIRE(SIMD::Crc32c(bytes) == ReferenceCrc32c(bytes.data(), count));
+						REQUIRE(SIMD::Adler32(bytes) == ReferenceAdler32(bytes.data(), count));
+						REQUIRE(SIMD::Fletcher16(bytes) == ReferenceFletcher16(bytes.data(), count));
+					}
+				}
+
+				WHEN("Checksums are chained over two halves") {
+					const std::span<const std::uint8_t> bytes {buffer.data(), count};
+					const auto first = bytes.first(count / 3);
+					const auto second = bytes.subspan(count / 3);
+
+					THEN("They should match the checksums of the whole") {
+						REQUIRE(SIMD::Crc32c(second, SIMD::Crc32c(first)) == SIMD::Crc32c(bytes));
+						REQUIRE(SIMD::Adler32(second, SIMD::Adler32(first)) == SIMD::Adler32(bytes));
+						REQUIRE(SIMD::Fletcher16(second, SIMD::Fletcher16(first)) == SIMD::Fletcher16(bytes));
+					}
+				}
+			}
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("1 MiB of bytes") {
+			some<std::uint8_t> bytes(1 << 20);
+			for (Count i = 0; i < bytes.size(); ++i)
+				bytes[i] = static_cast<std::uint8_t>(i * 7);
+
+			BENCHMARK("Crc32c (control)") {
+				return ReferenceCrc32c(bytes.data(), bytes.size());
+			};
+
+			BENCHMARK("Crc32c (SIMD)") {
+				return SIMD::Crc32c(bytes);
+			};
+
+			BENCHMARK("Adler32 (control)") {
+				return ReferenceAdler32(bytes.data(), bytes.size());
+			};
+
+			BENCHMARK("Adler32 (SIMD)") {
+				return SIMD::Adler32(bytes);
+			};
+		}
+	#endif
+}
@@ -0,0 +1,284 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <random>
+
+/// Make random bytes																			
+some<std::uint8_t> RandomBytes(Count count, unsigned seed) {
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<unsigned> distribution {0, 255};
+	some<std::uint8_t> bytes(count);
+	for (auto& b : bytes)
+		b = static_cast<std::uint8_t>(distribution(generator));
+	return bytes;
+}
+
+/// Get a channel of a pixel																	
+constexpr int ColorChannel(SIMD::Pixel px, int c) {
+	return (px >> (c * 8)) & 0xFF;
+}
+
+/// Clamp an integer to a byte																
+constexpr int ClampByte(int x) {
+	return x < 0 ? 0 : x > 255 ? 255 : x;
+}
+
+/// Decode one sample, straight from the Q12 BT.601 coefficients					
+constexpr SIMD::Pixel DecodeBT601(int y, int u, int v) {
+	const int l = (y - 16) * 4769 + 2048;
+	const int r = ClampByte((l + (v - 128) * 6537) >> 12);
+	const int g = ClampByte((l - (u - 128) * 1605 - (v - 128) * 3330) >> 12);
+	const int b = ClampByte((l + (u - 128) * 8263) >> 12);
+	return r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
+
+/// Encode one sample, straight from the Q7 BT.601 coefficients					
+constexpr int EncodeBT601(int r, int g, int b, int c) {
+	switch (c) {
+	case 0:  return ClampByte((33 * r + 64 * g + 13 * b + (16 << 7) + 64) >> 7);
+	case 1:  return ClampByte((-19 * r - 37 * g + 56 * b + (128 << 7) + 64) >> 7);
+	default: return ClampByte((56 * r - 47 * g - 9 * b + (128 << 7) + 64) >> 7);
+	}
+}
+
+/// Average a 2x2 block of pixels, rows first, rounding up							
+int AverageBlock(const some<SIMD::Pixel>& px, Count w, Count h, Count x, Count y, int c) {
+	const Count x1 = x + 1 < w ? x + 1 : x;
+	const Count y1 = y + 1 < h ? y + 1 : y;
+	const auto avg = [](int a, int b) { return (a + b + 1) >> 1; };
+	return avg(
+		avg(ColorChannel(px[y * w + x], c), ColorChannel(px[y1 * w + x], c)),
+		avg(ColorChannel(px[y * w + x1], c), ColorChannel(px[y1 * w + x1], c)));
+}
+
+TEST_CASE("YCbCr conversions", "[SIMD]") {
+	// Odd sizes, so that tails and edges always get tested					
+	for (Count width : {Count {1}, Count {7}, Count {24}, Count {37}}) {
+		for (Count height : {Count {1}, Count {4}, Count {5}}) {
+			const Count cw = (width + 1) / 2;
+			const Count ch = (height + 1) / 2;
+
+			GIVEN("A random " << width << "x" << height << " frame in NV12 and I420") {
+				const auto luma = RandomBytes(width * height, 3);
+				const auto cb = RandomBytes(cw * ch, 5);
+				const auto cr = RandomBytes(cw * ch, 7);
+				some<std::uint8_t> chroma(cw * ch * 2);
+				for (Count i = 0; i < cw * ch; ++i) {
+					chroma[i * 2] = cb[i];
+					chroma[i * 2 + 1] = cr[i];
+				}
+
+				WHEN("Converted to RGBA") {
+					some<SIMD::Pixel> nv12(width * height);
+					some<SIMD::Pixel> i420(width * height);
+					REQUIRE(SIMD::NV12ToRGBA(luma, chroma, width, height, nv12) == height);
+					REQUIRE(SIMD::I420ToRGBA(luma, cb, cr, width, height, i420) == height);
+
+					THEN("Each chroma sample should cover a 2x2 block") {
+						for (Count y = 0; y < height; ++y) {
+							for (Count x = 0; x < width; ++x) {
+								const Count c = (y / 2) * cw + x / 2;
+								const auto expected = DecodeBT601(luma[y * width + x], cb[c], cr[c]);
+								REQUIRE(nv12[y * width + x] == expected);
+								REQUIRE(i420[y * width + x] == expected);
+							}
+						}
+					}
+				}
+
+				WHEN("Converted to RGBA with a short output") {
+					some<SIMD::Pixel> output(width * height - 1);
+
+					THEN("Only the rows that fit should be converted") {
+						REQUIRE(SIMD::NV12ToRGBA(luma, chroma, width, height, output) == height - 1);
+					}
+				}
+			}
+
+			GIVEN("A random " << width << "x" << height << " RGBA frame") {
+				std::mt19937 generator {11};
+				std::uniform_int_distribution<std::uint32_t> distribution;
+				some<SIMD::Pixel> pixels(width * height);
+				for (auto& px : pixels)
+					px = distribution(generator);
+
+				WHEN("Converted to NV12 and I420") {
+					some<std::uint8_t> luma1(width * height), luma2(width * height);
+					some<std::uint8_t> chroma(cw * ch * 2), cb(cw * ch), cr(cw * ch);
+					REQUIRE(SIMD::RGBAToNV12(pixels, width, height, luma1, chroma) == height);
+					REQUIRE(SIMD::RGBAToI420(pixels, width, height, luma2, cb, cr) == height);
+
+					THEN("Luma should be per pixel, and chroma per 2x2 block") {
+						for (Count i = 0; i < width * height; ++i) {
+							const auto px = pixels[i];
+							const int y = EncodeBT601(ColorChannel(px, 0), ColorChannel(px, 1), ColorChannel(px, 2), 0);
+							REQUIRE(luma1[i] == y);
+							REQUIRE(luma2[i] == y);
+						}
+
+						for (Count y = 0; y < ch; ++y) {
+							for (Count x = 0; x < cw; ++x) {
+								const int r = AverageBlock(pixels, width, height, x * 2, y * 2, 0);
+								const int g = AverageBlock(pixels, width, height, x * 2, y * 2, 1);
+								const int b = AverageBlock(pixels, width, height, x * 2, y * 2, 2);
+								REQUIRE(chroma[(y * cw + x) * 2] == EncodeBT601(r, g, b, 1));
+								REQUIRE(chroma[(y * cw + x) * 2 + 1] == EncodeBT601(r, g, b, 2));
+								REQUIRE(cb[y * cw + x] == EncodeBT601(r, g, b, 1));
+								REQUIRE(cr[y * cw + x] == EncodeBT601(r, g, b, 2));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("Pure colors") {
+		// Black, white, red, green and blue, four pixels each					
+		const SIMD::Pixel colors[] {0xFF000000u, 0xFFFFFFFFu, 0xFF0000FFu, 0xFF00FF00u, 0xFFFF0000u};
+		some<SIMD::Pixel> pixels(20 * 2);
+		for (Count i = 0; i < pixels.size(); ++i)
+			pixels[i] = colors[(i % 20) / 4];
+
+		WHEN("Converted to NV12 and back, with both matrices") {
+			some<std::uint8_t> luma601(20 * 2), chroma601(20), luma709(20 * 2), chroma709(20);
+			some<SIMD::Pixel> back601(20 * 2), back709(20 * 2);
+			SIMD::RGBAToNV12<SIMD::ColorMatrix::BT601>(pixels, 20, 2, luma601, chroma601);
+			SIMD::NV12ToRGBA<SIMD::ColorMatrix::BT601>(luma601, chroma601, 20, 2, back601);
+			SIMD::RGBAToNV12<SIMD::ColorMatrix::BT709>(pixels, 20, 2, luma709, chroma709);
+			SIMD::NV12ToRGBA<SIMD::ColorMatrix::BT709>(luma709, chroma709, 20, 2, back709);
+
+			THEN("Black and white should span the video range, and colors should round trip") {
+				for (auto* luma : {&luma601, &luma709}) {
+					REQUIRE((*luma)[0] == 16);
+					REQUIRE((*luma)[4] == 235);
+				}
+
+				for (auto* chroma : {&chroma601, &chroma709}) {
+					REQUIRE((*chroma)[0] == 128);
+					REQUIRE((*chroma)[1] == 128);
+					REQUIRE((*chroma)[4] == 128);
+					REQUIRE((*chroma)[5] == 128);
+					REQUIRE((*chroma)[9] == 240);
+					REQUIRE((*chroma)[16] == 240);
+				}
+
+				// Rounded luma of the primaries, as given by the standards	
+				// Q7 coefficients can't hit all of them exactly					
+				REQUIRE(std::abs(luma601[8] - 81) <= 1);
+				REQUIRE(std::abs(luma601[12] - 145) <= 1);
+				REQUIRE(std::abs(luma601[16] - 41) <= 1);
+				REQUIRE(std::abs(luma709[8] - 63) <= 1);
+				REQUIRE(std::abs(luma709[12] - 173) <= 1);
+				REQUIRE(std::abs(luma709[16] - 32) <= 1);
+
+				for (Count i = 0; i < pixels.size(); ++i) {
+					for (int c = 0; c < 4; ++c) {
+						REQUIRE(std::abs(ColorChannel(back601[i], c) - ColorChannel(pixels[i], c)) <= 3);
+						REQUIRE(std::abs(ColorChannel(back709[i], c) - ColorChannel(pixels[i], c)) <= 3);
+					}
+				}
+			}
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		for (auto [width, height] : {std::pair<Count, Count> {1920, 1080}, std::pair<Count, Count> {3840, 2160}}) {
+			GIVEN("A " << width << "x" << height << " NV12 frame") {
+				const auto luma = RandomBytes(width * height, 3);
+				const auto chroma = RandomBytes(width * height / 2, 5);
+				some<SIMD::Pixel> output(width * height);
+
+				BENCHMARK("NV12 to RGBA (control)") {
+					for (Count y = 0; y < height; ++y) {
+						for (Count x = 0; x < width; ++x) {
+							const Count c = (y / 2) * width + (x / 2) * 2;
+							output[y * width + x] = SIMD::YUVToRGBAFallback<SIMD::ColorMatrix::BT601>(
+								luma[y * width + x], chroma[c], chroma[c + 1]);
+						}
+					}
+					return output[width * height - 1];
+				};
+
+				BENCHMARK("NV12 to RGBA (SIMD)") {
+					SIMD::NV12ToRGBA(luma, chroma, width, height, output);
+					return output[width * height - 1];
+				};
+
+				some<std::uint8_t> outLuma(width * height), outChroma(width * height / 2);
+				BENCHMARK("RGBA to NV12 (SIMD)") {
+					SIMD::RGBAToNV12(output, width, height, outLuma, outChroma);
+					return outChroma[width * height / 2 - 1];
+				};
+
+				const auto bytes = RandomBytes(width * height * 4, 7);
+				some<float> linear(width * height * 4);
+
+				BENCHMARK("sRGB bytes to linear (control)") {
+					for (Count i = 0; i < bytes.size(); ++i)
+						linear[i] = SIMD::SRGBToLinearFallback(bytes[i] / 255.0f);
+					return linear[bytes.size() - 1];
+				};
+
+				BENCHMARK("sRGB bytes to linear (SIMD)") {
+					SIMD::SRGBToLinearSpan(bytes, linear);
+					return linear[bytes.size() - 1];
+				};
+			}
+		}
+	#endif
+}
+
+TEST_CASE("sRGB transfer curves", "[SIMD]") {
+	GIVEN("Every sRGB byte") {
+		some<std::uint8_t> bytes(256 + 13);
+		for (Count i = 0; i < bytes.size(); ++i)
+			bytes[i] = static_cast<std::uint8_t>(i * 7);
+		some<float> linear(bytes.size());
+		SIMD::SRGBToLinearSpan(bytes, linear);
+
+		THEN("They should decode to the linear values, rounded once") {
+			for (Count i = 0; i < bytes.size(); ++i)
+				REQUIRE(linear[i] == static_cast<float>(SIMD::SRGBToLinearFallback(bytes[i] / 255.0)));
+		}
+	}
+
+	GIVEN("Floats across both pieces of the curves") {
+		some<float> values(1001);
+		for (Count i = 0; i < values.size(); ++i)
+			values[i] = static_cast<float>(i) / 1000.0f;
+		values[1] = 0.04045f;
+		values[2] = 0.0031308f;
+
+		WHEN("Decoded and encoded") {
+			some<float> decoded(values.size()), encoded(values.size());
+			SIMD::SRGBToLinearSpan(values, decoded);
+			SIMD::LinearToSRGBSpan(values, encoded);
+
+			THEN("They should match the scalar curves") {
+				for (Count i = 0; i < values.size(); ++i) {
+					REQUIRE(decoded[i] == Approx(SIMD::SRGBToLinearFallback(values[i])).margin(1e-6));
+					REQUIRE(encoded[i] == Approx(SIMD::LinearToSRGBFallback(values[i])).margin(1e-6));
+				}
+			}
+		}
+
+		WHEN("Round tripped in place") {
+			auto data = values;
+			SIMD::SRGBToLinearSpan(data);
+			SIMD::LinearToSRGBSpan(data);
+
+			THEN("They should be almost the same") {
+				for (Count i = 0; i < values.size(); ++i)
+					REQUIRE(data[i] == Approx(values[i]).margin(1e-5));
+			}
+		}
+	}
+}
@@ -0,0 +1,184 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <memory>
+
+#if defined(_WIN32)
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+/// Two pages, where the second one can't be read or written						
+/// Anything placed at the end of the first page faults if read past			
+struct GuardedPage {
+	Size mPageSize;
+	::std::uint8_t* mMemory;
+
+	GuardedPage() {
+		#if defined(_WIN32)
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			mPageSize = info.dwPageSize;
+			mMemory = static_cast<::std::uint8_t*>(VirtualAlloc(nullptr, mPageSize * 2, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+			DWORD old;
+			VirtualProtect(mMemory + mPageSize, mPageSize, PAGE_NOACCESS, &old);
+		#else
+			mPageSize = static_cast<Size>(sysconf(_SC_PAGESIZE));
+			mMemory = static_cast<::std::uint8_t*>(mmap(nullptr, mPageSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+			mprotect(mMemory + mPageSize, mPageSize, PROT_NONE);
+		#endif
+	}
+
+	~GuardedPage() {
+		#if defined(_WIN32)
+			VirtualFree(mMemory, 0, MEM_RELEASE);
+		#else
+			munmap(mMemory, mPageSize * 2);
+		#endif
+	}
+
+	/// Get count bytes, that end right before the guard page						
+	::std::span<::std::uint8_t> Tail(Count count) noexcept {
+		return {mMemory + mPageSize - count, count};
+	}
+};
+
+TEMPLATE_TEST_CASE("Compress, Expand and FilterIf", "[SIMD]", ::std::int8_t, ::std::uint16_t, ::std::int32_t, float, double, ::std::uint64_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {13}, Count {64}, Count {131}}) {
+		GIVEN("A span of " << count << " numbers and an irregular mask") {
+			some<T> values(count);
+			std::unique_ptr<bool[]> mask {new bool[count]};
+			some<T> expected;
+			for (Count i = 0; i < count; ++i) {
+				values[i] = static_cast<T>(i % 100 + 1);
+				mask[i] = (i * 7) % 5 < 2 || i % 11 == 0;
+				if (mask[i])
+					expected.push_back(values[i]);
+			}
+			const ::std::span<const bool> maskSpan {mask.get(), count};
+
+			WHEN("The selected numbers are compressed") {
+				some<T> output(count, T {0});
+				const auto written = SIMD::Compress(values, maskSpan, output);
+
+				THEN("Only the selected numbers should be packed in front") {
+					REQUIRE(written == expected.size());
+					for (Count i = 0; i < written; ++i)
+						REQUIRE(output[i] == expected[i]);
+				}
+			}
+
+			WHEN("The selected numbers are compressed into an exactly sized output") {
+				some<T> output(expected.size());
+				const auto written = SIMD::Compress(values, maskSpan, output);
+
+				THEN("Nothing should be written out of bounds") {
+					REQUIRE(written == expected.size());
+					REQUIRE(output == expected);
+				}
+			}
+
+			WHEN("The packed numbers are expanded back") {
+				some<T> output(count, T {0});
+				const auto consumed = SIMD::Expand(expected, maskSpan, output);
+
+				THEN("Selected numbers should be restored, and the rest untouched") {
+					REQUIRE(consumed == expected.size());
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == (mask[i] ? values[i] : T {0}));
+				}
+			}
+
+			WHEN("The numbers are filtered in place") {
+				auto data = values;
+				const auto kept = SIMD::FilterIf(data, [](const T& v) {
+					return v > T {30} && v < T {70};
+				});
+
+				THEN("Only matching numbers should remain, in order") {
+					some<T> matching;
+					for (auto& v : values) {
+						if (v > T {30} && v < T {70})
+							matching.push_back(v);
+					}
+
+					REQUIRE(kept == matching.size());
+					for (Count i = 0; i < kept; ++i)
+						REQUIRE(data[i] == matching[i]);
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Compress, Expand and FilterIf don't read past short byte spans", "[SIMD]") {
+	GuardedPage page;
+
+	// Byte elements are done eight at a time, so these would have read up	
+	// to eight bytes into the guard page													
+	for (Count count = 8; count < 16; ++count) {
+		GIVEN("A span of " << count << " bytes, right before a guard page") {
+			auto values = page.Tail(count);
+			bool mask[16];
+			some<::std::uint8_t> expected;
+			for (Count i = 0; i < count; ++i) {
+				values[i] = static_cast<::std::uint8_t>(i + 1);
+				mask[i] = i % 3 != 1;
+				if (mask[i])
+					expected.push_back(values[i]);
+			}
+			const ::std::span<const bool> maskSpan {mask, count};
+
+			WHEN("The selected bytes are compressed") {
+				some<::std::uint8_t> output(count, 0);
+				const auto written = SIMD::Compress(values, maskSpan, output);
+
+				THEN("Only the selected bytes should be packed in front") {
+					REQUIRE(written == expected.size());
+					for (Count i = 0; i < written; ++i)
+						REQUIRE(output[i] == expected[i]);
+				}
+			}
+
+			WHEN("The whole span is expanded from the guarded bytes") {
+				const bool all[16] {
+					true, true, true, true, true, true, true, true,
+					true, true, true, true, true, true, true, true
+				};
+				some<::std::uint8_t> output(count, 0);
+				const auto consumed = SIMD::Expand(values, ::std::span<const bool> {all, count}, output);
+
+				THEN("Every byte should be copied") {
+					REQUIRE(consumed == count);
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == values[i]);
+				}
+			}
+
+			WHEN("The bytes are filtered into another span") {
+				some<::std::uint8_t> output(count, 0);
+				const auto kept = SIMD::FilterIf(values, output, [](const ::std::uint8_t& v) {
+					return v % 2 == 0;
+				});
+
+				THEN("Only the even bytes should be kept, in order") {
+					REQUIRE(kept == count / 2);
+					for (Count i = 0; i < kept; ++i)
+						REQUIRE(output[i] == (i + 1) * 2);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,436 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <bit>
+#include <cfenv>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+/// Convert an array with SIMD, and store the result									
+///	@return false if the register combination isn't supported					
+template<class TT, SIMD::ConvertPolicy POLICY = {}, class FT, Count S>
+bool ConvertArray(const FT(&in)[S], TT(&out)[S]) {
+	using R = decltype(SIMD::Convert<0, TT, POLICY>(in));
+	if constexpr (CT::NotSupported<R>)
+		return false;
+	else {
+		SIMD::Store(SIMD::Convert<0, TT, POLICY>(in), out);
+		return true;
+	}
+}
+
+/// Convert all numbers in chunks of S, and check them against a reference		
+template<Count S, class TT, SIMD::ConvertPolicy POLICY = {}, class FT, class F>
+void ConvertAll(const some<FT>& numbers, F&& reference) {
+	for (Count i = 0; i < numbers.size(); ++i) {
+		// Put each number in every lane, next to its neighbours				
+		FT in[S];
+		for (Count j = 0; j < S; ++j)
+			in[j] = numbers[(i + j) % numbers.size()];
+
+		TT out[S];
+		if (!ConvertArray<TT, POLICY>(in, out))
+			return;
+
+		for (Count j = 0; j < S; ++j) {
+			const TT expected = reference(in[j]);
+			REQUIRE(std::bit_cast<Decay<TT>>(out[j]) == std::bit_cast<Decay<TT>>(expected));
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Converting 64-bit integers to doubles", "[SIMD]", std::int64_t, std::uint64_t) {
+	using T = TestType;
+	constexpr T min = std::numeric_limits<T>::min();
+	constexpr T max = std::numeric_limits<T>::max();
+	constexpr T p51 = T {1} << 51;
+	constexpr T p52 = T {1} << 52;
+	constexpr T p53 = T {1} << 53;
+
+	GIVEN("Numbers at the boundaries of the exact double range and beyond") {
+		some<T> numbers {
+			0, 1, 2, p51 - 1, p51, p51 + 1, p52 - 1, p52, p52 + 1,
+			p53 - 1, p53, p53 + 1, p53 + 3, T {1} << 62, (T {1} << 62) + 1,
+			max, max - 1, max - 1024, max - 1025, min, min + 1
+		};
+		if constexpr (CT::Signed<T>) {
+			for (auto n : {-p51, -p51 - 1, -p52 - 1, -p53 - 1, -p53 - 3, T {-1}})
+				numbers.push_back(n);
+		}
+		else {
+			for (auto n : {T {1} << 63, (T {1} << 63) + 1024, (T {1} << 63) + 1025})
+				numbers.push_back(n);
+		}
+
+		const auto reference = [](T n) { return static_cast<double>(n); };
+
+		WHEN("Converted exactly, in registers of any size") {
+			THEN("They should be rounded to the nearest double") {
+				ConvertAll<2, double>(numbers, reference);
+				ConvertAll<3, double>(numbers, reference);
+				ConvertAll<4, double>(numbers, reference);
+				ConvertAll<8, double>(numbers, reference);
+			}
+		}
+
+		WHEN("Converted with the fast range") {
+			constexpr SIMD::ConvertPolicy fast {.mFastRange = true};
+			some<T> small;
+			for (auto n : numbers) {
+				if ((CT::Signed<T> && n >= -p51 && n <= p51) || (!CT::Signed<T> && n <= p52 - 1))
+					small.push_back(n);
+			}
+
+			THEN("Numbers in the fast range should still be exact") {
+				ConvertAll<2, double, fast>(small, reference);
+				ConvertAll<4, double, fast>(small, reference);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Converting 64-bit integers to floats", "[SIMD]", std::int64_t, std::uint64_t) {
+	using T = TestType;
+	constexpr T p53 = T {1} << 53;
+
+	GIVEN("Numbers just above halfway between two floats, and the extremes") {
+		// Through a double, the trailing one gets lost, and the rest is	
+		// a tie that rounds to even, instead of up								
+		some<T> numbers {
+			0, 1, p53 - 1, p53, p53 + 1,
+			(T {1} << 60) + (T {1} << 36) + 1, (T {1} << 60) + (T {1} << 36),
+			(T {1} << 62) + (T {1} << 38) + 1,
+			std::numeric_limits<T>::max(), std::numeric_limits<T>::min()
+		};
+		if constexpr (CT::Signed<T>) {
+			for (auto n : {-(T {1} << 60) - (T {1} << 36) - 1, -p53 - 1, T {-1}})
+				numbers.push_back(n);
+		}
+		else numbers.push_back((T {1} << 63) + (T {1} << 39) + 1);
+
+		const auto reference = [](T n) { return static_cast<float>(n); };
+
+		WHEN("Converted in registers of any size") {
+			THEN("They should be rounded once, like a cast does") {
+				REQUIRE(reference((T {1} << 60) + (T {1} << 36) + 1) == 0x1p60f + 0x1p37f);
+				ConvertAll<2, float>(numbers, reference);
+				ConvertAll<3, float>(numbers, reference);
+				ConvertAll<4, float>(numbers, reference);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Converting doubles to 64-bit integers", "[SIMD]", std::int64_t, std::uint64_t) {
+	using T = TestType;
+	const double p51 = std::ldexp(1.0, 51);
+	const double p52 = std::ldexp(1.0, 52);
+	const double p53 = std::ldexp(1.0, 53);
+
+	GIVEN("Doubles at the boundaries of the exact double range and beyond") {
+		some<double> numbers {
+			0.0, 0.25, 0.5, 1.5, 2.5, 3.49, p51 - 0.5, p51, p51 + 0.5, p51 + 1.5,
+			p52 - 1.5, p52 - 0.5, p52, p52 + 1, p52 + 2, p53, p53 + 2, p53 * 3,
+			std::ldexp(1.0, 62), std::ldexp(1.0, 62) + 2048, std::ldexp(1.0, 63) - 1024
+		};
+		if constexpr (CT::Signed<T>) {
+			for (auto n : {-0.0, -0.5, -1.5, -2.5, -p51 - 0.5, -p52 + 0.5, -p52 - 2, -p53 * 5, -std::ldexp(1.0, 63)})
+				numbers.push_back(n);
+		}
+		else {
+			for (auto n : {std::ldexp(1.0, 63), std::ldexp(1.0, 63) + 2048, std::ldexp(1.0, 64) - 2048})
+				numbers.push_back(n);
+		}
+
+		// Rounded to nearest even, like the hardware does by default		
+		const auto reference = [](double n) {
+			const double whole = std::nearbyint(n);
+			if constexpr (CT::Signed<T>)
+				return static_cast<T>(whole);
+			else
+				return whole >= std::ldexp(1.0, 63)
+					? static_cast<T>(static_cast<std::int64_t>(whole - std::ldexp(1.0, 63))) + (T {1} << 63)
+					: static_cast<T>(whole);
+		};
+
+		WHEN("Converted exactly, in registers of any size") {
+			THEN("They should be rounded to the nearest integer") {
+				ConvertAll<2, T>(numbers, reference);
+				ConvertAll<3, T>(numbers, reference);
+				ConvertAll<4, T>(numbers, reference);
+				ConvertAll<8, T>(numbers, reference);
+			}
+		}
+
+		WHEN("Converted with the fast range") {
+			constexpr SIMD::ConvertPolicy fast {.mFastRange = true};
+			some<double> small;
+			for (auto n : numbers) {
+				if ((CT::Signed<T> && std::abs(n) <= p51) || (!CT::Signed<T> && n <= p52 - 1))
+					small.push_back(n);
+			}
+
+			THEN("Numbers in the fast range should still be exact") {
+				ConvertAll<2, T, fast>(small, reference);
+				ConvertAll<4, T, fast>(small, reference);
+			}
+		}
+	}
+
+	GIVEN("Integers that went through doubles") {
+		const T in[4] {T {1} << 60, (T {1} << 60) + 4096, 123456789012345, 7};
+		double through[4];
+		T back[4];
+
+		THEN("They should come back the same, as they are all representable") {
+			if (ConvertArray<double>(in, through) && ConvertArray<T>(through, back)) {
+				for (Count j = 0; j < 4; ++j)
+					REQUIRE(back[j] == in[j]);
+			}
+		}
+	}
+}
+
+/// Make numbers of all kinds - big, small, halfway, and not numbers at all	
+template<class T>
+some<T> ConvertSpanInput(Count count) {
+	std::mt19937_64 generator {count};
+	some<T> numbers(count);
+	for (Count i = 0; i < count; ++i) {
+		const auto bits = generator();
+		if constexpr (CT::Integer<T>)
+			numbers[i] = static_cast<T>(i % 2 ? bits : bits % 600 - 300);
+		else {
+			double n;
+			switch (i % 6) {
+			case 0: n = static_cast<std::int64_t>(bits) * 0x1p-31; break;
+			case 1: n = static_cast<std::int64_t>(bits) * 0x1p-55; break;
+			case 2: n = static_cast<std::int64_t>(bits % 600) - 300.5; break;
+			case 3: n = static_cast<std::int64_t>(bits) * 0x1p-60; break;
+			case 4: n = (bits % 3) ? std::numeric_limits<double>::infinity() * ((bits & 8) ? 1 : -1)
+			                       : std::numeric_limits<double>::quiet_NaN(); break;
+			default: n = static_cast<double>(bits % 70000) * ((bits & 1) ? 1 : -1); break;
+			}
+			numbers[i] = static_cast<T>(n);
+		}
+	}
+	return numbers;
+}
+
+TEMPLATE_TEST_CASE("Converting spans", "[SIMD]",
+	(std::pair<float, std::int8_t>), (std::pair<float, std::uint8_t>),
+	(std::pair<float, std::int16_t>), (std::pair<float, std::uint16_t>),
+	(std::pair<float, std::int32_t>), (std::pair<float, std::uint32_t>),
+	(std::pair<std::int8_t, float>), (std::pair<std::uint8_t, float>),
+	(std::pair<std::uint16_t, float>), (std::pair<std::uint32_t, float>),
+	(std::pair<std::int32_t, std::uint8_t>), (std::pair<std::uint32_t, std::int16_t>),
+	(std::pair<std::int16_t, std::uint32_t>), (std::pair<std::uint32_t, std::int32_t>),
+	(std::pair<Float16, std::uint8_t>), (std::pair<std::int16_t, BFloat16>),
+	(std::pair<float, Float16>), (std::pair<double, float>), (std::pair<float, double>),
+	(std::pair<double, std::int64_t>), (std::pair<std::uint64_t, double>),
+	(std::pair<double, std::int16_t>), (std::pair<std::int64_t, std::uint64_t>),
+	(std::pair<std::int64_t, float>), (std::pair<std::uint64_t, float>),
+	(std::pair<std::int8_t, double>), (std::pair<std::uint16_t, double>),
+	(std::pair<std::int32_t, double>), (std::pair<std::uint32_t, double>),
+	(std::pair<double, std::uint8_t>), (std::pair<double, std::int32_t>),
+	(std::pair<double, std::uint32_t>)
+) {
+	using FT = typename TestType::first_type;
+	using TT = typename TestType::second_type;
+
+	for (Count count : {Count {1}, Count {7}, Count {64}, Count {100}, Count {1000}}) {
+		GIVEN(count << " numbers") {
+			auto input = ConvertSpanInput<FT>(count);
+			if constexpr (CT::RealDP<FT> && CT::Integer64<TT>) {
+				// Doubles outside the 64-bit range give unspecified results
+				for (auto& n : input) {
+					if (!(std::abs(n) < 0x1p62))
+						n = 0;
+				}
+			}
+
+			some<TT> output(count);
+			SIMD::ConvertSpan(input, output);
+
+			THEN("Each number should be rounded, and saturated to the output range") {
+				for (Count i = 0; i < count; ++i) {
+					const auto expected = SIMD::ConvertFallback<TT>(input[i]);
+					if constexpr (CT::RealHalf<TT>)
+						REQUIRE(output[i].mBits == expected.mBits);
+					else if constexpr (CT::Real<TT>) {
+						if (std::isnan(expected))
+							REQUIRE(std::isnan(output[i]));
+						else
+							REQUIRE(output[i] == expected);
+					}
+					else REQUIRE(output[i] == expected);
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("64-bit integers to floats are rounded once", "[SIMD]") {
+	GIVEN("Integers just above halfway between two floats") {
+		// Through a double, the trailing one gets lost, and the rest is	
+		// a tie that rounds to even, instead of up								
+		constexpr auto i60 = (std::int64_t {1} << 60) + (std::int64_t {1} << 36) + 1;
+		constexpr auto u63 = (std::uint64_t {1} << 63) + (std::uint64_t {1} << 39) + 1;
+		const some<std::int64_t> signed64 {i60, -i60, i60, -i60, 0, 1, -1, i60};
+		const some<std::uint64_t> unsigned64 {u63, u63, 0, 1, u63, u63, 2, u63};
+		some<float> fromSigned(signed64.size()), fromUnsigned(unsigned64.size());
+		SIMD::ConvertSpan(signed64, fromSigned);
+		SIMD::ConvertSpan(unsigned64, fromUnsigned);
+
+		THEN("They should round up, like a direct cast does") {
+			REQUIRE(static_cast<float>(i60) == 0x1p60f + 0x1p37f);
+			REQUIRE(static_cast<float>(u63) == 0x1p63f + 0x1p40f);
+			for (Count i = 0; i < signed64.size(); ++i) {
+				REQUIRE(fromSigned[i] == static_cast<float>(signed64[i]));
+				REQUIRE(fromUnsigned[i] == static_cast<float>(unsigned64[i]));
+			}
+		}
+	}
+}
+
+TEST_CASE("Narrowing spans with saturation", "[SIMD]") {
+	GIVEN("Floats outside the 8-bit range, and NaN") {
+		const some<float> input {300.f, -300.f, 127.5f, -128.5f, 254.5f, 255.5f, 0.5f, -0.5f,
+			std::numeric_limits<float>::quiet_NaN(), 1e20f, -1e20f, 3.5f};
+		some<std::int8_t> signed8(input.size());
+		some<std::uint8_t> unsigned8(input.size());
+		SIMD::ConvertSpan(input, signed8);
+		SIMD::ConvertSpan(input, unsigned8);
+
+		THEN("They should round to nearest even, and clamp to the limits") {
+			REQUIRE(signed8 == some<std::int8_t> {127, -128, 127, -128, 127, 127, 0, 0, 0, 127, -128, 4});
+			REQUIRE(unsigned8 == some<std::uint8_t> {255, 0, 128, 0, 254, 255, 0, 0, 0, 255, 0, 4});
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("1M floats") {
+			some<float> input(1 << 20);
+			for (Count i = 0; i < input.size(); ++i)
+				input[i] = static_cast<float>(i % 1000) * 0.3f - 150;
+			some<std::int8_t> output(input.size());
+
+			BENCHMARK("Floats to 8-bit integers (control)") {
+				for (Count i = 0; i < input.size(); ++i)
+					output[i] = static_cast<std::int8_t>(std::clamp(std::nearbyint(input[i]), -128.f, 127.f));
+				return output[0];
+			};
+
+			BENCHMARK("Floats to 8-bit integers (SIMD)") {
+				SIMD::ConvertSpan(input, output);
+				return output[0];
+			};
+		}
+	#endif
+}
+
+/// Round, clamp and convert a real number the way a policy says - the same	
+/// as a careful quantizer would do it, one number at a time					
+template<class TT, SIMD::ConvertPolicy POLICY, class FT>
+TT ConvertWithPolicy(FT n) {
+	using L = std::numeric_limits<TT>;
+	if (std::isnan(n))
+		return 0;
+
+	switch (POLICY.mRounding) {
+	case SIMD::ConvertRounding::Truncate: n = std::trunc(n); break;
+	case SIMD::ConvertRounding::Floor: n = std::floor(n); break;
+	case SIMD::ConvertRounding::Ceil: n = std::ceil(n); break;
+	default: n = std::nearbyint(n); break;
+	}
+
+	if (n <= static_cast<long double>(L::min()))
+		return L::min();
+	if (n >= static_cast<long double>(L::max()))
+		return L::max();
+	return static_cast<TT>(n);
+}
+
+TEMPLATE_TEST_CASE("Converting reals to integers with a policy", "[SIMD]",
+	(std::pair<float, std::int8_t>), (std::pair<float, std::uint8_t>),
+	(std::pair<float, std::int16_t>), (std::pair<float, std::uint16_t>),
+	(std::pair<float, std::int32_t>), (std::pair<float, std::uint32_t>),
+	(std::pair<float, std::int64_t>), (std::pair<float, std::uint64_t>),
+	(std::pair<double, std::int8_t>), (std::pair<double, std::uint8_t>),
+	(std::pair<double, std::int16_t>), (std::pair<double, std::uint16_t>),
+	(std::pair<double, std::int32_t>), (std::pair<double, std::uint32_t>),
+	(std::pair<double, std::int64_t>), (std::pair<double, std::uint64_t>)
+) {
+	using FT = typename TestType::first_type;
+	using TT = typename TestType::second_type;
+	using L = std::numeric_limits<TT>;
+	constexpr FT inf = std::numeric_limits<FT>::infinity();
+
+	GIVEN("Halfway numbers, numbers around the limits, and not numbers at all") {
+		some<FT> numbers {
+			0, FT(0.5), FT(1.5), FT(2.5), FT(-0.5), FT(-1.5), FT(-2.5), FT(7.25), FT(-7.75),
+			FT(126.5), FT(127.5), FT(-128.5), FT(254.5), FT(255.5), FT(300), FT(-300),
+			FT(32767.5), FT(-32768.5), FT(65535.5), FT(70000), FT(-70000),
+			FT(2147483520.0), FT(2147483647.0), FT(2147483648.0), FT(-2147483648.0),
+			FT(-2147483904.0), FT(4294967040.0), FT(4294967295.0), FT(4294967296.0),
+			FT(0x1p62), FT(0x1p63), FT(-0x1p63), FT(0x1p64), FT(-0x1p64), FT(1e30), FT(-1e30),
+			inf, -inf, std::numeric_limits<FT>::quiet_NaN()
+		};
+
+		WHEN("Rounded to nearest, saturated, and NaN is zeroed") {
+			constexpr SIMD::ConvertPolicy policy {
+				.mRounding = SIMD::ConvertRounding::Nearest, .mSaturate = true, .mNaNToZero = true
+			};
+			const auto reference = [](FT n) { return ConvertWithPolicy<TT, policy>(n); };
+
+			THEN("Each number should be the closest integer in range") {
+				ConvertAll<2, TT, policy>(numbers, reference);
+				ConvertAll<3, TT, policy>(numbers, reference);
+				ConvertAll<4, TT, policy>(numbers, reference);
+			}
+		}
+
+		WHEN("Truncated, floored or ceiled, and saturated") {
+			constexpr SIMD::ConvertPolicy truncate {
+				.mRounding = SIMD::ConvertRounding::Truncate, .mSaturate = true, .mNaNToZero = true
+			};
+			constexpr SIMD::ConvertPolicy floor {
+				.mRounding = SIMD::ConvertRounding::Floor, .mSaturate = true, .mNaNToZero = true
+			};
+			constexpr SIMD::ConvertPolicy ceil {
+				.mRounding = SIMD::ConvertRounding::Ceil, .mSaturate = true, .mNaNToZero = true
+			};
+
+			THEN("Each number should be rounded in the right direction") {
+				ConvertAll<4, TT, truncate>(numbers, [](FT n) { return ConvertWithPolicy<TT, truncate>(n); });
+				ConvertAll<4, TT, floor>(numbers, [](FT n) { return ConvertWithPolicy<TT, floor>(n); });
+				ConvertAll<4, TT, ceil>(numbers, [](FT n) { return ConvertWithPolicy<TT, ceil>(n); });
+			}
+		}
+
+		WHEN("Only rounded, for numbers that are in range") {
+			constexpr SIMD::ConvertPolicy floor {.mRounding = SIMD::ConvertRounding::Floor};
+			some<FT> small;
+			for (auto n : numbers) {
+				if (n >= FT(L::min()) && n <= FT(127))
+					small.push_back(n);
+			}
+
+			THEN("They should be rounded, regardless of the current rounding mode") {
+				std::fesetround(FE_UPWARD);
+				ConvertAll<2, TT, floor>(small, [](FT n) { return static_cast<TT>(std::floor(n)); });
+				ConvertAll<4, TT, floor>(small, [](FT n) { return static_cast<TT>(std::floor(n)); });
+				std::fesetround(FE_TONEAREST);
+			}
+		}
+	}
+}
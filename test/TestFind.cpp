@@ -0,0 +1,68 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+
+TEMPLATE_TEST_CASE("ArgMin, ArgMax, FindFirst and FindLast", "[SIMD]", SIGNED_TYPES(), ::std::uint8_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {7}, Count {40}, Count {257}}) {
+		GIVEN("A span of " << count << " numbers with repeating values") {
+			some<T> data(count);
+			for (Count i = 0; i < count; ++i)
+				data[i] = static_cast<T>((i * 37) % 61 + 3);
+
+			WHEN("The smallest and biggest elements are searched") {
+				const auto min = SIMD::ArgMin(data);
+				const auto max = SIMD::ArgMax(data);
+
+				THEN("The first extreme indices should be found") {
+					REQUIRE(min == Offset(std::min_element(data.begin(), data.end()) - data.begin()));
+					REQUIRE(max == Offset(std::max_element(data.begin(), data.end()) - data.begin()));
+				}
+			}
+
+			WHEN("The extremes are placed at the very end") {
+				data.back() = T {0};
+				data.front() = T {100};
+
+				THEN("They should still be found") {
+					REQUIRE(SIMD::ArgMin(data) == count - 1);
+					REQUIRE(SIMD::ArgMax(data) == 0);
+				}
+			}
+
+			WHEN("Existing values are searched") {
+				for (T key : {data[count / 2], data.back(), data.front()}) {
+					const auto first = SIMD::FindFirst(data, key);
+					const auto last = SIMD::FindLast(data, key);
+					REQUIRE(first == Offset(std::find(data.begin(), data.end(), key) - data.begin()));
+					REQUIRE(last == Offset(count - 1 - (std::find(data.rbegin(), data.rend(), key) - data.rbegin())));
+				}
+			}
+
+			WHEN("A missing value is searched") {
+				THEN("The size of the span should be returned") {
+					REQUIRE(SIMD::FindFirst(data, T {1}) == count);
+					REQUIRE(SIMD::FindLast(data, T {1}) == count);
+				}
+			}
+		}
+	}
+
+	GIVEN("An empty span") {
+		some<T> data;
+
+		THEN("Nothing should be found") {
+			REQUIRE(SIMD::ArgMin(data) == 0);
+			REQUIRE(SIMD::FindFirst(data, T {1}) == 0);
+		}
+	}
+}
@@ -0,0 +1,185 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/// Fill arrays with random fixed point numbers, and put the numbers that		
+/// are most likely to overflow at the start of them									
+template<class T, Count S>
+void RandomFixed(std::mt19937& generator, T(&lhs)[S], T(&rhs)[S]) {
+	using L = std::numeric_limits<typename T::Type>;
+	std::uniform_int_distribution<std::int64_t> distribution {L::min(), L::max()};
+	for (Count i = 0; i < S; ++i) {
+		lhs[i] = T::FromBits(static_cast<typename T::Type>(distribution(generator)));
+		rhs[i] = T::FromBits(static_cast<typename T::Type>(distribution(generator)));
+	}
+
+	constexpr typename T::Type edges[][2] {
+		{L::min(), L::min()}, {L::max(), L::max()}, {L::min(), L::max()}, {-1, L::min()}
+	};
+	for (Count i = 0; i < S && i < 4; ++i) {
+		lhs[i] = T::FromBits(edges[i][0]);
+		rhs[i] = T::FromBits(edges[i][1]);
+	}
+}
+
+/// Compare SIMD arithmetic against the scalar operators								
+template<class T, Count S>
+void CheckFixedArithmetic(std::mt19937& generator) {
+	for (int repeat = 0; repeat < 64; ++repeat) {
+		T x[S], y[S], r[S];
+		RandomFixed(generator, x, y);
+
+		SIMD::Add(x, y, r);
+		for (Count j = 0; j < S; ++j)
+			REQUIRE(r[j].mBits == (x[j] + y[j]).mBits);
+
+		SIMD::Subtract(x, y, r);
+		for (Count j = 0; j < S; ++j)
+			REQUIRE(r[j].mBits == (x[j] - y[j]).mBits);
+
+		SIMD::Multiply(x, y, r);
+		for (Count j = 0; j < S; ++j)
+			REQUIRE(r[j].mBits == (x[j] * y[j]).mBits);
+
+		SIMD::Multiply(x, y[0], r);
+		for (Count j = 0; j < S; ++j)
+			REQUIRE(r[j].mBits == (x[j] * y[0]).mBits);
+	}
+}
+
+/// Compare SIMD conversions against the scalar constructor and operator		
+/// Arrays that don't fit in the widest register are skipped						
+template<class T, Count S>
+void CheckFixedConversion(const some<float>& floats) {
+	if constexpr (!CT::NotSupported<decltype(SIMD::Load<0>(Uneval<float[S]>()))>) {
+		for (Count i = 0; i + S <= floats.size(); i += S) {
+			float in[S];
+			std::memcpy(in, floats.data() + i, sizeof(in));
+
+			T narrowed[S];
+			SIMD::Store(SIMD::Convert<0, T>(in), narrowed);
+			float widened[S];
+			SIMD::Store(SIMD::Convert<0, float>(narrowed), widened);
+
+			for (Count j = 0; j < S; ++j) {
+				REQUIRE(narrowed[j].mBits == T {in[j]}.mBits);
+				REQUIRE(std::bit_cast<std::uint32_t>(widened[j]) == std::bit_cast<std::uint32_t>(static_cast<float>(narrowed[j])));
+			}
+		}
+	}
+}
+
+TEST_CASE("Fixed point scalar arithmetic", "[SIMD]") {
+	GIVEN("Well known numbers") {
+		THEN("They should have the expected encodings") {
+			REQUIRE(Q15 {0.5}.mBits == 0x4000);
+			REQUIRE(Q15 {-1.0}.mBits == -0x8000);
+			REQUIRE(Q15 {1.0}.mBits == 0x7FFF);
+			REQUIRE(Q15 {std::ldexp(1.0, -16)}.mBits == 0);
+			REQUIRE(Q15 {std::ldexp(3.0, -16)}.mBits == 2);
+			REQUIRE(Q15 {-std::ldexp(3.0, -16)}.mBits == -2);
+			REQUIRE(Q15 {std::numeric_limits<double>::quiet_NaN()}.mBits == 0);
+			REQUIRE(Q15 {-std::numeric_limits<double>::infinity()}.mBits == -0x8000);
+			REQUIRE(Q31 {0.25}.mBits == 1 << 29);
+			REQUIRE(Q31 {-1.0}.mBits == std::numeric_limits<std::int32_t>::min());
+			REQUIRE(Q31 {2.0}.mBits == std::numeric_limits<std::int32_t>::max());
+			REQUIRE(Q8_8 {1.5}.mBits == 0x180);
+			REQUIRE(Q8_8 {-200.0}.mBits == -0x8000);
+			REQUIRE(static_cast<float>(Q8_8 {-3.25}) == -3.25f);
+			REQUIRE(static_cast<double>(Q31 {0.1}) == std::ldexp(std::round(std::ldexp(0.1, 31)), -31));
+		}
+
+		THEN("Arithmetic should saturate, and multiplication should round") {
+			REQUIRE((Q15 {0.5} * Q15 {0.5}).mBits == Q15 {0.25}.mBits);
+			REQUIRE((Q15 {-1.0} * Q15 {-1.0}).mBits == 0x7FFF);
+			REQUIRE((Q15::FromBits(1) * Q15 {0.5}).mBits == 1);
+			REQUIRE((Q15::FromBits(-1) * Q15 {0.5}).mBits == 0);
+			REQUIRE((Q15 {0.75} + Q15 {0.75}).mBits == 0x7FFF);
+			REQUIRE((Q15 {-0.75} - Q15 {0.75}).mBits == -0x8000);
+			REQUIRE((Q31 {-1.0} * Q31 {-1.0}).mBits == std::numeric_limits<std::int32_t>::max());
+			REQUIRE((Q8_8 {100.0} * Q8_8 {2.0}).mBits == 0x7FFF);
+			REQUIRE((Q8_8 {-1.5} * Q8_8 {2.5}).mBits == Q8_8 {-3.75}.mBits);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Fixed point SIMD arithmetic", "[SIMD]", Q15, Q31, Q8_8) {
+	using T = TestType;
+	std::mt19937 generator {11};
+
+	GIVEN("Random numbers, and the ones most likely to overflow") {
+		THEN("SIMD should match the scalar operators, in registers of any size") {
+			CheckFixedArithmetic<T, 3>(generator);
+			CheckFixedArithmetic<T, 8>(generator);
+			CheckFixedArithmetic<T, 16>(generator);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Fixed point SIMD conversions", "[SIMD]", Q15, Q31, Q8_8) {
+	using T = TestType;
+	const float range = static_cast<float>(T::FromBits(std::numeric_limits<typename T::Type>::min()));
+
+	GIVEN("Random floats, some of them out of range") {
+		std::mt19937 generator {7};
+		std::uniform_real_distribution<float> distribution {range * 1.25f, -range * 1.25f};
+		some<float> floats(4096);
+		for (auto& f : floats)
+			f = distribution(generator);
+
+		// Ties, and numbers that don't convert as is							
+		const float ulp = std::ldexp(1.0f, -T::Fraction);
+		const float special[] {
+			ulp * 0.5f, ulp * 1.5f, -ulp * 2.5f, -range, range,
+			std::numeric_limits<float>::quiet_NaN(),
+			std::numeric_limits<float>::infinity(),
+			-std::numeric_limits<float>::infinity()
+		};
+		std::memcpy(floats.data(), special, sizeof(special));
+
+		THEN("SIMD should match the scalar conversions") {
+			CheckFixedConversion<T, 3>(floats);
+			CheckFixedConversion<T, 4>(floats);
+			CheckFixedConversion<T, 8>(floats);
+		}
+
+		THEN("Rounding should follow the policy") {
+			const float in[4] {ulp * 0.5f, -ulp * 0.5f, ulp * 1.75f, -ulp * 1.25f};
+			T floor[4], ceil[4];
+			SIMD::Store(SIMD::Convert<0, T, SIMD::ConvertPolicy {.mRounding = SIMD::ConvertRounding::Floor}>(in), floor);
+			SIMD::Store(SIMD::Convert<0, T, SIMD::ConvertPolicy {.mRounding = SIMD::ConvertRounding::Ceil}>(in), ceil);
+
+			const typename T::Type floors[4] {0, -1, 1, -2};
+			const typename T::Type ceils[4] {1, 0, 2, -1};
+			for (Count j = 0; j < 4; ++j) {
+				REQUIRE(floor[j].mBits == floors[j]);
+				REQUIRE(ceil[j].mBits == ceils[j]);
+			}
+		}
+	}
+
+	GIVEN("Half precision numbers") {
+		const Float16 in[4] {Float16 {0.5f}, Float16 {-0.25f}, Float16 {0.125f}, Float16 {-1.0f}};
+		T narrowed[4];
+		SIMD::Store(SIMD::Convert<0, T>(in), narrowed);
+		Float16 widened[4];
+		SIMD::Store(SIMD::Convert<0, Float16>(narrowed), widened);
+
+		THEN("They should convert through single precision") {
+			for (Count j = 0; j < 4; ++j) {
+				REQUIRE(narrowed[j].mBits == T {static_cast<float>(in[j])}.mBits);
+				REQUIRE(widened[j].mBits == in[j].mBits);
+			}
+		}
+	}
+}
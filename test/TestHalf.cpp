@@ -0,0 +1,149 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/// Make a 16-bit real number from its bits												
+template<class T>
+T FromBits(std::uint16_t bits) {
+	T result;
+	result.mBits = bits;
+	return result;
+}
+
+TEST_CASE("Half precision scalar conversions", "[SIMD]") {
+	GIVEN("Well known numbers") {
+		THEN("Float16 should have the IEEE 754 encodings") {
+			REQUIRE(Float16 {1.0f}.mBits == 0x3C00);
+			REQUIRE(Float16 {-2.0f}.mBits == 0xC000);
+			REQUIRE(Float16 {0.1f}.mBits == 0x2E66);
+			REQUIRE(Float16 {65504.0f}.mBits == 0x7BFF);
+			REQUIRE(Float16 {65520.0f}.mBits == 0x7C00);
+			REQUIRE(Float16 {std::ldexp(1.0f, -24)}.mBits == 0x0001);
+			REQUIRE(Float16 {std::ldexp(1.0f, -26)}.mBits == 0x0000);
+			REQUIRE(Float16 {-0.0f}.mBits == 0x8000);
+			REQUIRE(Float16 {std::numeric_limits<float>::infinity()}.mBits == 0x7C00);
+			REQUIRE(std::isnan(static_cast<float>(Float16 {std::numeric_limits<float>::quiet_NaN()})));
+		}
+
+		THEN("BFloat16 should round to nearest even") {
+			REQUIRE(BFloat16 {1.0f}.mBits == 0x3F80);
+			REQUIRE(BFloat16 {std::bit_cast<float>(0x3F808000u)}.mBits == 0x3F80);
+			REQUIRE(BFloat16 {std::bit_cast<float>(0x3F818000u)}.mBits == 0x3F82);
+			REQUIRE(BFloat16 {std::bit_cast<float>(0x3F808001u)}.mBits == 0x3F81);
+			REQUIRE(std::isnan(static_cast<float>(BFloat16 {std::numeric_limits<float>::quiet_NaN()})));
+		}
+	}
+
+	GIVEN("Every possible Float16 and BFloat16") {
+		THEN("Widening and narrowing back should give the same bits") {
+			for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+				const auto h = FromBits<Float16>(static_cast<std::uint16_t>(bits));
+				const auto b = FromBits<BFloat16>(static_cast<std::uint16_t>(bits));
+				const float hf = h;
+				const float bf = b;
+				if (std::isnan(hf))
+					REQUIRE(std::isnan(static_cast<float>(Float16 {hf})));
+				else
+					REQUIRE(Float16 {hf}.mBits == bits);
+
+				if (std::isnan(bf))
+					REQUIRE(std::isnan(static_cast<float>(BFloat16 {bf})));
+				else
+					REQUIRE(BFloat16 {bf}.mBits == bits);
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Half precision SIMD conversions", "[SIMD]", Float16, BFloat16) {
+	using T = TestType;
+
+	GIVEN("Random floats of all magnitudes") {
+		std::mt19937 generator {7};
+		std::uniform_int_distribution<std::uint32_t> distribution;
+		some<float> floats(4096);
+		for (auto& f : floats) {
+			f = std::bit_cast<float>(distribution(generator));
+			if (std::isnan(f))
+				f = 0;
+		}
+
+		WHEN("Narrowed and widened four at a time") {
+			for (Count i = 0; i < floats.size(); i += 4) {
+				float in[4];
+				std::memcpy(in, floats.data() + i, sizeof(in));
+
+				T narrowed[4];
+				SIMD::Store(SIMD::Convert<0, T>(in), narrowed);
+				float widened[4];
+				SIMD::Store(SIMD::Convert<0, float>(narrowed), widened);
+
+				for (Count j = 0; j < 4; ++j) {
+					REQUIRE(narrowed[j].mBits == T {in[j]}.mBits);
+					REQUIRE(std::bit_cast<std::uint32_t>(widened[j]) == std::bit_cast<std::uint32_t>(static_cast<float>(narrowed[j])));
+				}
+			}
+		}
+
+		WHEN("Narrowed and widened through odd sized arrays") {
+			float in[3];
+			std::memcpy(in, floats.data(), sizeof(in));
+			T narrowed[3];
+			SIMD::Store(SIMD::Convert<0, T>(in), narrowed);
+			float widened[3];
+			SIMD::Store(SIMD::Convert<0, float>(narrowed), widened);
+
+			for (Count j = 0; j < 3; ++j) {
+				REQUIRE(narrowed[j].mBits == T {in[j]}.mBits);
+				REQUIRE(widened[j] == static_cast<float>(narrowed[j]));
+			}
+		}
+	}
+
+	GIVEN("Integers") {
+		const std::int32_t in[4] {-3, 0, 100, 250};
+		T narrowed[4];
+		SIMD::Store(SIMD::Convert<0, T>(in), narrowed);
+		std::int32_t back[4];
+		SIMD::Store(SIMD::Convert<0, std::int32_t>(narrowed), back);
+
+		THEN("They should convert exactly, as they are all representable") {
+			for (Count j = 0; j < 4; ++j) {
+				REQUIRE(static_cast<float>(narrowed[j]) == static_cast<float>(in[j]));
+				REQUIRE(back[j] == in[j]);
+			}
+		}
+	}
+
+	GIVEN("Arithmetic on 16-bit reals") {
+		T x[8], y[8], r[8];
+		for (int j = 0; j < 8; ++j) {
+			x[j] = T {j * 0.75f - 2};
+			y[j] = T {j * 1.5f + 0.25f};
+		}
+
+		THEN("It should be done in single precision, and rounded on store") {
+			SIMD::Add(x, y, r);
+			for (Count j = 0; j < 8; ++j)
+				REQUIRE(r[j].mBits == T {static_cast<float>(x[j]) + static_cast<float>(y[j])}.mBits);
+
+			SIMD::Multiply(x, y, r);
+			for (Count j = 0; j < 8; ++j)
+				REQUIRE(r[j].mBits == T {static_cast<float>(x[j]) * static_cast<float>(y[j])}.mBits);
+
+			T lhs[1] {x[7]}, rhs[1] {y[0]}, one[1];
+			SIMD::Subtract(lhs, rhs, one);
+			REQUIRE(one[0].mBits == T {static_cast<float>(x[7]) - static_cast<float>(y[0])}.mBits);
+		}
+	}
+}
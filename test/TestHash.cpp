@@ -0,0 +1,165 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/// Reference XXH64, written straight from the specification						
+std::uint64_t ReferenceXXHash64(const void* data, Count length, std::uint64_t seed) {
+	constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ull;
+	constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+	constexpr std::uint64_t P3 = 0x165667B19E3779F9ull;
+	constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ull;
+	constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ull;
+	const auto rotl = [](std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+	const auto round = [&](std::uint64_t acc, std::uint64_t input) { return rotl(acc + input * P2, 31) * P1; };
+	const auto bytes = static_cast<const std::uint8_t*>(data);
+	const auto read64 = [&](Count at) { std::uint64_t v; std::memcpy(&v, bytes + at, 8); return v; };
+	const auto read32 = [&](Count at) { std::uint32_t v; std::memcpy(&v, bytes + at, 4); return v; };
+
+	Count p = 0;
+	std::uint64_t h;
+	if (length >= 32) {
+		std::uint64_t v1 = seed + P1 + P2, v2 = seed + P2, v3 = seed, v4 = seed - P1;
+		for (; p + 32 <= length; p += 32) {
+			v1 = round(v1, read64(p));
+			v2 = round(v2, read64(p + 8));
+			v3 = round(v3, read64(p + 16));
+			v4 = round(v4, read64(p + 24));
+		}
+		h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+		for (auto v : {v1, v2, v3, v4})
+			h = (h ^ round(0, v)) * P1 + P4;
+	}
+	else h = seed + P5;
+
+	h += length;
+	for (; p + 8 <= length; p += 8)
+		h = rotl(h ^ round(0, read64(p)), 27) * P1 + P4;
+	if (p + 4 <= length) {
+		h = rotl(h ^ (read32(p) * P1), 23) * P2 + P3;
+		p += 4;
+	}
+	for (; p < length; ++p)
+		h = rotl(h ^ (bytes[p] * P5), 11) * P1;
+
+	h ^= h >> 33;
+	h *= P2;
+	h ^= h >> 29;
+	h *= P3;
+	h ^= h >> 32;
+	return h;
+}
+
+TEMPLATE_TEST_CASE("Hashing integer keys", "[SIMD]", std::uint32_t, std::int32_t, std::uint64_t, std::int64_t) {
+	using T = TestType;
+
+	for (Count count : {Count {1}, Count {7}, Count {16}, Count {33}, Count {1000}}) {
+		GIVEN(count << " keys") {
+			some<T> keys(count);
+			for (Count i = 0; i < count; ++i)
+				keys[i] = static_cast<T>(i * 0x9E3779B97F4A7C15ull - 3);
+			some<std::uint64_t> hashes(count);
+
+			WHEN("Keys are hashed with and without a seed") {
+				for (std::uint64_t seed : {0ull, 0xDEADBEEFCAFEull}) {
+					SIMD::XXHash64Span(keys, hashes, seed);
+
+					THEN("Each hash should be the XXH64 of the key's bytes") {
+						for (Count i = 0; i < count; ++i)
+							REQUIRE(hashes[i] == ReferenceXXHash64(&keys[i], sizeof(T), seed));
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("Hashing byte strings", "[SIMD]") {
+	GIVEN("Well known check strings") {
+		THEN("The hashes should match the published values") {
+			REQUIRE(SIMD::XXHash64(std::string_view {}) == 0xEF46DB3751D8E999ull);
+			REQUIRE(SIMD::XXHash64(std::string_view {"abc"}) == 0x44BC2CF5AD770999ull);
+		}
+	}
+
+	GIVEN("Strings of all lengths up to 100") {
+		some<std::string> storage;
+		for (Count i = 0; i <= 100; ++i) {
+			std::string s(i, '\0');
+			for (Count j = 0; j < i; ++j)
+				s[j] = static_cast<char>(i * 13 + j * 7);
+			storage.push_back(s);
+		}
+
+		some<std::string_view> strings(storage.begin(), storage.end());
+		some<std::uint64_t> hashes(strings.size());
+
+		WHEN("Strings of mixed lengths are hashed in a batch") {
+			SIMD::XXHash64Batch(strings, hashes, 42);
+
+			THEN("Each hash should be the XXH64 of the string") {
+				for (Count i = 0; i < strings.size(); ++i) {
+					REQUIRE(hashes[i] == ReferenceXXHash64(strings[i].data(), strings[i].size(), 42));
+					REQUIRE(hashes[i] == SIMD::XXHash64(strings[i], 42));
+				}
+			}
+		}
+
+		WHEN("Strings of equal lengths are hashed in a batch") {
+			for (Count length : {Count {0}, Count {3}, Count {31}, Count {32}, Count {77}}) {
+				some<std::string_view> equal;
+				for (Count i = 0; i < 19; ++i)
+					equal.emplace_back(storage[100 - i].data() + i % 5, length);
+				some<std::uint64_t> out(equal.size());
+				SIMD::XXHash64Batch(equal, out);
+
+				for (Count i = 0; i < equal.size(); ++i)
+					REQUIRE(out[i] == ReferenceXXHash64(equal[i].data(), length, 0));
+			}
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("64K keys and 64K strings") {
+			some<std::uint64_t> keys(1 << 16);
+			some<std::uint64_t> hashes(keys.size());
+			some<std::string> storage(keys.size());
+			some<std::string_view> strings(keys.size());
+			for (Count i = 0; i < keys.size(); ++i) {
+				keys[i] = i * 0x9E3779B97F4A7C15ull;
+				storage[i] = "key-" + std::to_string(keys[i]);
+				strings[i] = storage[i];
+			}
+
+			BENCHMARK("Integer keys (control)") {
+				for (Count i = 0; i < keys.size(); ++i)
+					hashes[i] = ReferenceXXHash64(&keys[i], 8, 0);
+				return hashes[0];
+			};
+
+			BENCHMARK("Integer keys (SIMD)") {
+				SIMD::XXHash64Span(keys, hashes);
+				return hashes[0];
+			};
+
+			BENCHMARK("Byte strings (control)") {
+				for (Count i = 0; i < strings.size(); ++i)
+					hashes[i] = ReferenceXXHash64(strings[i].data(), strings[i].size(), 0);
+				return hashes[0];
+			};
+
+			BENCHMARK("Byte strings (SIMD)") {
+				SIMD::XXHash64Batch(strings, hashes);
+				return hashes[0];
+			};
+		}
+	#endif
+}
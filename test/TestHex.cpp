@@ -0,0 +1,84 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <random>
+#include <string>
+
+/// Reference hexadecimal encoder															
+std::string ReferenceHex(const some<std::uint8_t>& bytes, bool uppercase) {
+	std::string result;
+	char digits[3];
+	for (auto byte : bytes) {
+		std::snprintf(digits, sizeof(digits), uppercase ? "%02X" : "%02x", byte);
+		result += digits;
+	}
+	return result;
+}
+
+TEST_CASE("Hexadecimal encoding and decoding", "[SIMD]") {
+	std::mt19937 rng(555);
+	std::uniform_int_distribution<unsigned> byte(0, 255);
+
+	// Sizes around every register width, so that tails always get tested
+	for (Count count : {Count {0}, Count {1}, Count {15}, Count {16}, Count {33}, Count {64}, Count {200}}) {
+		GIVEN(count << " random bytes") {
+			some<std::uint8_t> bytes(count);
+			for (auto& b : bytes)
+				b = static_cast<std::uint8_t>(byte(rng));
+
+			WHEN("Encoded in both cases and decoded back") {
+				for (bool uppercase : {false, true}) {
+					const auto expected = ReferenceHex(bytes, uppercase);
+					std::string text(2 * count, '\0');
+					REQUIRE(SIMD::HexEncode(bytes, text, uppercase) == 2 * count);
+					REQUIRE(text == expected);
+
+					some<std::uint8_t> decoded(count);
+					REQUIRE(SIMD::HexDecode(text, decoded) == count);
+					REQUIRE(decoded == bytes);
+				}
+			}
+
+			WHEN("Encoded into a smaller output") {
+				std::string text(count, '\0');
+				const auto written = SIMD::HexEncode(bytes, text);
+
+				THEN("Only whole bytes should be written") {
+					REQUIRE(written == (count / 2) * 2);
+					REQUIRE(text.substr(0, written) == ReferenceHex(bytes, false).substr(0, written));
+				}
+			}
+
+			WHEN("A character that isn't a digit is placed anywhere") {
+				THEN("Decoding should throw") {
+					const auto expected = ReferenceHex(bytes, false);
+					for (unsigned c = 0; c < 256 && count; ++c) {
+						if (SIMD::HexValue(static_cast<std::uint8_t>(c)) >= 0)
+							continue;
+
+						auto corrupted = expected;
+						std::uniform_int_distribution<Count> at(0, corrupted.size() - 1);
+						corrupted[at(rng)] = static_cast<char>(c);
+						some<std::uint8_t> decoded(count);
+						REQUIRE_THROWS_AS(SIMD::HexDecode(corrupted, decoded), Except::Encoding);
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("A text with an odd number of digits") {
+		some<std::uint8_t> decoded(4);
+
+		THEN("Decoding should throw") {
+			REQUIRE_THROWS_AS(SIMD::HexDecode(std::string("abc"), decoded), Except::Encoding);
+		}
+	}
+}
@@ -0,0 +1,158 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <limits>
+#include <random>
+
+/// Make random integers across the whole range of a type, with the				
+/// extremes at the start, where overflow is most likely								
+template<class T>
+some<T> RandomIntegers(Count count, unsigned seed) {
+	std::mt19937_64 generator {seed};
+	some<T> numbers(count);
+	for (auto& n : numbers)
+		n = static_cast<T>(generator());
+
+	using L = std::numeric_limits<T>;
+	const T edges[] {L::min(), L::max(), T {0}, L::max(), L::min(), static_cast<T>(-1)};
+	for (Count i = 0; i < count && i < 6; ++i)
+		numbers[i] = edges[(i + seed) % 6];
+	return numbers;
+}
+
+/// The rounded up average, with each half rounded down separately				
+template<class T>
+T ExpectedAverage(T a, T b) {
+	return static_cast<T>((a >> 1) + (b >> 1) + ((a | b) & 1));
+}
+
+/// The upper half of a 64-bit unsigned product, multiplied in 16-bit			
+/// digits, school style																		
+std::uint64_t SchoolMultiplyHigh(std::uint64_t a, std::uint64_t b) {
+	std::uint32_t digits[8] {};
+	for (int i = 0; i < 4; ++i) {
+		std::uint32_t carry = 0;
+		for (int j = 0; j < 4; ++j) {
+			const auto t = digits[i + j] + carry
+				+ static_cast<std::uint32_t>((a >> (16 * i)) & 0xFFFF) * static_cast<std::uint32_t>((b >> (16 * j)) & 0xFFFF);
+			digits[i + j] = t & 0xFFFF;
+			carry = t >> 16;
+		}
+		digits[i + 4] = carry;
+	}
+	return digits[4] | (std::uint64_t {digits[5]} << 16) | (std::uint64_t {digits[6]} << 32) | (std::uint64_t {digits[7]} << 48);
+}
+
+/// The upper half of the product															
+template<class T>
+T ExpectedMultiplyHigh(T a, T b) {
+	if constexpr (sizeof(T) < 8) {
+		using WIDE = std::conditional_t<CT::Signed<T>, std::int64_t, std::uint64_t>;
+		return static_cast<T>((static_cast<WIDE>(a) * static_cast<WIDE>(b)) >> (sizeof(T) * 8));
+	}
+	else {
+		// Negative numbers are 2^64 too big when seen as unsigned			
+		auto high = SchoolMultiplyHigh(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(b));
+		if constexpr (CT::Signed<T>) {
+			if (a < 0) high -= static_cast<std::uint64_t>(b);
+			if (b < 0) high -= static_cast<std::uint64_t>(a);
+		}
+		return static_cast<T>(high);
+	}
+}
+
+TEMPLATE_TEST_CASE("Average and MultiplyHigh", "[SIMD]",
+	::std::int8_t, ::std::int16_t, ::std::int32_t, ::std::int64_t,
+	::std::uint8_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t
+) {
+	using T = TestType;
+
+	for (Count count : {Count {5}, Count {64}, Count {77}}) {
+		GIVEN("Two spans of " << count << " random integers") {
+			const auto lhs = RandomIntegers<T>(count, 1);
+			const auto rhs = RandomIntegers<T>(count, 2);
+			some<T> output(count);
+
+			WHEN("Averaged") {
+				SIMD::AverageSpan(lhs, rhs, output);
+
+				THEN("The results should round up, and never overflow") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == ExpectedAverage(lhs[i], rhs[i]));
+				}
+			}
+
+			WHEN("Multiplied, keeping the upper halves") {
+				SIMD::MultiplyHighSpan(lhs, rhs, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == ExpectedMultiplyHigh(lhs[i], rhs[i]));
+				}
+			}
+		}
+	}
+
+	GIVEN("Two arrays and a scalar") {
+		const auto numbers = RandomIntegers<T>(8, 3);
+		T x[4], y[4], r[4];
+		for (Count i = 0; i < 4; ++i) {
+			x[i] = numbers[i];
+			y[i] = numbers[i + 4];
+		}
+
+		WHEN("Averaged and multiplied") {
+			SIMD::Average(x, y, r);
+			for (Count i = 0; i < 4; ++i)
+				REQUIRE(r[i] == ExpectedAverage(x[i], y[i]));
+
+			SIMD::MultiplyHigh(x, y[0], r);
+			for (Count i = 0; i < 4; ++i)
+				REQUIRE(r[i] == ExpectedMultiplyHigh(x[i], y[0]));
+		}
+
+		WHEN("Done on scalars") {
+			T a, m;
+			SIMD::Average(x[0], y[0], a);
+			SIMD::MultiplyHigh(x[1], y[1], m);
+			REQUIRE(a == ExpectedAverage(x[0], y[0]));
+			REQUIRE(m == ExpectedMultiplyHigh(x[1], y[1]));
+		}
+
+		WHEN("Wrapped in vectors") {
+			const auto a = SIMD::AverageWrap<Components<T, 4>>(x, y);
+			const auto m = SIMD::MultiplyHighWrap<Components<T, 4>>(x, y);
+			for (Count i = 0; i < 4; ++i) {
+				REQUIRE(a.mComponents[i] == ExpectedAverage(x[i], y[i]));
+				REQUIRE(m.mComponents[i] == ExpectedMultiplyHigh(x[i], y[i]));
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Average of reals", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Two spans of numbers") {
+		some<T> lhs(37), rhs(37), output(37);
+		for (Count i = 0; i < 37; ++i) {
+			lhs[i] = static_cast<T>(i) * T(1.5) - T(20);
+			rhs[i] = T(7) - static_cast<T>(i) * T(0.25);
+		}
+
+		WHEN("Averaged") {
+			SIMD::AverageSpan(lhs, rhs, output);
+
+			THEN("The results should be halfway") {
+				for (Count i = 0; i < 37; ++i)
+					REQUIRE(output[i] == (lhs[i] + rhs[i]) * T(0.5));
+			}
+		}
+	}
+}
@@ -0,0 +1,90 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+
+/// Check deinterleaving and interleaving of N components for a given count	
+template<class T, Count N>
+void CheckInterleave(Count count) {
+	some<T> stream(count * N);
+	for (Count i = 0; i < stream.size(); ++i)
+		stream[i] = static_cast<T>(i % 97 + 1);
+
+	some<T> components[N];
+	for (auto& c : components)
+		c.resize(count);
+
+	SIMD::Deinterleave<N>(stream, components);
+	for (Count i = 0; i < count; ++i) {
+		for (Count c = 0; c < N; ++c)
+			REQUIRE(components[c][i] == stream[i * N + c]);
+	}
+
+	some<T> restored(count * N);
+	SIMD::Interleave<N>(components, restored);
+	REQUIRE(restored == stream);
+}
+
+TEMPLATE_TEST_CASE("Interleave and deinterleave", "[SIMD]", ::std::int8_t, ::std::uint16_t, ::std::int32_t, float, double, ::std::uint64_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {15}, Count {33}, Count {130}}) {
+		GIVEN(count << " interleaved elements per component") {
+			WHEN("Two components are split and merged") {
+				CheckInterleave<T, 2>(count);
+			}
+
+			WHEN("Three components are split and merged") {
+				CheckInterleave<T, 3>(count);
+			}
+
+			WHEN("Four components are split and merged") {
+				CheckInterleave<T, 4>(count);
+			}
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("A large xyz stream") {
+			constexpr Count count = 4096;
+			some<T> stream(count * 3);
+			for (Count i = 0; i < stream.size(); ++i)
+				stream[i] = static_cast<T>(i % 97);
+			some<T> components[3];
+			for (auto& c : components)
+				c.resize(count);
+
+			BENCHMARK("Deinterleave<3> (control)") {
+				for (Count i = 0; i < count; ++i) {
+					for (Count c = 0; c < 3; ++c)
+						components[c][i] = stream[i * 3 + c];
+				}
+				return components[2][count - 1];
+			};
+
+			BENCHMARK("Deinterleave<3> (SIMD)") {
+				SIMD::Deinterleave<3>(stream, components);
+				return components[2][count - 1];
+			};
+
+			BENCHMARK("Interleave<3> (control)") {
+				for (Count i = 0; i < count; ++i) {
+					for (Count c = 0; c < 3; ++c)
+						stream[i * 3 + c] = components[c][i];
+				}
+				return stream[count * 3 - 1];
+			};
+
+			BENCHMARK("Interleave<3> (SIMD)") {
+				SIMD::Interleave<3>(components, stream);
+				return stream[count * 3 - 1];
+			};
+		}
+	#endif
+}
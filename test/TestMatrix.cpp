@@ -0,0 +1,239 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+
+/// Row-major reference multiplication														
+template<class T>
+void ReferenceMultiply(const T(&lhs)[16], const T(&rhs)[16], T(&output)[16]) {
+	for (Offset row = 0; row < 4; ++row) {
+		for (Offset col = 0; col < 4; ++col) {
+			output[row * 4 + col] = 0;
+			for (Offset k = 0; k < 4; ++k)
+				output[row * 4 + col] += lhs[row * 4 + k] * rhs[k * 4 + col];
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Cross product", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Two 3D vectors") {
+		const T x[3] {T {1}, T {2}, T {3}};
+		const T y[3] {T {-4}, T {5}, T {0.5}};
+		T r[3];
+
+		WHEN("The cross product is computed") {
+			SIMD::Cross(x, y, r);
+
+			THEN("The result should be correct") {
+				REQUIRE(r[0] == T {2} * T {0.5} - T {3} * T {5});
+				REQUIRE(r[1] == T {3} * T {-4} - T {1} * T {0.5});
+				REQUIRE(r[2] == T {1} * T {5} - T {2} * T {-4});
+			}
+		}
+	}
+
+	GIVEN("Two 4D vectors") {
+		const T x[4] {T {1}, T {0}, T {0}, T {7}};
+		const T y[4] {T {0}, T {1}, T {0}, T {7}};
+		T r[4];
+
+		WHEN("The cross product is computed") {
+			SIMD::Cross(x, y, r);
+
+			THEN("The result should be correct, with zero in w") {
+				REQUIRE(r[0] == T {0});
+				REQUIRE(r[1] == T {0});
+				REQUIRE(r[2] == T {1});
+				REQUIRE(r[3] == T {0});
+			}
+		}
+	}
+
+	for (Count count : {Count {3}, Count {16}, Count {37}}) {
+		GIVEN("A batch of " << count << " vector pairs as structure of arrays") {
+			some<T> lhs[3] {some<T>(count), some<T>(count), some<T>(count)};
+			some<T> rhs[3] {some<T>(count), some<T>(count), some<T>(count)};
+			some<T> output[3] {some<T>(count), some<T>(count), some<T>(count)};
+			for (Count i = 0; i < count; ++i) {
+				for (Count c = 0; c < 3; ++c) {
+					lhs[c][i] = static_cast<T>((i + c) % 5) - T {2};
+					rhs[c][i] = static_cast<T>((i * 3 + c) % 7) * T {0.5};
+				}
+			}
+
+			WHEN("The cross products are computed") {
+				SIMD::CrossSpan(lhs, rhs, output);
+
+				THEN("The results should match the single vector version") {
+					for (Count i = 0; i < count; ++i) {
+						const T l[3] {lhs[0][i], lhs[1][i], lhs[2][i]};
+						const T r[3] {rhs[0][i], rhs[1][i], rhs[2][i]};
+						T expected[3];
+						SIMD::Cross(l, r, expected);
+						REQUIRE(output[0][i] == expected[0]);
+						REQUIRE(output[1][i] == expected[1]);
+						REQUIRE(output[2][i] == expected[2]);
+					}
+				}
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("4x4 matrix kernels", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Two matrices and a vector") {
+		T a[16], b[16];
+		for (Offset i = 0; i < 16; ++i) {
+			a[i] = static_cast<T>(i) - T {5};
+			b[i] = static_cast<T>((i * 7) % 11) * T {0.25};
+		}
+		const T v[4] {T {1}, T {-2}, T {3}, T {0.5}};
+
+		WHEN("A matrix is transposed") {
+			T r[16];
+			SIMD::Transpose4x4(a, r);
+
+			THEN("The result should be correct") {
+				for (Offset row = 0; row < 4; ++row)
+					for (Offset col = 0; col < 4; ++col)
+						REQUIRE(r[col * 4 + row] == a[row * 4 + col]);
+			}
+		}
+
+		WHEN("A matrix is transposed in place") {
+			T r[16];
+			::std::memcpy(r, a, sizeof(a));
+			SIMD::Transpose4x4(r, r);
+
+			THEN("The result should be correct") {
+				for (Offset row = 0; row < 4; ++row)
+					for (Offset col = 0; col < 4; ++col)
+						REQUIRE(r[col * 4 + row] == a[row * 4 + col]);
+			}
+		}
+
+		WHEN("The matrices are multiplied") {
+			T r[16], expected[16];
+			SIMD::MatrixMultiply(a, b, r);
+			ReferenceMultiply(a, b, expected);
+
+			THEN("The result should be correct") {
+				for (Offset i = 0; i < 16; ++i)
+					REQUIRE(r[i] == Approx(expected[i]));
+			}
+		}
+
+		WHEN("The matrices are multiplied in place") {
+			T r[16], expected[16];
+			::std::memcpy(r, a, sizeof(a));
+			SIMD::MatrixMultiply(r, b, r);
+			ReferenceMultiply(a, b, expected);
+
+			THEN("The result should be correct") {
+				for (Offset i = 0; i < 16; ++i)
+					REQUIRE(r[i] == Approx(expected[i]));
+			}
+		}
+
+		WHEN("Unaligned matrices are multiplied") {
+			// Offset by one element, so that no matrix is 16-byte aligned	
+			alignas(64) T storage[16 * 3 + 1];
+			auto& ua = *reinterpret_cast<T(*)[16]>(storage + 1);
+			auto& ub = *reinterpret_cast<T(*)[16]>(storage + 17);
+			auto& ur = *reinterpret_cast<T(*)[16]>(storage + 33);
+			::std::memcpy(ua, a, sizeof(a));
+			::std::memcpy(ub, b, sizeof(b));
+			T expected[16];
+			SIMD::MatrixMultiply(ua, ub, ur);
+			ReferenceMultiply(a, b, expected);
+
+			THEN("The result should be correct") {
+				for (Offset i = 0; i < 16; ++i)
+					REQUIRE(ur[i] == Approx(expected[i]));
+			}
+		}
+
+		WHEN("An unaligned vector is transformed") {
+			alignas(64) T storage[5];
+			auto& uv = *reinterpret_cast<T(*)[4]>(storage + 1);
+			::std::memcpy(uv, v, sizeof(v));
+			T r[4];
+			SIMD::MatrixTransform(a, uv, r);
+
+			THEN("The result should be correct") {
+				for (Offset row = 0; row < 4; ++row) {
+					T expected = 0;
+					for (Offset k = 0; k < 4; ++k)
+						expected += a[row * 4 + k] * v[k];
+					REQUIRE(r[row] == Approx(expected));
+				}
+			}
+		}
+
+		WHEN("A vector is transformed") {
+			T r[4];
+			SIMD::MatrixTransform(a, v, r);
+
+			THEN("The result should be correct") {
+				for (Offset row = 0; row < 4; ++row) {
+					T expected = 0;
+					for (Offset k = 0; k < 4; ++k)
+						expected += a[row * 4 + k] * v[k];
+					REQUIRE(r[row] == Approx(expected));
+				}
+			}
+		}
+
+		for (Count count : {Count {1}, Count {8}, Count {51}}) {
+			WHEN("A batch of " << count << " points is transformed") {
+				some<T> points[3] {some<T>(count), some<T>(count), some<T>(count)};
+				for (Count i = 0; i < count; ++i)
+					for (Count c = 0; c < 3; ++c)
+						points[c][i] = static_cast<T>((i + c * 5) % 9) - T {4};
+
+				some<T> output[3] {some<T>(count), some<T>(count), some<T>(count)};
+				SIMD::TransformSpan(a, points, output);
+
+				THEN("The results should match transforming each point with w = 1") {
+					for (Count i = 0; i < count; ++i) {
+						const T p[4] {points[0][i], points[1][i], points[2][i], T {1}};
+						T expected[4];
+						SIMD::MatrixTransform(a, p, expected);
+						REQUIRE(output[0][i] == Approx(expected[0]));
+						REQUIRE(output[1][i] == Approx(expected[1]));
+						REQUIRE(output[2][i] == Approx(expected[2]));
+					}
+				}
+			}
+
+			WHEN("A batch of " << count << " homogeneous points is transformed in place") {
+				some<T> points[4] {some<T>(count), some<T>(count), some<T>(count), some<T>(count)};
+				for (Count i = 0; i < count; ++i)
+					for (Count c = 0; c < 4; ++c)
+						points[c][i] = static_cast<T>((i + c * 3) % 7) - T {3};
+				some<T> original[4] {points[0], points[1], points[2], points[3]};
+
+				SIMD::TransformSpan(a, points, points);
+
+				THEN("The results should match transforming each point") {
+					for (Count i = 0; i < count; ++i) {
+						const T p[4] {original[0][i], original[1][i], original[2][i], original[3][i]};
+						T expected[4];
+						SIMD::MatrixTransform(a, p, expected);
+						for (Count c = 0; c < 4; ++c)
+							REQUIRE(points[c][i] == Approx(expected[c]));
+					}
+				}
+			}
+		}
+	}
+}
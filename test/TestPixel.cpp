@@ -0,0 +1,161 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <random>
+
+/// Make a pixel out of its channels														
+constexpr SIMD::Pixel MakePixel(unsigned r, unsigned g, unsigned b, unsigned a) {
+	return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+/// Get a channel of a pixel																	
+constexpr unsigned Channel(SIMD::Pixel px, int c) {
+	return (px >> (c * 8)) & 0xFF;
+}
+
+/// Make random pixels, with the alphas that are easiest to get wrong among them
+some<SIMD::Pixel> RandomPixels(Count count, unsigned seed) {
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<std::uint32_t> distribution;
+	some<SIMD::Pixel> pixels(count);
+	for (auto& px : pixels)
+		px = distribution(generator);
+
+	const unsigned alphas[] {0, 1, 127, 128, 254, 255};
+	for (Count i = 0; i < count && i < 6; ++i)
+		pixels[i] = (pixels[i] & 0xFFFFFF) | (alphas[i] << 24);
+	return pixels;
+}
+
+TEST_CASE("Pixel kernels", "[SIMD]") {
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {7}, Count {33}, Count {131}}) {
+		GIVEN("Two spans of " << count << " random pixels") {
+			const auto src = RandomPixels(count, 3);
+			const auto dst = RandomPixels(count, 5);
+			some<SIMD::Pixel> output(count);
+
+			WHEN("Premultiplied") {
+				SIMD::PremultiplySpan(src, output);
+
+				THEN("Color should be scaled by alpha, rounding down") {
+					for (Count i = 0; i < count; ++i) {
+						const auto a = Channel(src[i], 3);
+						REQUIRE(Channel(output[i], 3) == a);
+						for (int c = 0; c < 3; ++c)
+							REQUIRE(Channel(output[i], c) == Channel(src[i], c) * a / 255);
+					}
+				}
+			}
+
+			WHEN("Unpremultiplied") {
+				SIMD::UnpremultiplySpan(src, output);
+
+				THEN("Color should be divided by alpha, rounding to nearest") {
+					for (Count i = 0; i < count; ++i) {
+						const auto a = Channel(src[i], 3);
+						REQUIRE(Channel(output[i], 3) == a);
+						for (int c = 0; c < 3; ++c) {
+							const auto expected = a ? std::nearbyint(std::fmin(Channel(src[i], c) * (255.0f / a), 255.0f)) : 0.0f;
+							REQUIRE(Channel(output[i], c) == static_cast<unsigned>(expected));
+						}
+					}
+				}
+			}
+
+			WHEN("Premultiplied and unpremultiplied in place") {
+				auto data = src;
+				for (auto& px : data)
+					px |= 0xFF000000;
+				const auto opaque = data;
+				SIMD::PremultiplySpan(data);
+				SIMD::UnpremultiplySpan(data);
+
+				THEN("Opaque pixels should be restored") {
+					REQUIRE(data == opaque);
+				}
+			}
+
+			WHEN("Composited with the 'over' operator") {
+				some<SIMD::Pixel> premultiplied(count);
+				SIMD::PremultiplySpan(src, premultiplied);
+				SIMD::OverSpan(premultiplied, dst, output);
+
+				THEN("The destination should show through by one minus source alpha") {
+					for (Count i = 0; i < count; ++i) {
+						const auto inv = 255 - Channel(premultiplied[i], 3);
+						for (int c = 0; c < 4; ++c) {
+							const auto expected = Channel(premultiplied[i], c) + Channel(dst[i], c) * inv / 255;
+							REQUIRE(Channel(output[i], c) == std::min(expected, 255u));
+						}
+					}
+				}
+			}
+
+			WHEN("Interpolated") {
+				for (unsigned t : {0u, 1u, 100u, 254u, 255u}) {
+					SIMD::LerpSpan(src, dst, static_cast<std::uint8_t>(t), output);
+					for (Count i = 0; i < count; ++i) {
+						for (int c = 0; c < 4; ++c)
+							REQUIRE(Channel(output[i], c) == (Channel(src[i], c) * (255 - t) + Channel(dst[i], c) * t) / 255);
+					}
+				}
+
+				THEN("Both ends should be exact") {
+					SIMD::LerpSpan(src, dst, 0, output);
+					REQUIRE(output == src);
+					SIMD::LerpSpan(src, dst, 255, output);
+					REQUIRE(output == dst);
+				}
+			}
+
+			WHEN("Red and blue are swapped") {
+				SIMD::SwapRedBlueSpan(src, output);
+
+				THEN("Green and alpha should stay where they are") {
+					for (Count i = 0; i < count; ++i) {
+						REQUIRE(output[i] == MakePixel(Channel(src[i], 2), Channel(src[i], 1), Channel(src[i], 0), Channel(src[i], 3)));
+						REQUIRE(SIMD::SwapRedBlueFallback(output[i]) == src[i]);
+					}
+				}
+			}
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("A 1920x1080 frame") {
+			constexpr Count count = 1920 * 1080;
+			const auto src = RandomPixels(count, 3);
+			some<SIMD::Pixel> dst = RandomPixels(count, 5);
+
+			BENCHMARK("Over (control)") {
+				for (Count i = 0; i < count; ++i)
+					dst[i] = SIMD::OverFallback(src[i], dst[i]);
+				return dst[count - 1];
+			};
+
+			BENCHMARK("Over (SIMD)") {
+				SIMD::OverSpan(src, dst, dst);
+				return dst[count - 1];
+			};
+
+			BENCHMARK("Premultiply (control)") {
+				for (Count i = 0; i < count; ++i)
+					dst[i] = SIMD::PremultiplyFallback(src[i]);
+				return dst[count - 1];
+			};
+
+			BENCHMARK("Premultiply (SIMD)") {
+				SIMD::PremultiplySpan(src, dst);
+				return dst[count - 1];
+			};
+		}
+	#endif
+}
@@ -0,0 +1,175 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+
+/// Reference Hamilton product, quaternions in [x, y, z, w] order					
+template<class T>
+void ReferenceHamilton(const T(&a)[4], const T(&b)[4], T(&r)[4]) {
+	r[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+	r[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+	r[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+	r[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+}
+
+/// Make a deterministic unit quaternion, rotating around an arbitrary axis	
+template<class T>
+void MakeRotation(Count seed, T(&q)[4]) {
+	const T angle = static_cast<T>(seed % 13) * T {0.45} - T {2.5};
+	T axis[3] {
+		static_cast<T>(seed % 7) - T {3},
+		static_cast<T>(seed % 5) + T {1},
+		static_cast<T>(seed % 3) - T {1}
+	};
+	const T length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+	const T s = std::sin(angle / T {2}) / length;
+	q[0] = axis[0] * s;
+	q[1] = axis[1] * s;
+	q[2] = axis[2] * s;
+	q[3] = std::cos(angle / T {2});
+}
+
+TEMPLATE_TEST_CASE("Quaternion multiply and rotate", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Two unit quaternions") {
+		T a[4], b[4], r[4], expected[4];
+		MakeRotation(3, a);
+		MakeRotation(8, b);
+		ReferenceHamilton(a, b, expected);
+
+		WHEN("They are multiplied") {
+			SIMD::QuaternionMultiply(a, b, r);
+
+			THEN("The result should be correct") {
+				for (Count c = 0; c < 4; ++c)
+					REQUIRE(r[c] == Approx(expected[c]).margin(1e-6));
+			}
+		}
+
+		WHEN("They are multiplied in place") {
+			SIMD::QuaternionMultiply(a, b, a);
+
+			THEN("The result should be correct") {
+				for (Count c = 0; c < 4; ++c)
+					REQUIRE(a[c] == Approx(expected[c]).margin(1e-6));
+			}
+		}
+
+		WHEN("A vector is rotated") {
+			const T v[3] {T {1}, T {-2}, T {0.5}};
+			T rotated[3];
+			SIMD::QuaternionRotate(a, v, rotated);
+
+			THEN("The result should match q * v * conjugate(q)") {
+				const T pure[4] {v[0], v[1], v[2], T {0}};
+				const T conjugate[4] {-a[0], -a[1], -a[2], a[3]};
+				T temp[4];
+				ReferenceHamilton(a, pure, temp);
+				ReferenceHamilton(temp, conjugate, expected);
+				for (Count c = 0; c < 3; ++c)
+					REQUIRE(rotated[c] == Approx(expected[c]).margin(1e-5));
+			}
+		}
+	}
+
+	for (Count count : {Count {1}, Count {9}, Count {37}}) {
+		GIVEN("Batches of " << count << " quaternions and vectors") {
+			some<T> a[4], b[4], v[3], r[4];
+			for (Count c = 0; c < 4; ++c) {
+				a[c].resize(count);
+				b[c].resize(count);
+				r[c].resize(count);
+			}
+			for (Count c = 0; c < 3; ++c)
+				v[c].resize(count);
+
+			for (Count i = 0; i < count; ++i) {
+				T qa[4], qb[4];
+				MakeRotation(i, qa);
+				MakeRotation(i * 5 + 1, qb);
+				for (Count c = 0; c < 4; ++c) {
+					a[c][i] = qa[c];
+					b[c][i] = qb[c];
+				}
+				for (Count c = 0; c < 3; ++c)
+					v[c][i] = static_cast<T>((i + c) % 9) - T {4};
+			}
+
+			WHEN("The batches are multiplied") {
+				SIMD::QuaternionMultiplySpan(a, b, r);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						const T qa[4] {a[0][i], a[1][i], a[2][i], a[3][i]};
+						const T qb[4] {b[0][i], b[1][i], b[2][i], b[3][i]};
+						T expected[4];
+						ReferenceHamilton(qa, qb, expected);
+						for (Count c = 0; c < 4; ++c)
+							REQUIRE(r[c][i] == Approx(expected[c]).margin(1e-6));
+					}
+				}
+			}
+
+			WHEN("The vectors are rotated") {
+				some<T> rotated[3];
+				for (Count c = 0; c < 3; ++c)
+					rotated[c].resize(count);
+				SIMD::QuaternionRotateSpan(a, v, rotated);
+
+				THEN("The results should match the single version") {
+					for (Count i = 0; i < count; ++i) {
+						const T q[4] {a[0][i], a[1][i], a[2][i], a[3][i]};
+						const T p[3] {v[0][i], v[1][i], v[2][i]};
+						T expected[3];
+						SIMD::QuaternionRotate(q, p, expected);
+						for (Count c = 0; c < 3; ++c)
+							REQUIRE(rotated[c][i] == Approx(expected[c]).margin(1e-5));
+					}
+				}
+			}
+
+			WHEN("The batches are interpolated") {
+				SIMD::QuaternionSlerpSpan(a, b, T {0.3}, r);
+
+				THEN("The results should be unit quaternions matching the single version") {
+					for (Count i = 0; i < count; ++i) {
+						const T qa[4] {a[0][i], a[1][i], a[2][i], a[3][i]};
+						const T qb[4] {b[0][i], b[1][i], b[2][i], b[3][i]};
+						T expected[4];
+						SIMD::QuaternionSlerp(qa, qb, T {0.3}, expected);
+
+						T length {};
+						for (Count c = 0; c < 4; ++c) {
+							REQUIRE(r[c][i] == Approx(expected[c]).margin(1e-4));
+							length += r[c][i] * r[c][i];
+						}
+						REQUIRE(length == Approx(T {1}).margin(1e-4));
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("Two quaternions on opposite hemispheres") {
+		T a[4], b[4], r[4];
+		MakeRotation(2, a);
+		for (Count c = 0; c < 4; ++c)
+			b[c] = -a[c];
+
+		WHEN("They are interpolated") {
+			SIMD::QuaternionSlerp(a, b, T {0.5}, r);
+
+			THEN("The shortest arc should be taken, giving the same rotation") {
+				for (Count c = 0; c < 4; ++c)
+					REQUIRE(r[c] == Approx(a[c]).margin(1e-4));
+			}
+		}
+	}
+}
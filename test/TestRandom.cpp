@@ -0,0 +1,187 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <bit>
+#include <cstring>
+#include <random>
+
+/// Reference engine - the eight xoshiro256++ streams, stepped one at a time	
+struct ReferenceRandom {
+	std::uint64_t s[8][4];
+
+	ReferenceRandom(std::uint64_t seed, std::uint64_t stream) {
+		const auto splitmix = [](std::uint64_t& x) {
+			x += 0x9E3779B97F4A7C15ull;
+			auto z = x;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		};
+		auto x = seed ^ splitmix(stream);
+		for (auto& lane : s)
+			for (auto& word : lane)
+				word = splitmix(x);
+	}
+
+	/// Get the next block of 64 random bytes												
+	void Next(std::uint64_t(&block)[8]) {
+		const auto rotl = [](std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+		for (int lane = 0; lane < 8; ++lane) {
+			auto& v = s[lane];
+			block[lane] = rotl(v[0] + v[3], 23) + v[0];
+			const auto t = v[1] << 17;
+			v[2] ^= v[0];
+			v[3] ^= v[1];
+			v[1] ^= v[2];
+			v[0] ^= v[3];
+			v[2] ^= t;
+			v[3] = rotl(v[3], 45);
+		}
+	}
+
+	/// Get the random bytes of a number of blocks										
+	some<std::uint8_t> Bytes(Count blocks) {
+		some<std::uint8_t> bytes(blocks * 64);
+		for (Count b = 0; b < blocks; ++b) {
+			std::uint64_t block[8];
+			Next(block);
+			std::memcpy(bytes.data() + b * 64, block, 64);
+		}
+		return bytes;
+	}
+};
+
+TEMPLATE_TEST_CASE("Random numbers", "[SIMD]", std::uint64_t, std::int32_t, std::uint16_t, float, double) {
+	using T = TestType;
+
+	for (Count count : {Count {5}, Count {64}, Count {100}, Count {1000}}) {
+		GIVEN(count << " numbers") {
+			some<T> numbers(count);
+			SIMD::RandomEngine engine {1234, 5};
+			ReferenceRandom reference {1234, 5};
+			constexpr Count perBlock = 64 / sizeof(T);
+			const Count blocks = (count + perBlock - 1) / perBlock;
+
+			WHEN("The span is filled twice") {
+				SIMD::RandomSpan(engine, numbers);
+				const auto first = reference.Bytes(blocks);
+				auto second = numbers;
+				SIMD::RandomSpan(engine, second);
+				const auto next = reference.Bytes(blocks);
+
+				THEN("The numbers should come from consecutive whole blocks of the streams") {
+					for (Count i = 0; i < count; ++i) {
+						if constexpr (CT::Real<T>) {
+							using U = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+							U bits1, bits2;
+							std::memcpy(&bits1, first.data() + i * sizeof(T), sizeof(T));
+							std::memcpy(&bits2, next.data() + i * sizeof(T), sizeof(T));
+							const int shift = sizeof(T) == 4 ? 9 : 12;
+							const U one = sizeof(T) == 4 ? U(0x3F800000u) : U(0x3FF0000000000000ull);
+							REQUIRE(numbers[i] == std::bit_cast<T>((bits1 >> shift) | one) - T {1});
+							REQUIRE(second[i] == std::bit_cast<T>((bits2 >> shift) | one) - T {1});
+							REQUIRE(numbers[i] >= T {0});
+							REQUIRE(numbers[i] < T {1});
+						}
+						else {
+							REQUIRE(std::memcmp(&numbers[i], first.data() + i * sizeof(T), sizeof(T)) == 0);
+							REQUIRE(std::memcmp(&second[i], next.data() + i * sizeof(T), sizeof(T)) == 0);
+						}
+					}
+				}
+			}
+
+			WHEN("Engines are seeded with different streams") {
+				SIMD::RandomEngine other {1234, 6};
+				auto different = numbers;
+				SIMD::RandomSpan(engine, numbers);
+				SIMD::RandomSpan(other, different);
+
+				THEN("The numbers should differ") {
+					REQUIRE(numbers != different);
+				}
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Normally distributed random numbers", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Numbers with a mean of 3 and a standard deviation of 2") {
+		some<T> numbers(100000 + 7);
+		SIMD::RandomEngine engine {42};
+		SIMD::RandomNormalSpan(engine, numbers, T {3}, T {2});
+
+		THEN("Each pair of blocks should come from Box-Muller over the uniform streams") {
+			constexpr Count perBlock = 64 / sizeof(T);
+			SIMD::RandomEngine uniform {42};
+			some<T> u(numbers.size() + 2 * perBlock);
+			SIMD::RandomSpan(uniform, u);
+
+			// Lanes step twice per pair - the first block gives the radii,
+			// the second block gives the angles									
+			for (Count i = 0; i < 2000; ++i) {
+				const Count pair = i / (2 * perBlock);
+				const Count at = i % perBlock;
+				const Count u1At = pair * 2 * perBlock + at;
+				const Count u2At = u1At + perBlock;
+				const T radius = std::sqrt(T {-2} * std::log(T {1} - u[u1At])) * T {2};
+				const T angle = u[u2At] * static_cast<T>(6.283185307179586);
+				const bool sine = i % (2 * perBlock) >= perBlock;
+				const T expected = T {3} + radius * (sine ? std::sin(angle) : std::cos(angle));
+				REQUIRE(numbers[i] == Approx(expected).margin(1e-4));
+			}
+		}
+
+		THEN("The sample mean and deviation should match") {
+			double sum = 0, squares = 0;
+			for (auto n : numbers) {
+				sum += n;
+				squares += double(n) * n;
+			}
+			const double mean = sum / numbers.size();
+			const double deviation = std::sqrt(squares / numbers.size() - mean * mean);
+			REQUIRE(mean == Approx(3.0).margin(0.03));
+			REQUIRE(deviation == Approx(2.0).margin(0.03));
+		}
+	}
+
+	#ifdef LANGULUS_STD_BENCHMARK
+		GIVEN("1M numbers") {
+			some<T> numbers(1 << 20);
+			SIMD::RandomEngine engine {1};
+			std::mt19937_64 control {1};
+
+			BENCHMARK("Uniform (control)") {
+				std::uniform_real_distribution<T> distribution;
+				for (auto& n : numbers)
+					n = distribution(control);
+				return numbers[0];
+			};
+
+			BENCHMARK("Uniform (SIMD)") {
+				SIMD::RandomSpan(engine, numbers);
+				return numbers[0];
+			};
+
+			BENCHMARK("Normal (control)") {
+				std::normal_distribution<T> distribution;
+				for (auto& n : numbers)
+					n = distribution(control);
+				return numbers[0];
+			};
+
+			BENCHMARK("Normal (SIMD)") {
+				SIMD::RandomNormalSpan(engine, numbers);
+				return numbers[0];
+			};
+		}
+	#endif
+}
@@ -0,0 +1,306 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <limits>
+
+/// Fill a container with a deterministic mix of positive and negative values	
+template<class T>
+some<T> MakeMixed(Count count) {
+	some<T> result(count);
+	for (Count i = 0; i < count; ++i) {
+		const auto n = static_cast<int>(i % 23) - 11;
+		if constexpr (CT::Real<T>)
+			result[i] = static_cast<T>(n) * T {0.75};
+		else
+			result[i] = static_cast<T>(n);
+	}
+	return result;
+}
+
+TEMPLATE_TEST_CASE("Truncate, Fract and CopySign", "[SIMD]", float, double) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {7}, Count {19}, Count {67}}) {
+		GIVEN("A span of " << count << " mixed numbers") {
+			const auto input = MakeMixed<T>(count);
+			some<T> output(count);
+
+			WHEN("The numbers are truncated") {
+				SIMD::TruncateSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == std::trunc(input[i]));
+				}
+			}
+
+			WHEN("The numbers are truncated in place") {
+				auto data = input;
+				SIMD::TruncateSpan(data);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(data[i] == std::trunc(input[i]));
+				}
+			}
+
+			WHEN("The fractional parts are taken") {
+				SIMD::FractSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						REQUIRE(output[i] >= T {0});
+						REQUIRE(output[i] < T {1});
+						REQUIRE(output[i] == input[i] - std::floor(input[i]));
+					}
+				}
+			}
+
+			WHEN("The signs are copied from a negated span") {
+				some<T> signs(count);
+				for (Count i = 0; i < count; ++i)
+					signs[i] = i % 2 ? T {-1} : T {1};
+				SIMD::CopySignSpan(input, signs, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == std::copysign(input[i], signs[i]));
+				}
+			}
+		}
+	}
+
+	GIVEN("Two arrays") {
+		const T x[3] {T {-2.5}, T {3.75}, T {0}};
+		const T y[3] {T {1}, T {-1}, T {-1}};
+		T r[3];
+
+		WHEN("The signs are copied") {
+			SIMD::CopySign(x, y, r);
+
+			THEN("The results should be correct") {
+				REQUIRE(r[0] == T {2.5});
+				REQUIRE(r[1] == T {-3.75});
+				REQUIRE(std::signbit(r[2]));
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Round, Floor and Ceil", "[SIMD]", float, double) {
+	using T = TestType;
+
+	for (Count count : {Count {3}, Count {16}, Count {45}, Count {1001}}) {
+		GIVEN("A span of " << count << " mixed numbers") {
+			const auto input = MakeMixed<T>(count);
+			some<T> output(count);
+
+			WHEN("The numbers are rounded") {
+				SIMD::RoundSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == std::nearbyint(input[i]));
+				}
+			}
+
+			WHEN("The numbers are floored in place") {
+				auto data = input;
+				SIMD::FloorSpan(data);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(data[i] == std::floor(input[i]));
+				}
+			}
+
+			WHEN("The numbers are ceiled") {
+				SIMD::CeilSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == std::ceil(input[i]));
+				}
+			}
+		}
+	}
+
+	GIVEN("An array") {
+		const T x[3] {T {-2.25}, T {3.75}, T {0.5}};
+		T r[3];
+
+		WHEN("The array is floored into another array") {
+			SIMD::Floor(x, r);
+
+			THEN("The results should be correct") {
+				REQUIRE(r[0] == T {-3});
+				REQUIRE(r[1] == T {3});
+				REQUIRE(r[2] == T {0});
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Abs", "[SIMD]", SIGNED_TYPES()) {
+	using T = TestType;
+
+	for (Count count : {Count {5}, Count {64}, Count {77}}) {
+		GIVEN("A span of " << count << " mixed numbers") {
+			const auto input = MakeMixed<T>(count);
+			some<T> output(count);
+
+			WHEN("The absolute values are taken") {
+				SIMD::AbsSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(output[i] == (input[i] < T {0} ? static_cast<T>(-input[i]) : input[i]));
+				}
+			}
+
+			WHEN("The absolute values are taken in place") {
+				auto data = input;
+				SIMD::AbsSpan(data);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i)
+						REQUIRE(data[i] == (input[i] < T {0} ? static_cast<T>(-input[i]) : input[i]));
+				}
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Sign", "[SIMD]", SIGNED_TYPES()) {
+	using T = TestType;
+
+	for (Count count : {Count {5}, Count {33}, Count {130}}) {
+		GIVEN("A span of " << count << " mixed numbers") {
+			const auto input = MakeMixed<T>(count);
+			some<T> output(count);
+
+			WHEN("The signs are taken") {
+				SIMD::SignSpan(input, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						const T expected = input[i] > T {0} ? T {1} : input[i] < T {0} ? T {-1} : T {0};
+						REQUIRE(output[i] == expected);
+					}
+				}
+			}
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Mod", "[SIMD]", SIGNED_TYPES(), ::std::uint8_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t) {
+	using T = TestType;
+
+	for (Count count : {Count {3}, Count {17}, Count {70}}) {
+		GIVEN("Spans of " << count << " dividends and divisors") {
+			some<T> lhs(count), rhs(count), output(count);
+			for (Count i = 0; i < count; ++i) {
+				lhs[i] = static_cast<T>(i * 7 + 3);
+				rhs[i] = static_cast<T>(i % 5 + 2);
+			}
+
+			WHEN("The remainders are taken") {
+				SIMD::ModSpan(lhs, rhs, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						if constexpr (CT::Real<T>)
+							REQUIRE(output[i] == std::fmod(lhs[i], rhs[i]));
+						else
+							REQUIRE(output[i] == static_cast<T>(lhs[i] % rhs[i]));
+					}
+				}
+			}
+
+			WHEN("A divisor is zero") {
+				rhs[count - 1] = T {0};
+
+				THEN("Division by zero should be reported") {
+					REQUIRE_THROWS(SIMD::ModSpan(lhs, rhs, output));
+				}
+			}
+		}
+	}
+
+	if constexpr (CT::Signed<T>) {
+		GIVEN("Two numbers of different signs") {
+			const T x = T {-7};
+			const T y = T {3};
+			T r;
+
+			WHEN("The remainder is taken") {
+				SIMD::Mod(x, y, r);
+
+				THEN("The result should have the sign of the dividend") {
+					REQUIRE(r == T {-1});
+				}
+			}
+		}
+	}
+
+	GIVEN("Two arrays of four numbers") {
+		const T x[4] {T {9}, T {10}, T {11}, T {12}};
+		const T y[4] {T {4}, T {3}, T {2}, T {5}};
+
+		WHEN("The remainders are wrapped in a vector") {
+			const auto v = SIMD::ModWrap<Components<T, 4>>(x, y);
+
+			THEN("The results should be correct") {
+				REQUIRE(v.mComponents[0] == T {1});
+				REQUIRE(v.mComponents[1] == T {1});
+				REQUIRE(v.mComponents[2] == T {1});
+				REQUIRE(v.mComponents[3] == T {2});
+			}
+		}
+	}
+
+	if constexpr (CT::Real<T>) {
+		GIVEN("Dividends that aren't exact multiples of a small divisor") {
+			// lhs - trunc(lhs / rhs) * rhs differs from std::fmod for all	
+			// of these, except for the last one with doubles					
+			const T x[4] {T(5.3), T(-5.3), T(1e6 + 0.7), T(0.3)};
+			const T y[4] {T(0.1), T(0.1), T(0.3), T(0.1)};
+			T r[4];
+
+			WHEN("The remainders are taken") {
+				SIMD::Mod(x, y, r);
+
+				THEN("They should be exactly the same as std::fmod's") {
+					for (Count i = 0; i < 4; ++i)
+						REQUIRE(r[i] == std::fmod(x[i], y[i]));
+				}
+			}
+		}
+
+		GIVEN("Quotients too big for the mantissa, and infinite divisors") {
+			constexpr T inf = std::numeric_limits<T>::infinity();
+			const T x[4] {T(1e30), T(-7.5), T(-0.0), T(2.5)};
+			const T y[4] {T(0.3), inf, T(0.7), T(-2.5)};
+			T r[4];
+
+			WHEN("The remainders are taken") {
+				SIMD::Mod(x, y, r);
+
+				THEN("They should be exactly the same as std::fmod's, signs included") {
+					for (Count i = 0; i < 4; ++i) {
+						REQUIRE(r[i] == std::fmod(x[i], y[i]));
+						REQUIRE(std::signbit(r[i]) == std::signbit(std::fmod(x[i], y[i])));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+
+TEMPLATE_TEST_CASE("Inclusive and exclusive scan", "[SIMD]", SIGNED_TYPES(), ::std::uint8_t, ::std::uint16_t, ::std::uint32_t, ::std::uint64_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested, and unsigned bytes		
+	// are certain to wrap around														
+	for (Count count : {Count {1}, Count {15}, Count {33}, Count {333}}) {
+		GIVEN("A span of " << count << " small numbers") {
+			some<T> input(count), output(count);
+			for (Count i = 0; i < count; ++i)
+				input[i] = static_cast<T>(i % 5 + 1);
+
+			WHEN("The inclusive scan is taken") {
+				SIMD::InclusiveScan(input, output, T {3});
+
+				THEN("The results should be correct") {
+					T sum {3};
+					for (Count i = 0; i < count; ++i) {
+						sum = static_cast<T>(sum + input[i]);
+						REQUIRE(output[i] == sum);
+					}
+				}
+			}
+
+			WHEN("The exclusive scan is taken in place") {
+				auto data = input;
+				SIMD::ExclusiveScan(data, data);
+
+				THEN("The results should be correct") {
+					T sum {};
+					for (Count i = 0; i < count; ++i) {
+						REQUIRE(data[i] == sum);
+						sum = static_cast<T>(sum + input[i]);
+					}
+				}
+			}
+
+			WHEN("The inclusive scan is taken on multiple threads") {
+				SIMD::InclusiveScanParallel(input, output, T {3}, 4);
+
+				THEN("The results should match the single-threaded scan") {
+					some<T> expected(count);
+					SIMD::InclusiveScan(input, expected, T {3});
+					REQUIRE(output == expected);
+				}
+			}
+		}
+	}
+}
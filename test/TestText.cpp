@@ -0,0 +1,67 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <algorithm>
+
+TEMPLATE_TEST_CASE("Character search", "[SIMD]", char, char8_t, char16_t, char32_t, wchar_t) {
+	using T = TestType;
+
+	// Odd sizes, so that tails always get tested								
+	for (Count count : {Count {1}, Count {17}, Count {100}, Count {301}}) {
+		GIVEN("A text of " << count << " characters") {
+			some<T> text(count);
+			for (Count i = 0; i < count; ++i)
+				text[i] = static_cast<T>('a' + i % 26);
+
+			WHEN("Characters are searched and counted") {
+				THEN("The results should match the standard library") {
+					for (T c : {T('a'), T('m'), T('z'), T('#')}) {
+						REQUIRE(SIMD::FindChar(text, c) == Offset(std::find(text.begin(), text.end(), c) - text.begin()));
+						REQUIRE(SIMD::CountChar(text, c) == Count(std::count(text.begin(), text.end(), c)));
+					}
+				}
+			}
+
+			WHEN("Any of a set of characters is searched") {
+				const T set[] {T('#'), T('x'), T('q'), T('~')};
+				const T missing[] {T('#'), T('~'), T('0'), T('A'), T('Z'), T('!'), T('@'), T('_'), T('|')};
+
+				THEN("The results should match the standard library") {
+					REQUIRE(SIMD::FindAnyOf(text, set) == Offset(std::find_first_of(text.begin(), text.end(), std::begin(set), std::end(set)) - text.begin()));
+					REQUIRE(SIMD::FindAnyOf(text, missing) == count);
+				}
+			}
+
+			WHEN("The length of the null-terminated text is taken, at every alignment") {
+				some<T> buffer(count + 64, T {0});
+				for (Count start = 0; start < 16; ++start) {
+					std::fill(buffer.begin(), buffer.end(), T('.'));
+					std::copy(text.begin(), text.end(), buffer.begin() + start);
+					buffer[start + count] = T {0};
+					REQUIRE(SIMD::StringLength(buffer.data() + start) == count);
+				}
+			}
+		}
+	}
+
+	GIVEN("A byte set with more than eight distinct high nibbles") {
+		if constexpr (sizeof(T) == 1) {
+			some<T> text(200);
+			for (Count i = 0; i < text.size(); ++i)
+				text[i] = static_cast<T>(0x20 + i % 8);
+			text[150] = static_cast<T>(0xF3);
+
+			const T set[] {T(0x01), T(0x13), T(0x35), T(0x47), T(0x59), T(0x6B), T(0x7D), T(0x8F), T(0x91), T(0xF3)};
+
+			THEN("Both nibble table groups should be used") {
+				REQUIRE(SIMD::FindAnyOf(text, set) == 150);
+			}
+		}
+	}
+}
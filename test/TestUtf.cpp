@@ -0,0 +1,208 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <random>
+
+/// Reference UTF-8 validator, written as a plain state machine					
+bool ReferenceValidUtf8(const some<char8_t>& text) {
+	Count i = 0;
+	while (i < text.size()) {
+		const unsigned c = text[i];
+		Count length;
+		unsigned min, cp;
+		if (c < 0x80)					{ ++i; continue; }
+		else if ((c >> 5) == 0x6)	{ length = 2; min = 0x80;    cp = c & 0x1F; }
+		else if ((c >> 4) == 0xE)	{ length = 3; min = 0x800;   cp = c & 0x0F; }
+		else if ((c >> 3) == 0x1E)	{ length = 4; min = 0x10000; cp = c & 0x07; }
+		else return false;
+
+		if (i + length > text.size())
+			return false;
+		for (Count k = 1; k < length; ++k) {
+			if ((text[i + k] & 0xC0) != 0x80)
+				return false;
+			cp = (cp << 6) | (text[i + k] & 0x3F);
+		}
+
+		if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+			return false;
+		i += length;
+	}
+	return true;
+}
+
+/// Reference encoders, one code point at a time										
+void ReferenceEncode(char32_t cp, some<char8_t>& out) {
+	if (cp < 0x80)
+		out.push_back(static_cast<char8_t>(cp));
+	else if (cp < 0x800) {
+		out.push_back(static_cast<char8_t>(0xC0 | (cp >> 6)));
+		out.push_back(static_cast<char8_t>(0x80 | (cp & 0x3F)));
+	}
+	else if (cp < 0x10000) {
+		out.push_back(static_cast<char8_t>(0xE0 | (cp >> 12)));
+		out.push_back(static_cast<char8_t>(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back(static_cast<char8_t>(0x80 | (cp & 0x3F)));
+	}
+	else {
+		out.push_back(static_cast<char8_t>(0xF0 | (cp >> 18)));
+		out.push_back(static_cast<char8_t>(0x80 | ((cp >> 12) & 0x3F)));
+		out.push_back(static_cast<char8_t>(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back(static_cast<char8_t>(0x80 | (cp & 0x3F)));
+	}
+}
+
+void ReferenceEncode(char32_t cp, some<char16_t>& out) {
+	if (cp < 0x10000)
+		out.push_back(static_cast<char16_t>(cp));
+	else {
+		out.push_back(static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10)));
+		out.push_back(static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+	}
+}
+
+void ReferenceEncode(char32_t cp, some<char32_t>& out) {
+	out.push_back(cp);
+}
+
+/// Generate random code points, mostly ASCII with bursts of everything else	
+some<char32_t> RandomCodePoints(std::mt19937& rng, Count count) {
+	some<char32_t> result;
+	std::uniform_int_distribution<unsigned> kind(0, 9);
+	std::uniform_int_distribution<unsigned> ascii(0x01, 0x7F);
+	std::uniform_int_distribution<unsigned> two(0x80, 0x7FF);
+	std::uniform_int_distribution<unsigned> three(0x800, 0xFFFF);
+	std::uniform_int_distribution<unsigned> four(0x10000, 0x10FFFF);
+	while (result.size() < count) {
+		char32_t cp;
+		switch (kind(rng)) {
+		case 0: cp = two(rng); break;
+		case 1: cp = three(rng); break;
+		case 2: cp = four(rng); break;
+		default: cp = ascii(rng);
+		}
+
+		if (cp >= 0xD800 && cp <= 0xDFFF)
+			continue;
+		result.push_back(cp);
+	}
+	return result;
+}
+
+TEST_CASE("UTF-8 validation", "[SIMD]") {
+	std::mt19937 rng(1234);
+
+	GIVEN("Random valid UTF-8 texts") {
+		for (Count count : {Count {0}, Count {5}, Count {16}, Count {77}, Count {500}}) {
+			some<char8_t> text;
+			for (auto cp : RandomCodePoints(rng, count))
+				ReferenceEncode(cp, text);
+
+			REQUIRE(SIMD::ValidateUtf8(text));
+
+			WHEN("Random bytes are corrupted") {
+				std::uniform_int_distribution<unsigned> byte(0, 255);
+				for (int attempt = 0; attempt < 200 && !text.empty(); ++attempt) {
+					auto corrupted = text;
+					std::uniform_int_distribution<Count> at(0, corrupted.size() - 1);
+					corrupted[at(rng)] = static_cast<char8_t>(byte(rng));
+					REQUIRE(SIMD::ValidateUtf8(corrupted) == ReferenceValidUtf8(corrupted));
+				}
+			}
+
+			WHEN("The text is truncated") {
+				for (Count cut = 1; cut < 4 && cut <= text.size(); ++cut) {
+					some<char8_t> truncated(text.begin(), text.end() - cut);
+					REQUIRE(SIMD::ValidateUtf8(truncated) == ReferenceValidUtf8(truncated));
+				}
+			}
+		}
+	}
+
+	GIVEN("Completely random bytes") {
+		std::uniform_int_distribution<unsigned> byte(0, 255);
+		for (int attempt = 0; attempt < 300; ++attempt) {
+			some<char8_t> text(attempt % 67);
+			for (auto& c : text)
+				c = static_cast<char8_t>(byte(rng) % 3 ? byte(rng) & 0x7F : byte(rng));
+			REQUIRE(SIMD::ValidateUtf8(text) == ReferenceValidUtf8(text));
+		}
+	}
+
+	GIVEN("Known invalid sequences") {
+		const some<some<char8_t>> invalid {
+			{0xC0, 0x80},						// Overlong two bytes
+			{0xE0, 0x80, 0x80},				// Overlong three bytes
+			{0xED, 0xA0, 0x80},				// Surrogate
+			{0xF4, 0x90, 0x80, 0x80},		// Above U+10FFFF
+			{0x80},								// Lone continuation
+			{'a', 0xE2, 0x82}					// Truncated at the end
+		};
+
+		for (auto& text : invalid)
+			REQUIRE_FALSE(SIMD::ValidateUtf8(text));
+	}
+}
+
+TEMPLATE_TEST_CASE("UTF transcoding", "[SIMD]", char8_t, char16_t, char32_t) {
+	using FROM = TestType;
+	std::mt19937 rng(4321);
+
+	for (Count count : {Count {1}, Count {15}, Count {64}, Count {333}}) {
+		GIVEN(count << " random code points") {
+			const auto codePoints = RandomCodePoints(rng, count);
+			some<FROM> input;
+			some<char8_t> utf8;
+			some<char16_t> utf16;
+			some<char32_t> utf32;
+			for (auto cp : codePoints) {
+				ReferenceEncode(cp, input);
+				ReferenceEncode(cp, utf8);
+				ReferenceEncode(cp, utf16);
+				ReferenceEncode(cp, utf32);
+			}
+
+			WHEN("Transcoded to all encodings") {
+				some<char8_t> to8(input.size() * 4);
+				some<char16_t> to16(input.size() * 2);
+				some<char32_t> to32(input.size());
+				to8.resize(SIMD::Transcode(input, to8));
+				to16.resize(SIMD::Transcode(input, to16));
+				to32.resize(SIMD::Transcode(input, to32));
+
+				THEN("The results should match the reference") {
+					REQUIRE(to8 == utf8);
+					REQUIRE(to16 == utf16);
+					REQUIRE(to32 == utf32);
+				}
+			}
+
+			WHEN("Transcoded into a smaller output") {
+				some<char16_t> to16(utf16.size() / 2);
+				const auto written = SIMD::Transcode(input, to16);
+
+				THEN("Only whole code points that fit should be written") {
+					REQUIRE(written <= to16.size());
+					REQUIRE(written + 1 >= to16.size());
+					for (Count i = 0; i < written; ++i)
+						REQUIRE(to16[i] == utf16[i]);
+				}
+			}
+		}
+	}
+
+	GIVEN("An unpaired surrogate") {
+		const some<char16_t> input {u'a', 0xD800, u'b'};
+		some<char8_t> output(16);
+
+		THEN("Transcoding should throw") {
+			REQUIRE_THROWS_AS(SIMD::Transcode(input, output), Except::Encoding);
+		}
+	}
+}
@@ -0,0 +1,118 @@
+///																									
+/// Langulus::TSIMDe																				
+/// Copyright(C) 2019 Dimo Markov <langulusteam@gmail.com>							
+///																									
+/// Distributed under GNU General Public License v3+									
+/// See LICENSE file, or https://www.gnu.org/licenses									
+///																									
+#include "Main.hpp"
+#include <catch2/catch.hpp>
+#include <cmath>
+
+TEMPLATE_TEST_CASE("Dot, Length and Normalize", "[SIMD]", float, double) {
+	using T = TestType;
+
+	GIVEN("Two 2D vectors") {
+		const T x[2] {T {3}, T {4}};
+		const T y[2] {T {-2}, T {0.5}};
+
+		THEN("Dot product and length should be correct") {
+			REQUIRE(SIMD::Dot(x, y) == T {-4});
+			REQUIRE(SIMD::Length(x) == T {5});
+		}
+	}
+
+	GIVEN("Two 3D vectors") {
+		const T x[3] {T {1}, T {2}, T {2}};
+		const T y[3] {T {4}, T {-5}, T {6}};
+
+		WHEN("The first vector is normalized") {
+			T r[3];
+			SIMD::Normalize(x, r);
+
+			THEN("The results should be correct") {
+				REQUIRE(SIMD::Dot(x, y) == T {6});
+				REQUIRE(SIMD::Length(x) == T {3});
+				REQUIRE(r[0] == Approx(T {1} / T {3}));
+				REQUIRE(r[1] == Approx(T {2} / T {3}));
+				REQUIRE(r[2] == Approx(T {2} / T {3}));
+			}
+		}
+	}
+
+	GIVEN("Two 4D vectors") {
+		const T x[4] {T {1}, T {-1}, T {1}, T {-1}};
+		const T y[4] {T {2}, T {3}, T {4}, T {5}};
+
+		THEN("Dot product and length should be correct") {
+			REQUIRE(SIMD::Dot(x, y) == T {-2});
+			REQUIRE(SIMD::Length(x) == T {2});
+		}
+	}
+
+	GIVEN("A zero vector") {
+		const T x[3] {};
+		T r[3];
+
+		THEN("Normalization should report division by zero") {
+			REQUIRE_THROWS(SIMD::Normalize(x, r));
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Batched Dot, Length and Normalize", "[SIMD]", float, double) {
+	using T = TestType;
+
+	for (Count count : {Count {1}, Count {9}, Count {64}, Count {101}}) {
+		GIVEN("A batch of " << count << " 3D vectors as structure of arrays") {
+			some<T> components[3] {some<T>(count), some<T>(count), some<T>(count)};
+			for (Count i = 0; i < count; ++i) {
+				components[0][i] = static_cast<T>(i % 7) + T {1};
+				components[1][i] = -static_cast<T>(i % 5);
+				components[2][i] = static_cast<T>(i % 3) * T {0.5};
+			}
+
+			WHEN("Dot products with themselves are computed") {
+				some<T> output(count);
+				SIMD::DotSpan(components, components, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						const T expected = components[0][i] * components[0][i]
+							+ components[1][i] * components[1][i]
+							+ components[2][i] * components[2][i];
+						REQUIRE(output[i] == Approx(expected));
+					}
+				}
+			}
+
+			WHEN("Lengths are computed") {
+				some<T> output(count);
+				SIMD::LengthSpan(components, output);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						const T v[3] {components[0][i], components[1][i], components[2][i]};
+						REQUIRE(output[i] == Approx(SIMD::Length(v)));
+					}
+				}
+			}
+
+			WHEN("The vectors are normalized in place") {
+				some<T> normalized[3] {components[0], components[1], components[2]};
+				SIMD::NormalizeSpan(normalized);
+
+				THEN("The results should be correct") {
+					for (Count i = 0; i < count; ++i) {
+						const T v[3] {components[0][i], components[1][i], components[2][i]};
+						T r[3];
+						SIMD::Normalize(v, r);
+						REQUIRE(normalized[0][i] == Approx(r[0]));
+						REQUIRE(normalized[1][i] == Approx(r[1]));
+						REQUIRE(normalized[2][i] == Approx(r[2]));
+					}
+				}
+			}
+		}
+	}
+}